@@ -137,7 +137,7 @@ strategies = ["area::cartesian", "area::spherical", "area::geographic"
     , "buffer::side_straight"
     , "buffer::geographic_point_circle"
     , "centroid::bashein_detmer", "centroid::average"
-    , "convex_hull::graham_andrew"
+    , "convex_hull::akl_toussaint", "convex_hull::graham_andrew"
     , "densify::cartesian", "densify::geographic", "densify::spherical"
     , "distance::pythagoras", "distance::pythagoras_box_box"
     , "distance::pythagoras_point_box", "distance::haversine"
@@ -0,0 +1,125 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/extensions/algorithms/buffer_raster.hpp>
+
+
+template <typename MultiPolygon, typename Geometry>
+void test_geometry(std::string const& caseid, std::string const& wkt,
+        double distance, double cell_size,
+        std::size_t expected_count, std::size_t expected_holes,
+        double expected_area)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::strategy::buffer::distance_symmetric<double> const strategy(distance);
+
+    bg::raster_mask<point_type> mask;
+    bg::buffer_raster_mask(geometry, mask, strategy, cell_size);
+
+    // The border of the raster is always outside
+    for (std::size_t x = 0; x < mask.width(); x++)
+    {
+        BOOST_CHECK(! mask.get(x, 0) && ! mask.get(x, mask.height() - 1));
+    }
+    for (std::size_t y = 0; y < mask.height(); y++)
+    {
+        BOOST_CHECK(! mask.get(0, y) && ! mask.get(mask.width() - 1, y));
+    }
+
+    MultiPolygon multi_polygon;
+    bg::buffer_raster(geometry, multi_polygon, strategy, cell_size);
+
+    double const area = bg::area(multi_polygon);
+
+    // The boundary of the approximation is within about one cell of the
+    // exact boundary
+    double const tolerance = cell_size * bg::perimeter(multi_polygon);
+
+    BOOST_CHECK_MESSAGE(boost::size(multi_polygon) == expected_count,
+            caseid << " count expected: " << expected_count
+            << " detected: " << boost::size(multi_polygon));
+    BOOST_CHECK_MESSAGE(bg::num_interior_rings(multi_polygon) == expected_holes,
+            caseid << " holes expected: " << expected_holes
+            << " detected: " << bg::num_interior_rings(multi_polygon));
+    BOOST_CHECK_MESSAGE(bg::math::abs(area - expected_area) <= tolerance,
+            caseid << " area expected: " << expected_area
+            << " detected: " << area);
+    BOOST_CHECK_MESSAGE(bg::is_valid(multi_polygon),
+            caseid << " result is not valid");
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_point<P> multi_point;
+
+    double const pi = boost::math::constants::pi<double>();
+
+    test_geometry<multi_polygon, P>("point", "POINT(0 0)",
+            5.0, 0.1, 1, 0, pi * 25.0);
+    test_geometry<multi_polygon, multi_point>("points",
+            "MULTIPOINT((0 0),(20 0),(3 0))",
+            2.0, 0.05, 2, 0, 35.886);
+    test_geometry<multi_polygon, linestring>("line", "LINESTRING(0 0,10 0)",
+            1.0, 0.05, 1, 0, 20.0 + pi);
+    test_geometry<multi_polygon, polygon>("square",
+            "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+            1.0, 0.05, 1, 0, 100.0 + 40.0 + pi);
+    test_geometry<multi_polygon, polygon>("square_hole",
+            "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))",
+            1.0, 0.05, 1, 1, 100.0 + 40.0 + pi - 16.0);
+    test_geometry<multi_polygon, polygon>("square_deflate",
+            "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+            -1.0, 0.05, 1, 0, 64.0);
+    test_geometry<multi_polygon, polygon>("square_vanish",
+            "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+            -6.0, 0.05, 0, 0, 0.0);
+    test_geometry<multi_polygon, linestring>("line_deflate",
+            "LINESTRING(0 0,10 0)",
+            -1.0, 0.05, 0, 0, 0.0);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    // The cell size should be positive
+    bool thrown = false;
+    try
+    {
+        typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+        bg::model::multi_polygon<bg::model::polygon<point_type> > result;
+        bg::buffer_raster(point_type(0, 0), result,
+                bg::strategy::buffer::distance_symmetric<double>(1.0), 0.0);
+    }
+    catch (bg::invalid_input_exception const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+
+    return 0;
+}
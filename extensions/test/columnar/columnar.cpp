@@ -0,0 +1,232 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+#include <boost/geometry/extensions/columnar/columnar.hpp>
+
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::linestring<point_type> linestring_type;
+
+typedef bg::model::columnar_buffers<point_type> buffers_type;
+typedef bg::model::columnar_polygon<point_type> col_polygon;
+typedef bg::model::columnar_multi_polygon<point_type> col_multi_polygon;
+typedef bg::model::columnar_linestring<point_type> col_linestring;
+typedef bg::model::columnar_multi_linestring<point_type> col_multi_linestring;
+typedef bg::model::columnar_multi_point<point_type> col_multi_point;
+
+
+// Appends the geometries to buffers in the GeoArrow layout, the geometry
+// offsets of a column of linestrings are the ring offsets
+struct column_builder
+{
+    std::vector<double> coordinates;
+    std::vector<boost::int32_t> ring_offsets;
+    std::vector<boost::int32_t> part_offsets;
+    std::vector<boost::int32_t> geometry_offsets;
+
+    column_builder()
+        : ring_offsets(1, 0)
+        , part_offsets(1, 0)
+        , geometry_offsets(1, 0)
+    {}
+
+    template <typename Range>
+    void add_points(Range const& range)
+    {
+        for (std::size_t i = 0; i < boost::size(range); i++)
+        {
+            coordinates.push_back(bg::get<0>(range[i]));
+            coordinates.push_back(bg::get<1>(range[i]));
+        }
+        ring_offsets.push_back(boost::int32_t(coordinates.size() / 2));
+    }
+
+    void add_rings(polygon_type const& polygon)
+    {
+        add_points(polygon.outer());
+        for (std::size_t i = 0; i < polygon.inners().size(); i++)
+        {
+            add_points(polygon.inners()[i]);
+        }
+    }
+
+    void add(polygon_type const& polygon)
+    {
+        add_rings(polygon);
+        geometry_offsets.push_back(boost::int32_t(ring_offsets.size() - 1));
+    }
+
+    void add(multi_polygon_type const& multi)
+    {
+        for (std::size_t i = 0; i < multi.size(); i++)
+        {
+            add_rings(multi[i]);
+            part_offsets.push_back(boost::int32_t(ring_offsets.size() - 1));
+        }
+        geometry_offsets.push_back(boost::int32_t(part_offsets.size() - 1));
+    }
+
+    buffers_type buffers() const
+    {
+        return buffers_type(&coordinates[0], &ring_offsets[0], &part_offsets[0]);
+    }
+};
+
+template <typename Columnar, typename Geometry>
+void check_geometry(Columnar const& columnar, Geometry const& geometry)
+{
+    BOOST_CHECK_EQUAL(bg::num_points(columnar), bg::num_points(geometry));
+    BOOST_CHECK_CLOSE(bg::area(columnar), bg::area(geometry), 0.0001);
+
+    box_type const expected = bg::return_envelope<box_type>(geometry);
+    box_type const envelope = bg::return_envelope<box_type>(columnar);
+    BOOST_CHECK(bg::equals(envelope, expected));
+
+    point_type const inside(2.5, 2.5);
+    point_type const hole(5.5, 5.5);
+    BOOST_CHECK_EQUAL(bg::within(inside, columnar), bg::within(inside, geometry));
+    BOOST_CHECK_EQUAL(bg::within(hole, columnar), bg::within(hole, geometry));
+
+    box_type const query(point_type(1, 1), point_type(3, 3));
+    BOOST_CHECK_EQUAL(bg::intersects(columnar, query), bg::intersects(geometry, query));
+
+    linestring_type line;
+    bg::read_wkt("LINESTRING(-1 5.5,5.5 5.5)", line);
+    BOOST_CHECK_EQUAL(bg::intersects(columnar, line), bg::intersects(geometry, line));
+
+    polygon_type other;
+    bg::read_wkt("POLYGON((5.2 5.2,5.2 5.8,5.8 5.8,5.8 5.2,5.2 5.2))", other);
+    BOOST_CHECK_EQUAL(bg::intersects(columnar, other), bg::intersects(geometry, other));
+    BOOST_CHECK_EQUAL(bg::within(other, columnar), bg::within(other, geometry));
+}
+
+void test_polygons()
+{
+    char const* wkts[] =
+    {
+        "POLYGON((0 0,0 4,4 4,4 0,0 0))",
+        "POLYGON((4 4,4 7,7 7,7 4,4 4),(5 5,6 5,6 6,5 6,5 5))",
+        "POLYGON((10 10,10 20,20 20,10 10))"
+    };
+
+    std::vector<polygon_type> polygons;
+    column_builder builder;
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        polygon_type polygon;
+        bg::read_wkt(wkts[i], polygon);
+        polygons.push_back(polygon);
+        builder.add(polygon);
+    }
+
+    bg::model::columnar_array<col_polygon> const column(builder.buffers(),
+        &builder.geometry_offsets[0], polygons.size());
+
+    BOOST_CHECK_EQUAL(column.size(), 3u);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(column[0]), 0u);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(column[1]), 1u);
+
+    for (std::size_t i = 0; i < polygons.size(); i++)
+    {
+        check_geometry(column[i], polygons[i]);
+    }
+
+    // Iteration creates the same views
+    std::size_t count = 0;
+    double total = 0;
+    typedef bg::model::columnar_array<col_polygon>::const_iterator iterator;
+    for (iterator it = column.begin(); it != column.end(); ++it, ++count)
+    {
+        total += bg::area(*it);
+    }
+    BOOST_CHECK_EQUAL(count, 3u);
+    BOOST_CHECK_CLOSE(total, 16.0 + 8.0 + 50.0, 0.0001);
+}
+
+void test_multi_polygons()
+{
+    multi_polygon_type multi1, multi2;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0)),"
+                 "((4 4,4 7,7 7,7 4,4 4),(5 5,6 5,6 6,5 6,5 5)))", multi1);
+    bg::read_wkt("MULTIPOLYGON(((10 10,10 20,20 20,10 10)))", multi2);
+
+    column_builder builder;
+    builder.add(multi1);
+    builder.add(multi2);
+
+    bg::model::columnar_array<col_multi_polygon> const column(builder.buffers(),
+        &builder.geometry_offsets[0], 2);
+
+    BOOST_CHECK_EQUAL(column.size(), 2u);
+    BOOST_CHECK_EQUAL(boost::size(column[0]), 2u);
+    BOOST_CHECK_EQUAL(boost::size(column[1]), 1u);
+
+    check_geometry(column[0], multi1);
+    check_geometry(column[1], multi2);
+}
+
+void test_linear()
+{
+    linestring_type line1, line2;
+    bg::read_wkt("LINESTRING(0 0,3 4,3 8)", line1);
+    bg::read_wkt("LINESTRING(10 0,10 10)", line2);
+
+    column_builder builder;
+    builder.add_points(line1);
+    builder.add_points(line2);
+    builder.geometry_offsets.push_back(2);
+
+    bg::model::columnar_array<col_linestring> const linestrings(builder.buffers(),
+        &builder.ring_offsets[0], 2);
+    BOOST_CHECK_EQUAL(bg::num_points(linestrings[0]), 3u);
+    BOOST_CHECK_CLOSE(bg::length(linestrings[0]), 9.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::length(linestrings[1]), 10.0, 0.0001);
+
+    bg::model::columnar_array<col_multi_linestring> const multis(builder.buffers(),
+        &builder.geometry_offsets[0], 1);
+    BOOST_CHECK_EQUAL(boost::size(multis[0]), 2u);
+    BOOST_CHECK_CLOSE(bg::length(multis[0]), 19.0, 0.0001);
+
+    box_type const query(point_type(9, 4), point_type(11, 6));
+    BOOST_CHECK(! bg::intersects(linestrings[0], query));
+    BOOST_CHECK(bg::intersects(multis[0], query));
+
+    // A view can also be created directly on the coordinates
+    col_multi_point const points(&builder.coordinates[0], 5);
+    BOOST_CHECK_EQUAL(bg::num_points(points), 5u);
+    box_type const envelope = bg::return_envelope<box_type>(points);
+    BOOST_CHECK(bg::equals(envelope, box_type(point_type(0, 0), point_type(10, 10))));
+    BOOST_CHECK(bg::within(point_type(3, 4), points));
+}
+
+int test_main(int, char* [])
+{
+    test_polygons();
+    test_multi_polygons();
+    test_linear();
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <boost/geometry/extensions/compressed/compressed.hpp>
+
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::ring<point_type> ring_type;
+
+typedef bg::model::compressed_ring<point_type> compressed_ring_type;
+typedef bg::model::compressed_polygon<point_type> compressed_polygon_type;
+
+
+void test_varint()
+{
+    namespace bgc = bg::detail::compressed;
+
+    boost::int32_t const values[] = { 0, 1, -1, 63, -64, 64, 1000000,
+                                      -2147483647 - 1, 2147483647 };
+    std::vector<boost::uint8_t> bytes;
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        bgc::put_varint(bgc::zigzag(boost::uint32_t(values[i])), bytes);
+    }
+    // Small values take one byte
+    BOOST_CHECK_EQUAL(bytes[0], 0u);
+    BOOST_CHECK_EQUAL(bytes[1], 2u);
+    BOOST_CHECK_EQUAL(bytes[2], 1u);
+
+    boost::uint8_t const* it = &bytes[0];
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        BOOST_CHECK_EQUAL(boost::int32_t(bgc::unzigzag(bgc::get_varint(it))), values[i]);
+    }
+    BOOST_CHECK(it == &bytes[0] + bytes.size());
+}
+
+void test_ring()
+{
+    ring_type ring;
+    bg::read_wkt("POLYGON((0 0,0 -2147483.648,2147483.647 5,1.5 0.001,0 0))", ring);
+
+    compressed_ring_type const compressed(ring, 0.001);
+    BOOST_CHECK_EQUAL(compressed.size(), ring.size());
+
+    // Forward
+    std::size_t i = 0;
+    for (compressed_ring_type::const_iterator it = compressed.begin();
+         it != compressed.end(); ++it, ++i)
+    {
+        BOOST_CHECK_CLOSE(bg::get<0>(*it) + 1.0, bg::get<0>(ring[i]) + 1.0, 1.0e-9);
+        BOOST_CHECK_CLOSE(bg::get<1>(*it) + 1.0, bg::get<1>(ring[i]) + 1.0, 1.0e-9);
+    }
+    BOOST_CHECK_EQUAL(i, ring.size());
+
+    // Backward
+    compressed_ring_type::const_iterator it = compressed.end();
+    while (i > 0)
+    {
+        --it;
+        --i;
+        BOOST_CHECK_CLOSE(bg::get<0>(*it) + 1.0, bg::get<0>(ring[i]) + 1.0, 1.0e-9);
+        BOOST_CHECK_CLOSE(bg::get<1>(*it) + 1.0, bg::get<1>(ring[i]) + 1.0, 1.0e-9);
+    }
+    BOOST_CHECK(it == compressed.begin());
+
+    BOOST_CHECK(compressed_ring_type().begin() == compressed_ring_type().end());
+}
+
+void test_random_access()
+{
+    ring_type ring;
+    for (int i = 0; i < 100; i++)
+    {
+        ring.push_back(point_type(i * i % 17 - 8, -i));
+    }
+
+    compressed_ring_type compressed(ring);
+    BOOST_CONCEPT_ASSERT( (bg::concepts::Ring<compressed_ring_type>) );
+
+    compressed_ring_type::const_iterator const first = compressed.begin();
+    int const indexes[] = { 0, 99, 31, 32, 33, 64, 1, 95, 63, 0 };
+    compressed_ring_type::const_iterator it = first;
+    for (std::size_t i = 0; i < sizeof(indexes) / sizeof(indexes[0]); i++)
+    {
+        int const index = indexes[i];
+        it += index - (it - first);
+        BOOST_CHECK(bg::equals(*it, ring[index]));
+        BOOST_CHECK(bg::equals(*(first + index), ring[index]));
+        BOOST_CHECK(bg::equals(compressed[index], ring[index]));
+    }
+    BOOST_CHECK(bg::equals(*(compressed.end() - 33), ring[67]));
+    BOOST_CHECK_EQUAL(compressed.end() - compressed.begin(), 100);
+
+    // Truncate at and between checkpoints, then append again
+    compressed.resize(64);
+    BOOST_CHECK_EQUAL(compressed.size(), 64u);
+    BOOST_CHECK(bg::equals(compressed.back(), ring[63]));
+    compressed.resize(40);
+    BOOST_CHECK(bg::equals(compressed.back(), ring[39]));
+    for (std::size_t i = 40; i < ring.size(); i++)
+    {
+        compressed.push_back(ring[i]);
+    }
+    BOOST_CHECK_EQUAL(compressed.size(), 100u);
+    for (std::size_t i = 0; i < ring.size(); i++)
+    {
+        BOOST_CHECK(bg::equals(compressed[i], ring[i]));
+    }
+    compressed.resize(102);
+    BOOST_CHECK(bg::equals(compressed.back(), point_type(0, 0)));
+}
+
+void test_polygon()
+{
+    // A circle with a hole, coordinates with a precision of 1 cm
+    polygon_type polygon;
+    std::size_t const count = 1000;
+    double const pi = bg::math::pi<double>();
+    for (std::size_t i = 0; i <= count; i++)
+    {
+        double const angle = -2.0 * pi * double(i % count) / double(count);
+        polygon.outer().push_back(point_type(
+            std::floor(500000.0 + 1000.0 * std::cos(angle)) + 0.25,
+            std::floor(6000000.0 + 1000.0 * std::sin(angle)) + 0.75));
+    }
+    bg::model::ring<point_type> hole;
+    bg::read_wkt("POLYGON((500000 6000000,500010 6000000,500010 6000010,"
+                 "500000 6000010,500000 6000000))", hole);
+    polygon.inners().push_back(hole);
+
+    compressed_polygon_type const compressed(polygon, 0.01);
+
+    BOOST_CHECK_EQUAL(bg::num_points(compressed), bg::num_points(polygon));
+    BOOST_CONCEPT_ASSERT( (bg::concepts::Polygon<compressed_polygon_type>) );
+
+    BOOST_CHECK_CLOSE(bg::area(compressed), bg::area(polygon), 1.0e-9);
+    BOOST_CHECK_CLOSE(bg::perimeter(compressed), bg::perimeter(polygon), 1.0e-9);
+
+    box_type const envelope = bg::return_envelope<box_type>(compressed);
+    BOOST_CHECK(bg::equals(envelope, bg::return_envelope<box_type>(polygon)));
+
+    point_type const inside(500500, 6000000);
+    point_type const in_hole(500005, 6000005);
+    point_type const outside(502000, 6000000);
+    BOOST_CHECK(bg::within(inside, compressed));
+    BOOST_CHECK(! bg::within(in_hole, compressed));
+    BOOST_CHECK(! bg::within(outside, compressed));
+
+    BOOST_CHECK_CLOSE(bg::distance(outside, compressed),
+                      bg::distance(outside, polygon), 1.0e-9);
+    BOOST_CHECK_CLOSE(bg::distance(in_hole, compressed),
+                      bg::distance(in_hole, polygon), 1.0e-9);
+
+    // Neighbouring points differ by less than 64 steps in most cases,
+    // two bytes per point instead of two doubles
+    std::size_t bytes = compressed.outer().byte_count();
+    BOOST_CHECK_LT(bytes * 4, polygon.outer().size() * sizeof(point_type));
+}
+
+int test_main(int, char* [])
+{
+    test_varint();
+    test_ring();
+    test_random_access();
+    test_polygon();
+
+    return 0;
+}
@@ -0,0 +1,259 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/algorithms/for_each.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+#include <boost/geometry/extensions/gis/io/mvt/write_mvt.hpp>
+
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef std::vector<boost::uint32_t> command_vector;
+
+// Rings (or parts) decoded from commands, in tile coordinates
+typedef std::vector<std::vector<std::pair<int, int> > > part_vector;
+
+// WKT is given in tile coordinates, y pointing down, the geometries are
+// mirrored into a tile box with y pointing up
+struct mirror
+{
+    explicit mirror(double size) : m_size(size) {}
+
+    template <typename Point>
+    inline void operator()(Point& p) const
+    {
+        bg::set<1>(p, m_size - bg::get<1>(p));
+    }
+
+    double m_size;
+};
+
+template <typename Geometry>
+Geometry from_tile_wkt(std::string const& wkt, double size)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    bg::for_each_point(geometry, mirror(size));
+    return geometry;
+}
+
+inline int unzigzag(boost::uint32_t value)
+{
+    return int(value >> 1) ^ -int(value & 1);
+}
+
+part_vector decode(command_vector const& commands)
+{
+    part_vector parts;
+    int x = 0, y = 0;
+    std::size_t i = 0;
+    while (i < commands.size())
+    {
+        boost::uint32_t const id = commands[i] & 7;
+        boost::uint32_t const count = commands[i] >> 3;
+        i++;
+        for (boost::uint32_t c = 0; id != 7 && c < count; c++)
+        {
+            x += unzigzag(commands[i++]);
+            y += unzigzag(commands[i++]);
+            if (id == 1)
+            {
+                parts.push_back(part_vector::value_type());
+            }
+            parts.back().push_back(std::make_pair(x, y));
+        }
+    }
+    return parts;
+}
+
+// Twice the area, positive for clockwise rings in tile coordinates
+long long area(part_vector::value_type const& ring)
+{
+    long long result = 0;
+    for (std::size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++)
+    {
+        result += (long long)(ring[j].first) * ring[i].second
+                - (long long)(ring[i].first) * ring[j].second;
+    }
+    return result;
+}
+
+template <typename Geometry>
+void check_encode(std::string const& wkt, boost::uint32_t const* expected,
+                 std::size_t expected_size, int expected_type,
+                 double size = 4096, boost::uint32_t buffer = 0)
+{
+    Geometry const geometry = from_tile_wkt<Geometry>(wkt, size);
+    box_type const tile(point_type(0, 0), point_type(size, size));
+
+    // Contents are replaced
+    command_vector commands(3, 99);
+    int const type = bg::write_mvt(geometry, tile, commands, 4096, buffer);
+
+    BOOST_CHECK_MESSAGE(type == expected_type,
+        wkt << " type " << type << " expected " << expected_type);
+    BOOST_CHECK_MESSAGE(commands == command_vector(expected, expected + expected_size),
+        wkt << " has unexpected commands");
+}
+
+template <typename Geometry, std::size_t N>
+void test_encode(std::string const& wkt, boost::uint32_t const (&expected)[N],
+                 int expected_type, double size = 4096)
+{
+    check_encode<Geometry>(wkt, expected, N, expected_type, size);
+}
+
+template <typename Geometry>
+void test_empty(std::string const& wkt, double size = 4096)
+{
+    check_encode<Geometry>(wkt, NULL, 0, bg::mvt_geometry_type::unknown, size);
+}
+
+// Examples of the specification of vector tiles, version 2.1
+void test_specification()
+{
+    typedef bg::model::multi_point<point_type> multi_point_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+    boost::uint32_t const point[] = { 9, 50, 34 };
+    test_encode<point_type>("POINT(25 17)", point, bg::mvt_geometry_type::point);
+
+    boost::uint32_t const multi_point[] = { 17, 10, 14, 3, 9 };
+    test_encode<multi_point_type>("MULTIPOINT((5 7),(3 2))", multi_point,
+                                  bg::mvt_geometry_type::point);
+
+    boost::uint32_t const linestring[] = { 9, 4, 4, 18, 0, 16, 16, 0 };
+    test_encode<linestring_type>("LINESTRING(2 2,2 10,10 10)", linestring,
+                                 bg::mvt_geometry_type::linestring);
+
+    boost::uint32_t const multi_linestring[]
+        = { 9, 4, 4, 18, 0, 16, 16, 0, 9, 17, 17, 10, 4, 8 };
+    test_encode<multi_linestring_type>("MULTILINESTRING((2 2,2 10,10 10),(1 1,3 5))",
+                                       multi_linestring,
+                                       bg::mvt_geometry_type::linestring);
+
+    boost::uint32_t const polygon[] = { 9, 6, 12, 18, 10, 12, 24, 44, 15 };
+    test_encode<polygon_type>("POLYGON((3 6,8 12,20 34,3 6))", polygon,
+                              bg::mvt_geometry_type::polygon);
+    // Winding order is corrected
+    test_encode<polygon_type>("POLYGON((3 6,20 34,8 12,3 6))", polygon,
+                              bg::mvt_geometry_type::polygon);
+
+    boost::uint32_t const multi_polygon[]
+        = { 9, 0, 0, 26, 20, 0, 0, 20, 19, 0, 15,
+            9, 22, 2, 26, 18, 0, 0, 18, 17, 0, 15,
+            9, 4, 13, 26, 0, 8, 8, 0, 0, 7, 15 };
+    test_encode<multi_polygon_type>("MULTIPOLYGON(((0 0,10 0,10 10,0 10,0 0)),"
+                                    "((11 11,20 11,20 20,11 20,11 11),"
+                                    "(13 13,13 17,17 17,17 13,13 13)))",
+                                    multi_polygon, bg::mvt_geometry_type::polygon);
+}
+
+void test_simplification()
+{
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+
+    // Duplicate and collinear points
+    boost::uint32_t const collinear[] = { 9, 0, 0, 18, 20, 0, 0, 20 };
+    test_encode<linestring_type>("LINESTRING(0 0,0 0,5 0,10 0,10 10)", collinear,
+                                 bg::mvt_geometry_type::linestring);
+
+    // A spike keeps the extent of the linestring
+    boost::uint32_t const spike[] = { 9, 0, 0, 18, 20, 0, 9, 0 };
+    test_encode<linestring_type>("LINESTRING(0 0,10 0,5 0)", spike,
+                                 bg::mvt_geometry_type::linestring);
+
+    // Points are rounded to the same tile coordinates
+    boost::uint32_t const quantized[] = { 9, 0, 0, 10, 20, 0 };
+    test_encode<linestring_type>("LINESTRING(0 0,4 0,100 0)", quantized,
+                                 bg::mvt_geometry_type::linestring, 40960);
+    test_empty<linestring_type>("LINESTRING(0 0,4 0)", 40960);
+
+    // Collinear points of rings, also around the closing point
+    boost::uint32_t const ring[] = { 9, 0, 0, 26, 20, 0, 0, 20, 19, 0, 15 };
+    test_encode<polygon_type>("POLYGON((0 0,5 0,10 0,10 10,0 10,0 5,0 0))", ring,
+                              bg::mvt_geometry_type::polygon);
+    boost::uint32_t const rotated[] = { 9, 0, 0, 26, 20, 0, 0, 20, 19, 0, 15 };
+    test_encode<polygon_type>("POLYGON((0 5,0 0,10 0,10 10,0 10,0 5))", rotated,
+                              bg::mvt_geometry_type::polygon);
+
+    // Degenerate rings, the holes of a degenerate exterior ring are dropped
+    test_empty<polygon_type>("POLYGON((0 0,10 0,20 0,0 0))");
+    test_empty<polygon_type>("POLYGON((0 0,4 0,4 4,0 4,0 0),(1 1,1 2,2 2,1 1))", 40960);
+    boost::uint32_t const hole_dropped[] = { 9, 0, 0, 26, 20, 0, 0, 20, 19, 0, 15 };
+    test_encode<polygon_type>("POLYGON((0 0,100 0,100 100,0 100,0 0),"
+                              "(10 10,11 10,11 11,10 10))", hole_dropped,
+                              bg::mvt_geometry_type::polygon, 40960);
+}
+
+void test_clip()
+{
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+
+    boost::uint32_t const enters[] = { 9, 0, 20, 18, 200, 0, 0, 8172 };
+    test_encode<linestring_type>("LINESTRING(-100 10,100 10,100 5000)", enters,
+                                 bg::mvt_geometry_type::linestring);
+
+    // Each part inside the tile is a separate linestring
+    boost::uint32_t const parts[] = { 9, 20, 20, 10, 19, 0, 9, 0, 20, 10, 20, 0 };
+    test_encode<linestring_type>("LINESTRING(10 10,-10 10,-10 20,10 20)", parts,
+                                 bg::mvt_geometry_type::linestring);
+
+    test_empty<point_type>("POINT(5000 10)");
+    test_empty<linestring_type>("LINESTRING(-10 -10,-10 5000)");
+    test_empty<polygon_type>("POLYGON((-20 -20,-10 -20,-10 -10,-20 -20))");
+
+    // Polygons are clipped at the tile extended by the buffer
+    polygon_type const polygon = from_tile_wkt<polygon_type>(
+        "POLYGON((-100 -100,5000 -100,5000 5000,-100 5000,-100 -100),"
+        "(-50 -50,-50 50,50 50,50 -50,-50 -50),"
+        "(1000 1000,1000 2000,2000 2000,1000 1000))", 4096);
+    box_type const tile(point_type(0, 0), point_type(4096, 4096));
+
+    bg::mvt_encoder encoder(tile, 4096, 64);
+    command_vector commands;
+    BOOST_CHECK(encoder.encode(polygon, commands) == bg::mvt_geometry_type::polygon);
+
+    part_vector const rings = decode(commands);
+    BOOST_CHECK_EQUAL(rings.size(), 3u);
+    BOOST_CHECK_EQUAL(rings[0].size(), 4u);
+    BOOST_CHECK_EQUAL(area(rings[0]), 2 * 4224LL * 4224LL);
+    BOOST_CHECK_EQUAL(area(rings[1]), -2 * 100LL * 100LL);
+    BOOST_CHECK_EQUAL(area(rings[2]), -1000LL * 1000LL);
+
+    // The encoder is reused, the capacity of the commands is kept
+    std::size_t const capacity = commands.capacity();
+    BOOST_CHECK(encoder.encode(bg::exterior_ring(polygon), commands)
+                == bg::mvt_geometry_type::polygon);
+    BOOST_CHECK_EQUAL(commands.size(), 11u);
+    BOOST_CHECK_EQUAL(commands.capacity(), capacity);
+}
+
+int test_main(int, char* [])
+{
+    test_specification();
+    test_simplification();
+    test_clip();
+
+    return 0;
+}
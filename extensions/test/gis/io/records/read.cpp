@@ -0,0 +1,238 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+#include <boost/geometry/extensions/gis/io/records/mapped_file.hpp>
+#include <boost/geometry/extensions/gis/io/records/read.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+#include <boost/geometry/extensions/multi/gis/io/wkb/write_wkb.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+
+polygon_type make_polygon(int i)
+{
+    std::ostringstream out;
+    out << "POLYGON((0 0,0 " << (i + 1) << "," << (i + 1) << " " << (i + 1)
+        << "," << (i + 1) << " 0,0 0)";
+    if (i % 3 == 0)
+    {
+        out << ",(0.25 0.25,0.5 0.25,0.5 0.5,0.25 0.25)";
+    }
+    out << ")";
+
+    polygon_type result;
+    bg::read_wkt(out.str(), result);
+    return result;
+}
+
+std::string to_wkt(polygon_type const& polygon)
+{
+    std::ostringstream out;
+    out << std::setprecision(17) << bg::wkt(polygon);
+    return out.str();
+}
+
+struct wkt_collector
+{
+    std::vector<std::string> wkts;
+
+    void operator()(polygon_type const& polygon)
+    {
+        wkts.push_back(to_wkt(polygon));
+    }
+};
+
+template <typename Format>
+std::vector<std::string> read_all(bg::record_reader<Format>& reader)
+{
+    polygon_type polygon;
+    return bg::for_each_record(reader, polygon, wkt_collector()).wkts;
+}
+
+template <typename Format>
+std::vector<std::string> read_parts(std::string const& data, std::size_t count)
+{
+    char const* first = data.data();
+    char const* last = first + data.size();
+
+    std::vector<char const*> boundaries;
+    bg::split_records<Format>(first, last, count, boundaries);
+    BOOST_CHECK_EQUAL(boundaries.size(), count + 1);
+    BOOST_CHECK(boundaries.front() == first && boundaries.back() == last);
+
+    std::vector<std::string> result;
+    for (std::size_t i = 0; i + 1 < boundaries.size(); i++)
+    {
+        BOOST_CHECK(boundaries[i] <= boundaries[i + 1]);
+        bg::record_reader<Format> reader(boundaries[i], boundaries[i + 1]);
+        std::vector<std::string> const part = read_all(reader);
+        result.insert(result.end(), part.begin(), part.end());
+    }
+    return result;
+}
+
+template <typename Format>
+void test_all(std::string const& caseid, std::string const& data,
+              std::vector<std::string> const& expected)
+{
+    // In memory
+    {
+        bg::record_reader<Format> reader(data.data(), data.data() + data.size());
+        std::vector<std::string> const detected = read_all(reader);
+        BOOST_CHECK_MESSAGE(detected == expected, caseid << " memory");
+    }
+
+    // From stream, with blocks shorter and longer than records
+    std::size_t const block_sizes[] = { 1, 7, 100, 65536 };
+    for (std::size_t i = 0; i < sizeof(block_sizes) / sizeof(std::size_t); i++)
+    {
+        std::istringstream stream(data);
+        bg::record_reader<Format> reader(stream, block_sizes[i]);
+        std::vector<std::string> const detected = read_all(reader);
+        BOOST_CHECK_MESSAGE(detected == expected,
+                            caseid << " stream, block " << block_sizes[i]);
+    }
+
+    // Parts containing whole records
+    for (std::size_t count = 1; count < 8; count++)
+    {
+        std::vector<std::string> const detected = read_parts<Format>(data, count);
+        BOOST_CHECK_MESSAGE(detected == expected,
+                            caseid << " parts " << count);
+    }
+    BOOST_CHECK(read_parts<Format>(data, data.size() * 2) == expected);
+}
+
+void test_wkt()
+{
+    std::vector<std::string> expected;
+    std::string data;
+    for (int i = 0; i < 50; i++)
+    {
+        expected.push_back(to_wkt(make_polygon(i)));
+        data += expected.back();
+        data += i % 10 == 0 ? "\r\n" : "\n";
+        if (i % 7 == 0)
+        {
+            data += "  \n";
+        }
+    }
+    test_all<bg::format_wkt>("wkt", data, expected);
+
+    // Last record without new line
+    data += "POLYGON((0 0,0 1,1 0,0 0))";
+    expected.push_back("POLYGON((0 0,0 1,1 0,0 0))");
+    test_all<bg::format_wkt>("wkt no eol", data, expected);
+
+    // Offsets of the records
+    std::string const lines = "POINT(1 2)\n\nPOINT(3 4)\nPOINT(5 6)";
+    std::istringstream stream(lines);
+    bg::record_reader<bg::format_wkt> reader(stream, 3);
+    point_type point;
+    BOOST_CHECK(reader.read(point));
+    BOOST_CHECK_EQUAL(reader.record_offset(), 0u);
+    BOOST_CHECK(reader.read(point));
+    BOOST_CHECK_EQUAL(reader.record_offset(), 12u);
+    BOOST_CHECK_EQUAL(bg::get<0>(point), 3.0);
+    BOOST_CHECK(reader.read(point));
+    BOOST_CHECK_EQUAL(reader.record_offset(), 23u);
+    BOOST_CHECK_EQUAL(bg::get<1>(point), 6.0);
+    BOOST_CHECK(! reader.read(point));
+
+    // Invalid record
+    std::string const invalid = "POINT(1 2)\nPOINT(1 x)\n";
+    bg::record_reader<bg::format_wkt> invalid_reader(invalid.data(),
+                                                     invalid.data() + invalid.size());
+    BOOST_CHECK(invalid_reader.read(point));
+    BOOST_CHECK_THROW(invalid_reader.read(point), bg::read_wkt_exception);
+
+    // Memory mapped file
+    std::string const filename = "records_read_test.wkt";
+    {
+        std::ofstream out(filename.c_str(), std::ios::binary);
+        out << data;
+    }
+    {
+        bg::mapped_file file(filename);
+        BOOST_CHECK(file.is_open());
+        BOOST_CHECK_EQUAL(file.size(), data.size());
+        bg::record_reader<bg::format_wkt> file_reader(file.begin(), file.end());
+        BOOST_CHECK(read_all(file_reader) == expected);
+    }
+    std::remove(filename.c_str());
+
+    BOOST_CHECK(! bg::mapped_file("records_read_test_missing.wkt").is_open());
+}
+
+void test_wkb()
+{
+    std::vector<std::string> expected;
+    std::string data;
+    for (int i = 0; i < 30; i++)
+    {
+        polygon_type const polygon = make_polygon(i);
+        expected.push_back(to_wkt(polygon));
+        bg::write_wkb(polygon, std::back_inserter(data));
+    }
+    test_all<bg::format_wkb>("wkb", data, expected);
+
+    // Multi polygons, the geometry is cleared before each record
+    multi_polygon_type mpoly;
+    mpoly.push_back(make_polygon(0));
+    mpoly.push_back(make_polygon(1));
+    std::string mdata;
+    bg::write_wkb(mpoly, std::back_inserter(mdata));
+    bg::write_wkb(mpoly, std::back_inserter(mdata));
+
+    std::istringstream stream(mdata);
+    bg::record_reader<bg::format_wkb> reader(stream, 16);
+    multi_polygon_type detected;
+    std::size_t count = 0;
+    while (reader.read(detected))
+    {
+        BOOST_CHECK_EQUAL(boost::size(detected), 2u);
+        BOOST_CHECK_EQUAL(bg::num_points(detected), bg::num_points(mpoly));
+        count++;
+    }
+    BOOST_CHECK_EQUAL(count, 2u);
+
+    std::vector<char const*> boundaries;
+    bg::split_records<bg::format_wkb>(mdata.data(), mdata.data() + mdata.size(),
+                                      2, boundaries);
+    BOOST_CHECK(boundaries[1] == mdata.data() + mdata.size() / 2);
+
+    // Truncated record
+    std::string const truncated = data.substr(0, data.size() - 3);
+    bg::record_reader<bg::format_wkb> truncated_reader(truncated.data(),
+                                                       truncated.data() + truncated.size());
+    BOOST_CHECK_THROW(read_all(truncated_reader), bg::read_wkb_exception);
+}
+
+int test_main(int, char* [])
+{
+    test_wkt();
+    test_wkb();
+
+    return 0;
+}
@@ -9,14 +9,411 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include <geometry_test_common.hpp>
 
+#include <boost/cstdint.hpp>
+#include <boost/endian/conversion.hpp>
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+#include <boost/geometry/extensions/gis/io/records/mapped_file.hpp>
+#include <boost/geometry/extensions/gis/io/shapefile/memory_stream.hpp>
 #include <boost/geometry/extensions/gis/io/shapefile/read.hpp>
 
 
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::polygon<point_type> polygon_type;
+
+
+// Minimal shapefile writer, all records are little-endian on disk
+
+void put_little(std::string& out, boost::int32_t value)
+{
+    boost::endian::native_to_little_inplace(value);
+    out.append(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+void put_little(std::string& out, double value)
+{
+    boost::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(double));
+    boost::endian::native_to_little_inplace(bits);
+    out.append(reinterpret_cast<char const*>(&bits), sizeof(bits));
+}
+
+void put_big(std::string& out, boost::int32_t value)
+{
+    for (int i = 3; i >= 0; i--)
+    {
+        out += char((boost::uint32_t(value) >> (8 * i)) & 0xFF);
+    }
+}
+
+void put_header(std::string& out, std::size_t size, boost::int32_t type)
+{
+    put_big(out, 9994);
+    for (int i = 0; i < 5; i++)
+    {
+        put_big(out, 0);
+    }
+    put_big(out, boost::int32_t(size / 2));
+    put_little(out, boost::int32_t(1000));
+    put_little(out, type);
+    for (int i = 0; i < 8; i++)
+    {
+        put_little(out, 0.0);
+    }
+}
+
+// Record contents are written as is, shp and shx get headers
+void make_files(std::vector<std::string> const& contents, boost::int32_t type,
+                std::string& shp, std::string& shx)
+{
+    std::string shp_records, shx_records;
+    for (std::size_t i = 0; i < contents.size(); i++)
+    {
+        put_big(shx_records, boost::int32_t((100 + shp_records.size()) / 2));
+        put_big(shx_records, boost::int32_t(contents[i].size() / 2));
+
+        put_big(shp_records, boost::int32_t(i + 1));
+        put_big(shp_records, boost::int32_t(contents[i].size() / 2));
+        shp_records += contents[i];
+    }
+
+    shp.clear();
+    put_header(shp, 100 + shp_records.size(), type);
+    shp += shp_records;
+
+    shx.clear();
+    put_header(shx, 100 + shx_records.size(), type);
+    shx += shx_records;
+}
+
+// Parts of all polygons, the holes of each polygon follow its exterior ring
+// or they are written after all exterior rings
+std::string polygon_content(std::vector<polygon_type> const& polygons,
+                            bool holes_last = false)
+{
+    box_type box;
+    bg::assign_inverse(box);
+    std::vector<polygon_type::ring_type> rings, holes;
+    for (std::size_t i = 0; i < polygons.size(); i++)
+    {
+        bg::expand(box, bg::return_envelope<box_type>(polygons[i]));
+        rings.push_back(bg::exterior_ring(polygons[i]));
+        (holes_last ? holes : rings).insert((holes_last ? holes : rings).end(),
+                                            bg::interior_rings(polygons[i]).begin(),
+                                            bg::interior_rings(polygons[i]).end());
+    }
+    rings.insert(rings.end(), holes.begin(), holes.end());
+
+    std::size_t num_points = 0;
+    for (std::size_t i = 0; i < rings.size(); i++)
+    {
+        num_points += rings[i].size();
+    }
+
+    std::string out;
+    put_little(out, boost::int32_t(5));
+    put_little(out, bg::get<bg::min_corner, 0>(box));
+    put_little(out, bg::get<bg::min_corner, 1>(box));
+    put_little(out, bg::get<bg::max_corner, 0>(box));
+    put_little(out, bg::get<bg::max_corner, 1>(box));
+    put_little(out, boost::int32_t(rings.size()));
+    put_little(out, boost::int32_t(num_points));
+    boost::int32_t first = 0;
+    for (std::size_t i = 0; i < rings.size(); i++)
+    {
+        put_little(out, first);
+        first += boost::int32_t(rings[i].size());
+    }
+    for (std::size_t i = 0; i < rings.size(); i++)
+    {
+        // Holes are counter-clockwise in shapefiles and in the polygons
+        for (std::size_t j = 0; j < rings[i].size(); j++)
+        {
+            put_little(out, bg::get<0>(rings[i][j]));
+            put_little(out, bg::get<1>(rings[i][j]));
+        }
+    }
+    return out;
+}
+
+std::string polygon_content(polygon_type const& polygon)
+{
+    return polygon_content(std::vector<polygon_type>(1, polygon));
+}
+
+std::string point_content(point_type const& point)
+{
+    std::string out;
+    put_little(out, boost::int32_t(1));
+    put_little(out, bg::get<0>(point));
+    put_little(out, bg::get<1>(point));
+    return out;
+}
+
+std::string null_content()
+{
+    std::string out;
+    put_little(out, boost::int32_t(0));
+    return out;
+}
+
+polygon_type make_polygon(int i)
+{
+    double const x = (i % 10) * 10.0;
+    double const y = (i / 10) * 10.0;
+    std::ostringstream out;
+    out << "POLYGON((" << x << " " << y << "," << x << " " << y + 5 << ","
+        << x + 5 << " " << y + 5 << "," << x + 5 << " " << y << ","
+        << x << " " << y << ")";
+    if (i % 3 == 0)
+    {
+        out << ",(" << x + 1 << " " << y + 1 << "," << x + 2 << " " << y + 1 << ","
+            << x + 2 << " " << y + 2 << "," << x + 1 << " " << y + 1 << ")";
+    }
+    out << ")";
+
+    polygon_type result;
+    bg::read_wkt(out.str(), result);
+    return result;
+}
+
+template <typename Geometries>
+std::vector<std::string> to_wkts(Geometries const& geometries)
+{
+    std::vector<std::string> result;
+    for (std::size_t i = 0; i < geometries.size(); i++)
+    {
+        std::string wkt;
+        bg::write_wkt(geometries[i], wkt);
+        result.push_back(wkt);
+    }
+    return result;
+}
+
+void test_polygons()
+{
+    std::vector<polygon_type> polygons;
+    std::vector<std::string> contents;
+    for (int i = 0; i < 100; i++)
+    {
+        polygons.push_back(make_polygon(i));
+        contents.push_back(polygon_content(polygons.back()));
+    }
+    std::string shp, shx;
+    make_files(contents, 5, shp, shx);
+
+    std::vector<std::string> const expected = to_wkts(polygons);
+
+    // Sequentially, from std::istream and from memory
+    {
+        std::istringstream is(shp);
+        std::vector<polygon_type> detected;
+        bg::read_shapefile(is, detected);
+        BOOST_CHECK(to_wkts(detected) == expected);
+    }
+    {
+        bg::memory_stream is(shp.data(), shp.data() + shp.size());
+        std::vector<polygon_type> detected;
+        bg::read_shapefile(is, detected);
+        BOOST_CHECK(to_wkts(detected) == expected);
+    }
+
+    std::istringstream shx_stream(shx);
+    bg::shapefile_index const index(shx_stream);
+    BOOST_CHECK_EQUAL(index.size(), polygons.size());
+    BOOST_CHECK_EQUAL(index.offset(0), 100u);
+
+    // Random access, backwards
+    {
+        std::istringstream is(shp);
+        std::vector<polygon_type> detected;
+        for (std::size_t i = index.size(); i > 0; i--)
+        {
+            bg::read_shapefile_record(is, index, i - 1, detected);
+        }
+        std::vector<std::string> const wkts = to_wkts(detected);
+        BOOST_CHECK(std::vector<std::string>(wkts.rbegin(), wkts.rend()) == expected);
+
+        BOOST_CHECK_THROW(bg::read_shapefile_record(is, index, index.size(), detected),
+                          bg::read_shapefile_exception);
+    }
+
+    // Box filter
+    box_type const boxes[] =
+    {
+        box_type(point_type(12, 12), point_type(33, 27)),
+        box_type(point_type(-10, -10), point_type(0, 0)),
+        box_type(point_type(5.5, 5.5), point_type(9.5, 9.5)),
+        box_type(point_type(-1000, -1000), point_type(1000, 1000))
+    };
+    for (std::size_t b = 0; b < sizeof(boxes) / sizeof(box_type); b++)
+    {
+        std::vector<std::string> filtered;
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            box_type envelope;
+            bg::envelope(polygons[i], envelope);
+            if (! bg::disjoint(envelope, boxes[b]))
+            {
+                filtered.push_back(expected[i]);
+            }
+        }
+
+        bg::memory_stream is(shp.data(), shp.data() + shp.size());
+        std::vector<polygon_type> detected;
+        bg::read_shapefile(is, index, detected, boxes[b]);
+        BOOST_CHECK_MESSAGE(to_wkts(detected) == filtered,
+                            "box " << b << " detected: " << detected.size()
+                            << " expected: " << filtered.size());
+    }
+
+    // Memory mapped files
+    std::string const shp_name = "shapefile_read_test.shp";
+    std::string const shx_name = "shapefile_read_test.shx";
+    {
+        std::ofstream shp_out(shp_name.c_str(), std::ios::binary);
+        shp_out << shp;
+        std::ofstream shx_out(shx_name.c_str(), std::ios::binary);
+        shx_out << shx;
+    }
+    {
+        bg::mapped_file shp_file(shp_name);
+        bg::mapped_file shx_file(shx_name);
+        BOOST_CHECK(shp_file.is_open() && shx_file.is_open());
+
+        bg::memory_stream shx_is(shx_file.begin(), shx_file.end());
+        bg::shapefile_index const file_index(shx_is);
+        BOOST_CHECK_EQUAL(file_index.size(), polygons.size());
+
+        bg::memory_stream shp_is(shp_file.begin(), shp_file.end());
+        std::vector<polygon_type> detected;
+        bg::read_shapefile(shp_is, file_index, detected, boxes[0]);
+        BOOST_CHECK_EQUAL(detected.size(), 6u);
+    }
+    std::remove(shp_name.c_str());
+    std::remove(shx_name.c_str());
+
+    // Truncated file
+    {
+        std::string const truncated = shp.substr(0, shp.size() / 2);
+        bg::memory_stream is(truncated.data(), truncated.data() + truncated.size());
+        std::vector<polygon_type> detected;
+        BOOST_CHECK_THROW(bg::read_shapefile(is, index, detected, boxes[3]),
+                          bg::read_shapefile_exception);
+    }
+}
+
+void test_points()
+{
+    std::vector<point_type> points;
+    std::vector<std::string> contents;
+    for (int i = 0; i < 20; i++)
+    {
+        points.push_back(point_type(i, i * 2));
+        contents.push_back(point_content(points.back()));
+        if (i % 5 == 0)
+        {
+            contents.push_back(null_content());
+        }
+    }
+    std::string shp, shx;
+    make_files(contents, 1, shp, shx);
+
+    bg::memory_stream shx_is(shx.data(), shx.data() + shx.size());
+    bg::shapefile_index const index(shx_is);
+    BOOST_CHECK_EQUAL(index.size(), contents.size());
+
+    // Null shapes are skipped by the filter
+    bg::memory_stream is(shp.data(), shp.data() + shp.size());
+    std::vector<point_type> detected;
+    bg::read_shapefile(is, index, detected,
+                       box_type(point_type(3, 0), point_type(7.5, 100)));
+    BOOST_CHECK_EQUAL(detected.size(), 5u);
+    BOOST_CHECK(bg::equals(detected.front(), points[3]));
+    BOOST_CHECK(bg::equals(detected.back(), points[7]));
+
+    // All points of filtered records in one multi point
+    std::vector<bg::model::multi_point<point_type> > multi_points;
+    bg::read_shapefile(is, index, multi_points,
+                       box_type(point_type(0, 0), point_type(1, 2)));
+    BOOST_CHECK_EQUAL(multi_points.size(), 1u);
+    BOOST_CHECK_EQUAL(multi_points.front().size(), 2u);
+
+    std::vector<point_type> record;
+    bg::read_shapefile_record(is, index, 2, record);
+    BOOST_CHECK_EQUAL(record.size(), 1u);
+    BOOST_CHECK(bg::equals(record.front(), points[1]));
+}
+
+// Records with many parts, holes are assigned to their polygons
+void test_many_parts()
+{
+    std::vector<polygon_type> polygons;
+    for (int i = 0; i < 400; i++)
+    {
+        polygons.push_back(make_polygon(i));
+    }
+    // Nested polygon in the hole of the first one
+    bg::model::multi_polygon<polygon_type> nested;
+    bg::read_wkt("MULTIPOLYGON(((200 0,200 5,205 5,205 0,200 0),"
+                 "(201 1,204 1,204 4,201 4,201 1)),"
+                 "((202 2,202 3,203 3,203 2,202 2)))", nested);
+    polygons.insert(polygons.begin(), nested.begin(), nested.end());
+
+    std::vector<std::string> contents;
+    contents.push_back(polygon_content(polygons));
+    contents.push_back(polygon_content(polygons, true));
+    std::string shp, shx;
+    make_files(contents, 5, shp, shx);
+
+    std::vector<std::string> const expected = to_wkts(polygons);
+
+    std::istringstream is(shp);
+    std::vector<bg::model::multi_polygon<polygon_type> > detected;
+    bg::read_shapefile(is, detected);
+    BOOST_CHECK_EQUAL(detected.size(), 2u);
+    for (std::size_t i = 0; i < detected.size(); i++)
+    {
+        BOOST_CHECK(to_wkts(detected[i]) == expected);
+    }
+
+    // Hole without polygon
+    polygon_type hole;
+    bg::read_wkt("POLYGON((1000 1000,1000 1005,1005 1005,1005 1000,1000 1000),"
+                 "(2000 2000,2001 2000,2001 2001,2000 2000))", hole);
+    polygons.push_back(hole);
+    contents.assign(1, polygon_content(polygons));
+    make_files(contents, 5, shp, shx);
+    std::istringstream invalid(shp);
+    detected.clear();
+    BOOST_CHECK_THROW(bg::read_shapefile(invalid, detected),
+                      bg::read_shapefile_exception);
+}
+
 int test_main(int, char*[])
 {
     bg::detail::shapefile::double_endianness_check();
 
+    test_polygons();
+    test_points();
+    test_many_parts();
+
     return 0;
 }
@@ -0,0 +1,175 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/geometries/multi_point.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/extensions/triangulation/algorithms/delaunay_triangulation.hpp>
+
+template <typename Triangulation, typename MultiPoint>
+void check_triangulation(Triangulation const& tri, MultiPoint const& mp,
+                         std::string const& caseid)
+{
+    typedef typename Triangulation::point_type point_type;
+    typedef typename Triangulation::index_type index_type;
+    typedef bg::strategy::side::side_robust<> side;
+    typedef bg::strategy::in_circle::in_circle_robust<> in_circle;
+
+    std::set<std::pair<double, double> > distinct;
+    for (std::size_t i = 0; i < mp.size(); ++i)
+    {
+        distinct.insert(std::make_pair(bg::get<0>(mp[i]), bg::get<1>(mp[i])));
+    }
+
+    std::size_t ccw = 0, symmetric = 0, locally_delaunay = 0, boundary = 0;
+    double area = 0;
+    for (index_type e = 0; e < tri.half_edges_count(); ++e)
+    {
+        point_type const& a = tri.point(tri.vertex(e));
+        point_type const& b = tri.point(tri.vertex(Triangulation::next(e)));
+        point_type const& c = tri.point(tri.vertex(Triangulation::prev(e)));
+        if (e % 3 == 0)
+        {
+            ccw += side::apply(a, b, c) > 0 ? 1 : 0;
+            area += 0.5 * ((bg::get<0>(b) - bg::get<0>(a)) * (bg::get<1>(c) - bg::get<1>(a))
+                         - (bg::get<0>(c) - bg::get<0>(a)) * (bg::get<1>(b) - bg::get<1>(a)));
+        }
+        index_type const o = tri.opposite(e);
+        if (o == Triangulation::invalid_index)
+        {
+            boundary++;
+            symmetric++;
+            locally_delaunay++;
+            continue;
+        }
+        if (tri.opposite(o) == e
+            && tri.vertex(o) == tri.vertex(Triangulation::next(e))
+            && tri.vertex(Triangulation::next(o)) == tri.vertex(e))
+        {
+            symmetric++;
+        }
+        point_type const& d = tri.point(tri.vertex(Triangulation::prev(o)));
+        if (in_circle::apply(a, b, c, d) <= 0)
+        {
+            locally_delaunay++;
+        }
+    }
+
+    BOOST_CHECK_MESSAGE(ccw == tri.triangles_count(),
+        caseid << " not all triangles are counterclockwise");
+    BOOST_CHECK_MESSAGE(symmetric == tri.half_edges_count(),
+        caseid << " opposite half-edges are inconsistent");
+    BOOST_CHECK_MESSAGE(locally_delaunay == tri.half_edges_count(),
+        caseid << " triangulation is not Delaunay");
+
+    // Euler: a triangulation of n points with b points on the boundary has
+    // 2n - 2 - b triangles
+    BOOST_CHECK_MESSAGE(
+        tri.triangles_count() + 2 + boundary == 2 * distinct.size(),
+        caseid << " triangles: " << tri.triangles_count()
+        << " boundary: " << boundary << " points: " << distinct.size());
+
+    bg::model::polygon<point_type> hull;
+    bg::convex_hull(mp, hull);
+    BOOST_CHECK_CLOSE(area, bg::area(hull), 1e-6);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::multi_point<P> mp_type;
+    typedef bg::model::triangulation<P> tri_type;
+
+    {
+        mp_type mp;
+        bg::read_wkt("MULTIPOINT(0 0, 1 0, 0 1)", mp);
+        tri_type tri;
+        bg::delaunay_triangulation(mp, tri);
+        BOOST_CHECK_EQUAL(tri.triangles_count(), 1u);
+        BOOST_CHECK_EQUAL(tri.points().size(), 3u);
+    }
+    {
+        // Collinear, duplicates and too few points give no triangles
+        char const* wkts[] = { "MULTIPOINT(0 0, 1 1, 2 2, 3 3)",
+                               "MULTIPOINT(1 1, 1 1, 1 1)",
+                               "MULTIPOINT(0 0, 1 1)",
+                               "MULTIPOINT()" };
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            mp_type mp;
+            bg::read_wkt(wkts[i], mp);
+            tri_type tri;
+            bg::delaunay_triangulation(mp, tri);
+            BOOST_CHECK_MESSAGE(tri.empty(), wkts[i]);
+        }
+    }
+    {
+        mp_type mp;
+        bg::read_wkt("MULTIPOINT(0 0, 4 0, 4 4, 0 4, 2 2, 2 2, 2 0, 0 0, 1 3)", mp);
+        tri_type tri;
+        bg::delaunay_triangulation(mp, tri);
+        check_triangulation(tri, mp, "small");
+    }
+
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<double> random(-1000.0, 1000.0);
+    {
+        mp_type mp;
+        for (std::size_t i = 0; i < 50000; ++i)
+        {
+            mp.push_back(P(random(generator), random(generator)));
+        }
+        tri_type tri;
+        bg::delaunay_triangulation(mp, tri);
+        check_triangulation(tri, mp, "random");
+    }
+    {
+        // Many cocircular and collinear points
+        mp_type mp;
+        for (int x = 0; x < 100; ++x)
+        {
+            for (int y = 0; y < 100; ++y)
+            {
+                mp.push_back(P(x, y));
+            }
+        }
+        tri_type tri;
+        bg::delaunay_triangulation(mp, tri);
+        check_triangulation(tri, mp, "grid");
+    }
+    {
+        // Points on a line first, then others
+        mp_type mp;
+        for (int i = 0; i < 1000; ++i)
+        {
+            mp.push_back(P(i, 2 * i));
+        }
+        for (int i = 0; i < 1000; ++i)
+        {
+            mp.push_back(P(random(generator), random(generator)));
+        }
+        tri_type tri;
+        bg::delaunay_triangulation(mp, tri);
+        check_triangulation(tri, mp, "line");
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
@@ -12,6 +12,10 @@
 
 #include <geometry_test_common.hpp>
 
+#include <iterator>
+#include <random>
+#include <vector>
+
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/extensions/triangulation/strategies/cartesian/in_circle_robust.hpp>
 
@@ -51,9 +55,62 @@ void test_all()
     BOOST_CHECK_GT(hardr, 0);
 }
 
+template <typename P>
+void test_batch()
+{
+    typedef bg::strategy::in_circle::in_circle_robust<double, 2> inc2;
+
+    // Random tuples mixed with cocircular ones, which fail the filter
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<double> random(-1.0, 1.0);
+    std::vector<P> p1, p2, p3, p4;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        if (i % 3 == 0)
+        {
+            double const x = std::floor(random(generator) * 100);
+            double const y = std::floor(random(generator) * 100);
+            p1.push_back(P(x, y));
+            p2.push_back(P(x + 1, y));
+            p3.push_back(P(x + 1, y + 1));
+            p4.push_back(P(x, y + 1));
+        }
+        else
+        {
+            p1.push_back(P(random(generator), random(generator)));
+            p2.push_back(P(random(generator), random(generator)));
+            p3.push_back(P(random(generator), random(generator)));
+            p4.push_back(P(random(generator), random(generator)));
+        }
+    }
+
+    std::vector<int> batch;
+    inc2::apply_batch(p1.begin(), p1.end(), p2.begin(), p3.begin(),
+                      p4.begin(), std::back_inserter(batch));
+    BOOST_CHECK_EQUAL(batch.size(), p1.size());
+    std::size_t equal = 0;
+    for (std::size_t i = 0; i < p1.size(); ++i)
+    {
+        equal += batch[i] == inc2::apply(p1[i], p2[i], p3[i], p4[i]) ? 1 : 0;
+    }
+    BOOST_CHECK_EQUAL(equal, p1.size());
+    BOOST_CHECK_EQUAL(batch[0], 0);
+
+    batch.clear();
+    inc2::apply_batch(p1[0], p2[0], p3[0], p4, std::back_inserter(batch));
+    BOOST_CHECK_EQUAL(batch.size(), p4.size());
+    equal = 0;
+    for (std::size_t i = 0; i < p4.size(); ++i)
+    {
+        equal += batch[i] == inc2::apply(p1[0], p2[0], p3[0], p4[i]) ? 1 : 0;
+    }
+    BOOST_CHECK_EQUAL(equal, p4.size());
+}
+
 
 int test_main(int, char* [])
 {
     test_all<bg::model::d2::point_xy<double> >();
+    test_batch<bg::model::d2::point_xy<double> >();
     return 0;
 }
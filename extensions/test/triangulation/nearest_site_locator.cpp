@@ -0,0 +1,118 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <random>
+#include <string>
+
+#include <boost/geometry/geometries/multi_point.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/extensions/triangulation/algorithms/nearest_site_locator.hpp>
+
+template <typename MultiPoint, typename Point>
+double brute_force_distance(MultiPoint const& mp, Point const& p)
+{
+    double result = -1;
+    for (std::size_t i = 0; i < mp.size(); ++i)
+    {
+        double const d = bg::detail::nearest_site::squared_distance(mp[i], p);
+        if (result < 0 || d < result)
+        {
+            result = d;
+        }
+    }
+    return result;
+}
+
+template <typename Locator, typename MultiPoint, typename Generator>
+void check_queries(Locator const& locator, MultiPoint const& mp,
+                   Generator& generator, double min_value, double max_value,
+                   std::string const& caseid)
+{
+    typedef typename bg::point_type<MultiPoint>::type point_type;
+
+    std::uniform_real_distribution<double> random(min_value, max_value);
+    std::size_t correct = 0, correct_hinted = 0;
+    std::size_t const count = 2000;
+    typename Locator::index_type hint = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        point_type const p(random(generator), random(generator));
+        double const expected = brute_force_distance(mp, p);
+
+        typename Locator::index_type const n = locator.nearest(p);
+        if (bg::detail::nearest_site::squared_distance(mp[n], p) == expected)
+        {
+            correct++;
+        }
+        hint = locator.nearest(p, hint);
+        if (bg::detail::nearest_site::squared_distance(mp[hint], p) == expected)
+        {
+            correct_hinted++;
+        }
+    }
+    BOOST_CHECK_MESSAGE(correct == count, caseid << " wrong nearest sites");
+    BOOST_CHECK_MESSAGE(correct_hinted == count,
+                        caseid << " wrong nearest sites with hint");
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::multi_point<P> mp_type;
+    typedef bg::nearest_site_locator<P> locator_type;
+
+    std::mt19937 generator(12345);
+    {
+        mp_type mp;
+        locator_type const locator(mp);
+        BOOST_CHECK(locator.nearest(P(0, 0)) == locator_type::invalid_index);
+    }
+    {
+        mp_type mp;
+        bg::read_wkt("MULTIPOINT(0 0, 10 10, 20 20)", mp);
+        locator_type const locator(mp);
+        BOOST_CHECK_EQUAL(locator.nearest(P(12, 9)), 1u);
+        check_queries(locator, mp, generator, -50, 50, "collinear");
+    }
+    {
+        std::uniform_real_distribution<double> random(0.0, 100.0);
+        mp_type mp;
+        for (std::size_t i = 0; i < 20000; ++i)
+        {
+            mp.push_back(P(random(generator), random(generator)));
+        }
+        locator_type const locator(mp);
+        // Including queries outside the hull of the sites
+        check_queries(locator, mp, generator, -20, 120, "random");
+    }
+    {
+        mp_type mp;
+        for (int x = 0; x < 50; ++x)
+        {
+            for (int y = 0; y < 50; ++y)
+            {
+                mp.push_back(P(x, y));
+            }
+        }
+        locator_type const locator(mp);
+        check_queries(locator, mp, generator, -5, 55, "grid");
+
+        // Hints which are not site indices are ignored
+        BOOST_CHECK_EQUAL(locator.nearest(P(12.1, 7.9), 2500u), 12u * 50u + 8u);
+        BOOST_CHECK_EQUAL(locator.nearest(P(12.1, 7.9), locator_type::invalid_index),
+                          12u * 50u + 8u);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
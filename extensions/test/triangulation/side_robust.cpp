@@ -12,7 +12,22 @@
 
 #include <geometry_test_common.hpp>
 
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/difference.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
 #include <boost/geometry/extensions/triangulation/strategies/cartesian/side_robust.hpp>
 
 template <typename P>
@@ -54,9 +69,140 @@ void test_all()
     BOOST_CHECK_GT(hard3r, 0);
 }
 
+template <typename P>
+void test_batch()
+{
+    typedef bg::strategy::side::side_robust<double, 3> side3;
+
+    // Random tuples mixed with (nearly) collinear ones, which fail the filter
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<double> random(-1.0, 1.0);
+    std::vector<P> p1, p2, p3;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        P const a(random(generator), random(generator));
+        P const b(random(generator), random(generator));
+        p1.push_back(a);
+        p2.push_back(b);
+        if (i % 3 == 0)
+        {
+            double const t = random(generator);
+            p3.push_back(P(bg::get<0>(a) + t * (bg::get<0>(b) - bg::get<0>(a)),
+                           bg::get<1>(a) + t * (bg::get<1>(b) - bg::get<1>(a))));
+        }
+        else
+        {
+            p3.push_back(P(random(generator), random(generator)));
+        }
+    }
+    p1.push_back(P(1.0e-20, 1.0e-20));
+    p2.push_back(P(1.0e20, 1.0e20));
+    p3.push_back(P(1.0, 2.0));
+
+    std::vector<int> batch;
+    side3::apply_batch(p1.begin(), p1.end(), p2.begin(), p3.begin(),
+                       std::back_inserter(batch));
+    BOOST_CHECK_EQUAL(batch.size(), p1.size());
+    std::size_t equal = 0;
+    for (std::size_t i = 0; i < p1.size(); ++i)
+    {
+        equal += batch[i] == side3::apply(p1[i], p2[i], p3[i]) ? 1 : 0;
+    }
+    BOOST_CHECK_EQUAL(equal, p1.size());
+    BOOST_CHECK_GT(batch.back(), 0);
+
+    batch.clear();
+    side3::apply_batch(p1[0], p2[0], p3, std::back_inserter(batch));
+    BOOST_CHECK_EQUAL(batch.size(), p3.size());
+    equal = 0;
+    for (std::size_t i = 0; i < p3.size(); ++i)
+    {
+        equal += batch[i] == side3::apply(p1[0], p2[0], p3[i]) ? 1 : 0;
+    }
+    BOOST_CHECK_EQUAL(equal, p3.size());
+}
+
+
+template <typename P>
+void test_overlay()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::strategy::intersection::cartesian_segments
+        <
+            void, bg::strategy::side::side_robust<>
+        > robust_strategy;
+    typedef bg::strategy::intersection::cartesian_segments
+        <
+            void, bg::strategy::side::side_robust<void, 2>
+        > fast_strategy;
+
+    BOOST_CHECK((boost::is_same
+        <
+            typename bg::rescale_overlay_policy_type_for_strategy
+                <
+                    polygon, polygon, robust_strategy
+                >::type,
+            bg::detail::no_rescale_policy
+        >::value));
+    BOOST_CHECK((boost::is_same
+        <
+            typename bg::rescale_overlay_policy_type_for_strategy
+                <
+                    polygon, polygon, fast_strategy
+                >::type,
+            typename bg::rescale_overlay_policy_type<polygon, polygon>::type
+        >::value));
+
+    char const* cases[][3] = {
+        { "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+          "POLYGON((5 5,5 15,15 15,15 5,5 5))",
+          "212101212" },
+        { "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))",
+          "POLYGON((1 1,1 9,9 9,9 1,1 1))",
+          "2121F12F2" },
+        // Nearly collinear edges, the interiors overlap in a sliver of
+        // area 5e-5
+        { "POLYGON((0 0,0 1,1e6 1.0000000001,1e6 0,0 0))",
+          "POLYGON((0 1,0 2,1e6 2,1e6 1,0 1))",
+          "212111212" },
+        { "POLYGON((0 0,0.1 1,0.2 0,0 0))",
+          "POLYGON((0.1 0,0.1 0.3,0.30000000000000004 0.1,0.1 0))",
+          "212101212" }
+    };
+
+    robust_strategy strategy;
+    for (std::size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+    {
+        polygon a, b;
+        bg::read_wkt(cases[i][0], a);
+        bg::read_wkt(cases[i][1], b);
+
+        multi_polygon intersection, union_, difference;
+        bg::intersection(a, b, intersection, strategy);
+        bg::union_(a, b, union_, strategy);
+        bg::difference(a, b, difference, strategy);
+
+        double const area_a = bg::area(a);
+        double const area_b = bg::area(b);
+        double const tolerance = 1e-9 * (area_a + area_b);
+        BOOST_CHECK_MESSAGE(
+            std::abs(bg::area(union_) + bg::area(intersection)
+                     - area_a - area_b) <= tolerance,
+            "union and intersection of case " << i << " do not add up");
+        BOOST_CHECK_MESSAGE(
+            std::abs(bg::area(difference) + bg::area(intersection)
+                     - area_a) <= tolerance,
+            "difference and intersection of case " << i << " do not add up");
+
+        BOOST_CHECK_EQUAL(bg::relation(a, b, strategy).str(), cases[i][2]);
+    }
+}
 
 int test_main(int, char* [])
 {
     test_all<bg::model::d2::point_xy<double> >();
+    test_batch<bg::model::d2::point_xy<double> >();
+    test_overlay<bg::model::d2::point_xy<double> >();
     return 0;
 }
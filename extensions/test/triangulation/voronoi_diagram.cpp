@@ -0,0 +1,123 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <random>
+#include <string>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/multi_point.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/extensions/triangulation/algorithms/voronoi_diagram.hpp>
+
+template <typename MultiPolygon, typename MultiPoint, typename Box>
+void check_cells(MultiPolygon const& cells, MultiPoint const& sites,
+                 Box const& box, std::size_t expected_empty,
+                 std::string const& caseid)
+{
+    BOOST_CHECK_EQUAL(cells.size(), sites.size());
+
+    std::size_t empty = 0, valid = 0, covered = 0;
+    double area = 0;
+    for (std::size_t i = 0; i < cells.size(); ++i)
+    {
+        if (cells[i].outer().empty())
+        {
+            empty++;
+            continue;
+        }
+        area += bg::area(cells[i]);
+        valid += bg::is_valid(cells[i]) ? 1 : 0;
+        covered += bg::covered_by(sites[i], cells[i]) ? 1 : 0;
+    }
+    std::size_t const filled = cells.size() - empty;
+
+    BOOST_CHECK_MESSAGE(empty == expected_empty,
+        caseid << " empty cells: " << empty << " expected: " << expected_empty);
+    BOOST_CHECK_MESSAGE(valid == filled, caseid << " invalid cells");
+    BOOST_CHECK_MESSAGE(covered == filled, caseid << " sites outside cells");
+    BOOST_CHECK_CLOSE(area, bg::area(box), 1e-6);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::multi_point<P> mp_type;
+    typedef bg::model::multi_polygon<bg::model::polygon<P> > mpoly_type;
+    typedef bg::model::box<P> box_type;
+
+    box_type const box(P(-10, -10), P(110, 110));
+    {
+        mp_type mp;
+        bg::read_wkt("MULTIPOINT(0 0, 100 0, 100 100, 0 100)", mp);
+        mpoly_type cells;
+        bg::voronoi_diagram(mp, box, cells);
+        check_cells(cells, mp, box, 0, "square");
+        BOOST_CHECK_CLOSE(bg::area(cells[0]), 60.0 * 60.0, 1e-6);
+    }
+    {
+        // Collinear sites and a duplicate
+        mp_type mp;
+        bg::read_wkt("MULTIPOINT(0 0, 50 50, 100 100, 50 50)", mp);
+        mpoly_type cells;
+        bg::voronoi_diagram(mp, box, cells);
+        check_cells(cells, mp, box, 1, "collinear");
+    }
+    {
+        // Grid with many cocircular points, and a duplicate
+        mp_type mp;
+        for (int x = 0; x <= 100; x += 10)
+        {
+            for (int y = 0; y <= 100; y += 10)
+            {
+                mp.push_back(P(x, y));
+            }
+        }
+        mp.push_back(P(50, 50));
+        mpoly_type cells;
+        bg::voronoi_diagram(mp, box, cells);
+        check_cells(cells, mp, box, 1, "grid");
+    }
+    {
+        std::mt19937 generator(12345);
+        std::uniform_real_distribution<double> random(0.0, 100.0);
+        mp_type mp;
+        for (std::size_t i = 0; i < 10000; ++i)
+        {
+            mp.push_back(P(random(generator), random(generator)));
+        }
+
+        bg::model::triangulation<P> tri;
+        bg::delaunay_triangulation(mp, tri);
+        mpoly_type cells;
+        bg::voronoi_diagram(tri, box, cells);
+        check_cells(cells, mp, box, 0, "random");
+
+        // A clip box smaller than the extent of the sites
+        box_type const small(P(25, 25), P(75, 75));
+        bg::voronoi_diagram(tri, small, cells);
+        double area = 0;
+        for (std::size_t i = 0; i < cells.size(); ++i)
+        {
+            area += bg::area(cells[i]);
+        }
+        BOOST_CHECK_CLOSE(area, bg::area(small), 1e-6);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
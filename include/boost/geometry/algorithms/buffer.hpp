@@ -39,6 +39,7 @@
 
 #include <boost/geometry/algorithms/detail/buffer/buffer_box.hpp>
 #include <boost/geometry/algorithms/detail/buffer/buffer_inserter.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_parallel.hpp>
 
 namespace boost { namespace geometry
 {
@@ -262,6 +263,94 @@ inline void buffer(GeometryIn const& geometry_in,
 }
 
 
+/*!
+\brief \brief_calc{buffer}
+\ingroup buffer
+\details \details_calc{buffer, \det_buffer}.
+    Components of a multi geometry whose buffers cannot interact, because
+    their envelopes inflated by the maximal buffer distance are disjoint,
+    are buffered independently, using the specified number of threads.
+    Interacting components are buffered together. Very long linestrings are
+    buffered in overlapping chunks which are merged afterwards. The result
+    covers the same area as the result of the overload without the number
+    of threads.
+\tparam GeometryIn \tparam_geometry
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\tparam DistanceStrategy A strategy defining distance (or radius)
+\tparam SideStrategy A strategy defining creation along sides
+\tparam JoinStrategy A strategy defining creation around convex corners
+\tparam EndStrategy A strategy defining creation at linestring ends
+\tparam PointStrategy A strategy defining creation around points
+\param geometry_in \param_geometry
+\param geometry_out output multi polygon (or std:: collection of polygons),
+    will contain a buffered version of the input geometry
+\param distance_strategy The distance strategy to be used
+\param side_strategy The side strategy to be used
+\param join_strategy The join strategy to be used
+\param end_strategy The end strategy to be used
+\param point_strategy The point strategy to be used
+\param threads The number of threads to be used, 0 means as many as the
+    hardware supports
+
+\qbk{distinguish,with strategies and number of threads}
+ */
+template
+<
+    typename GeometryIn,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+inline void buffer(GeometryIn const& geometry_in,
+                MultiPolygon& geometry_out,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy,
+                std::size_t threads)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    concepts::check<GeometryIn const>();
+    concepts::check<polygon_type>();
+
+    typedef typename point_type<GeometryIn>::type point_type;
+    typedef typename rescale_policy_type
+        <
+            point_type,
+            typename geometry::cs_tag<point_type>::type
+        >::type rescale_policy_type;
+
+    geometry_out.clear();
+
+    if (geometry::is_empty(geometry_in))
+    {
+        // Then output geometry is kept empty as well
+        return;
+    }
+
+    typename strategy::intersection::services::default_strategy
+        <
+            typename cs_tag<GeometryIn>::type
+        >::type intersection_strategy;
+
+    detail::buffer::buffer_inserter_parallel
+        <
+            polygon_type, rescale_policy_type
+        >(geometry_in, range::back_inserter(geometry_out),
+                distance_strategy,
+                side_strategy,
+                join_strategy,
+                end_strategy,
+                point_strategy,
+                intersection_strategy,
+                threads);
+}
+
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_BUFFER_HPP
@@ -0,0 +1,356 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_CHUNKED_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_CHUNKED_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/algorithms/detail/buffer/buffer_box.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_inserter.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/detail/parallel.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/cartesian/buffer_end_flat.hpp>
+#include <boost/geometry/strategies/cartesian/point_in_point.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+
+// Buffers one (multi) geometry into one piece collection, with a rescale
+// policy based on its own inflated envelope
+template
+<
+    typename GeometryOutput,
+    typename RescalePolicy,
+    typename GeometryInput,
+    typename OutputIterator,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy,
+    typename IntersectionStrategy
+>
+inline void buffer_group(GeometryInput const& geometry_input,
+        OutputIterator out,
+        DistanceStrategy const& distance_strategy,
+        SideStrategy const& side_strategy,
+        JoinStrategy const& join_strategy,
+        EndStrategy const& end_strategy,
+        PointStrategy const& point_strategy,
+        IntersectionStrategy const& intersection_strategy)
+{
+    typedef typename point_type<GeometryInput>::type point_type;
+
+    model::box<point_type> box;
+    geometry::envelope(geometry_input, box);
+    buffer_box(box,
+            distance_strategy.max_distance(join_strategy, end_strategy), box);
+
+    RescalePolicy const rescale_policy
+            = geometry::get_rescale_policy<RescalePolicy>(
+                box, intersection_strategy);
+
+    buffer_inserter<GeometryOutput>(geometry_input, out,
+                distance_strategy,
+                side_strategy,
+                join_strategy,
+                end_strategy,
+                point_strategy,
+                intersection_strategy,
+                rescale_policy);
+}
+
+
+// Linestrings with more segments than twice this number are buffered in
+// chunks of this number of segments
+static std::size_t const buffer_chunk_segment_count = 1024;
+
+
+/*!
+\brief End strategy for a chunk of a linestring. At ends of the chunk which
+    are ends of the linestring, it uses the specified end strategy. At the
+    other ends it creates flat ends, such that the buffer of the chunk does
+    not extend beyond the buffer of the complete linestring.
+\details The linestring buffer generates the end at the last point of the
+    chunk while walking its left side, and the end at its first point while
+    walking its right side. The side tells which end is generated, such that
+    a real end coinciding with the cut at the other end of the chunk (a
+    looping linestring) still gets the specified end. Points are compared
+    only to distinguish ends from spikes, which get the specified end too.
+    The piece type depends on the last generated end. The end at the last
+    point is generated first, so initially it is the type of the first end.
+*/
+template <typename EndStrategy, typename Point>
+class chunk_end
+{
+public :
+    chunk_end(EndStrategy const& end_strategy,
+              Point const& first, Point const& last,
+              bool first_is_end, bool last_is_end)
+        : m_end_strategy(end_strategy)
+        , m_first(first)
+        , m_last(last)
+        , m_first_is_end(first_is_end)
+        , m_last_is_end(last_is_end)
+        , m_piece_type(first_is_end
+                       ? end_strategy.get_piece_type()
+                       : strategy::buffer::buffered_flat_end)
+    {}
+
+    template <typename OutputPoint, typename RangeOut, typename DistanceStrategy>
+    inline void apply(OutputPoint const& penultimate_point,
+                OutputPoint const& perp_left_point,
+                OutputPoint const& ultimate_point,
+                OutputPoint const& perp_right_point,
+                strategy::buffer::buffer_side_selector side,
+                DistanceStrategy const& distance,
+                RangeOut& range_out) const
+    {
+        if (is_cut(ultimate_point, side))
+        {
+            strategy::buffer::end_flat().apply(penultimate_point,
+                    perp_left_point, ultimate_point, perp_right_point,
+                    side, distance, range_out);
+            m_piece_type = strategy::buffer::buffered_flat_end;
+        }
+        else
+        {
+            m_end_strategy.apply(penultimate_point,
+                    perp_left_point, ultimate_point, perp_right_point,
+                    side, distance, range_out);
+            m_piece_type = m_end_strategy.get_piece_type();
+        }
+    }
+
+    template <typename NumericType>
+    inline NumericType max_distance(NumericType const& distance) const
+    {
+        return (std::max)(m_end_strategy.max_distance(distance),
+                          strategy::buffer::end_flat::max_distance(distance));
+    }
+
+    inline strategy::buffer::piece_type get_piece_type() const
+    {
+        return m_piece_type;
+    }
+
+private :
+    template <typename OutputPoint>
+    inline bool is_cut(OutputPoint const& point,
+                       strategy::buffer::buffer_side_selector side) const
+    {
+        strategy::within::cartesian_point_point const strategy;
+        return side == strategy::buffer::buffer_side_left
+            ? ! m_last_is_end
+                && detail::equals::equals_point_point(point, m_last, strategy)
+            : ! m_first_is_end
+                && detail::equals::equals_point_point(point, m_first, strategy);
+    }
+
+    EndStrategy const& m_end_strategy;
+    Point m_first;
+    Point m_last;
+    bool m_first_is_end;
+    bool m_last_is_end;
+    mutable strategy::buffer::piece_type m_piece_type;
+};
+
+
+template
+<
+    typename GeometryOutput,
+    typename RescalePolicy,
+    typename Linestring,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy,
+    typename IntersectionStrategy
+>
+struct buffer_chunk_caller
+{
+    typedef model::multi_polygon<GeometryOutput> result_type;
+
+    buffer_chunk_caller(Linestring const& linestring,
+            std::size_t chunk_count,
+            std::vector<result_type>& results,
+            DistanceStrategy const& distance_strategy,
+            SideStrategy const& side_strategy,
+            JoinStrategy const& join_strategy,
+            EndStrategy const& end_strategy,
+            PointStrategy const& point_strategy,
+            IntersectionStrategy const& intersection_strategy)
+        : m_linestring(linestring)
+        , m_chunk_count(chunk_count)
+        , m_results(results)
+        , m_distance_strategy(distance_strategy)
+        , m_side_strategy(side_strategy)
+        , m_join_strategy(join_strategy)
+        , m_end_strategy(end_strategy)
+        , m_point_strategy(point_strategy)
+        , m_intersection_strategy(intersection_strategy)
+    {}
+
+    inline void operator()(std::size_t index) const
+    {
+        typedef typename point_type<Linestring>::type point_type;
+
+        // Chunks share their last segment with the next chunk, such that
+        // the joins at their ends are generated by one of them
+        std::size_t const size = boost::size(m_linestring);
+        std::size_t const first = index * buffer_chunk_segment_count;
+        std::size_t const last = index + 1 == m_chunk_count
+            ? size - 1
+            : first + buffer_chunk_segment_count + 1;
+
+        Linestring chunk;
+        for (std::size_t i = first; i <= last; i++)
+        {
+            range::push_back(chunk, range::at(m_linestring, i));
+        }
+
+        chunk_end<EndStrategy, point_type> const end_strategy(m_end_strategy,
+                range::front(chunk), range::back(chunk),
+                index == 0, index + 1 == m_chunk_count);
+
+        buffer_group<GeometryOutput, RescalePolicy>(chunk,
+                range::back_inserter(m_results[index]),
+                m_distance_strategy, m_side_strategy, m_join_strategy,
+                end_strategy, m_point_strategy, m_intersection_strategy);
+    }
+
+    Linestring const& m_linestring;
+    std::size_t m_chunk_count;
+    std::vector<result_type>& m_results;
+    DistanceStrategy const& m_distance_strategy;
+    SideStrategy const& m_side_strategy;
+    JoinStrategy const& m_join_strategy;
+    EndStrategy const& m_end_strategy;
+    PointStrategy const& m_point_strategy;
+    IntersectionStrategy const& m_intersection_strategy;
+};
+
+
+template <typename MultiPolygon, typename IntersectionStrategy>
+struct merge_chunk_caller
+{
+    merge_chunk_caller(std::vector<MultiPolygon>& results, std::size_t step,
+                       IntersectionStrategy const& intersection_strategy)
+        : m_results(results)
+        , m_step(step)
+        , m_intersection_strategy(intersection_strategy)
+    {}
+
+    inline void operator()(std::size_t index) const
+    {
+        std::size_t const first = index * 2 * m_step;
+        std::size_t const second = first + m_step;
+        if (second < m_results.size())
+        {
+            MultiPolygon merged;
+            geometry::union_(m_results[first], m_results[second], merged,
+                             m_intersection_strategy);
+            m_results[first].swap(merged);
+            MultiPolygon().swap(m_results[second]);
+        }
+    }
+
+    std::vector<MultiPolygon>& m_results;
+    std::size_t m_step;
+    IntersectionStrategy const& m_intersection_strategy;
+};
+
+
+/*!
+\brief Buffers a long linestring in chunks of buffer_chunk_segment_count
+    segments, using the specified number of threads. The buffers of
+    neighbouring chunks are merged pairwise, until one is left.
+    The piece collection of one chunk is the largest intermediate
+    structure, instead of that of the whole linestring.
+*/
+template
+<
+    typename GeometryOutput,
+    typename RescalePolicy,
+    typename Linestring,
+    typename OutputIterator,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy,
+    typename IntersectionStrategy
+>
+inline void buffer_chunked(Linestring const& linestring,
+        OutputIterator out,
+        DistanceStrategy const& distance_strategy,
+        SideStrategy const& side_strategy,
+        JoinStrategy const& join_strategy,
+        EndStrategy const& end_strategy,
+        PointStrategy const& point_strategy,
+        IntersectionStrategy const& intersection_strategy,
+        std::size_t threads)
+{
+    typedef model::multi_polygon<GeometryOutput> result_type;
+
+    std::size_t const segment_count = boost::size(linestring) - 1;
+    std::size_t const chunk_count = segment_count / buffer_chunk_segment_count;
+
+    std::vector<result_type> results(chunk_count);
+    geometry::detail::parallel::for_each_index(chunk_count, threads,
+        buffer_chunk_caller
+            <
+                GeometryOutput, RescalePolicy, Linestring,
+                DistanceStrategy, SideStrategy, JoinStrategy,
+                EndStrategy, PointStrategy, IntersectionStrategy
+            >(linestring, chunk_count, results,
+              distance_strategy, side_strategy, join_strategy,
+              end_strategy, point_strategy, intersection_strategy));
+
+    for (std::size_t step = 1; step < chunk_count; step *= 2)
+    {
+        std::size_t const merges = (chunk_count + 2 * step - 1) / (2 * step);
+        geometry::detail::parallel::for_each_index(merges, threads,
+            merge_chunk_caller
+                <
+                    result_type, IntersectionStrategy
+                >(results, step, intersection_strategy));
+    }
+
+    std::copy(boost::begin(results.front()), boost::end(results.front()),
+              out);
+}
+
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_CHUNKED_HPP
@@ -18,8 +18,10 @@
 
 
 #include <boost/core/ignore_unused.hpp>
+#include <boost/mpl/if.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 #include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/core/closure.hpp>
@@ -32,6 +34,7 @@
 #include <boost/geometry/strategies/buffer.hpp>
 #include <boost/geometry/strategies/side.hpp>
 #include <boost/geometry/algorithms/detail/make/make.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_multi_point.hpp>
 #include <boost/geometry/algorithms/detail/buffer/buffered_piece_collection.hpp>
 #include <boost/geometry/algorithms/detail/buffer/line_line_intersection.hpp>
 
@@ -892,20 +895,36 @@ template
     typename PolygonOutput
 >
 struct buffer_inserter<multi_tag, Multi, PolygonOutput>
-    : public detail::buffer::buffer_multi
-             <
-                Multi,
-                PolygonOutput,
-                dispatch::buffer_inserter
+    : public boost::mpl::if_c
+        <
+            // Points whose buffer is covered by others are left out
+            boost::is_same<typename tag<Multi>::type, multi_point_tag>::value,
+            detail::buffer::buffer_multi_point
+                <
+                    Multi,
+                    PolygonOutput,
+                    dispatch::buffer_inserter
+                    <
+                        point_tag,
+                        typename boost::range_value<Multi const>::type,
+                        typename geometry::ring_type<PolygonOutput>::type
+                    >
+                >,
+            detail::buffer::buffer_multi
                 <
-                    typename single_tag_of
-                                <
-                                    typename tag<Multi>::type
-                                >::type,
-                    typename boost::range_value<Multi const>::type,
-                    typename geometry::ring_type<PolygonOutput>::type
+                    Multi,
+                    PolygonOutput,
+                    dispatch::buffer_inserter
+                    <
+                        typename single_tag_of
+                                    <
+                                        typename tag<Multi>::type
+                                    >::type,
+                        typename boost::range_value<Multi const>::type,
+                        typename geometry::ring_type<PolygonOutput>::type
+                    >
                 >
-            >
+        >::type
 {};
 
 
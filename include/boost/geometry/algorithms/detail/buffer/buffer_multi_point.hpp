@@ -0,0 +1,381 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_MULTI_POINT_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_MULTI_POINT_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/strategies/buffer.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+
+/*!
+\brief Grid of square cells, used to find points of a multi point whose
+    buffer is covered by the buffers of other points
+\details A point covers a cell if the cell is inside the largest circle
+    which is inside its buffer. A point can be left out if every cell
+    intersecting the envelope of its buffer is covered by another point
+    which is kept.
+*/
+template <typename CalculationType>
+class point_buffer_grid
+{
+    typedef std::pair<std::size_t, std::size_t> cell_type;
+
+public :
+    point_buffer_grid(CalculationType const& min_x,
+                      CalculationType const& min_y,
+                      CalculationType const& cell_size,
+                      CalculationType const& inner_radius,
+                      CalculationType const& outer_extent)
+        : m_min_x(min_x)
+        , m_min_y(min_y)
+        , m_cell_size(cell_size)
+        , m_inner_radius(inner_radius)
+        , m_outer_extent(outer_extent)
+    {}
+
+    template <typename Point>
+    inline void add(Point const& point)
+    {
+        CalculationType const x = geometry::get<0>(point);
+        CalculationType const y = geometry::get<1>(point);
+        for (std::size_t i = index(x - m_inner_radius, m_min_x);
+             i <= index(x + m_inner_radius, m_min_x); i++)
+        {
+            for (std::size_t j = index(y - m_inner_radius, m_min_y);
+                 j <= index(y + m_inner_radius, m_min_y); j++)
+            {
+                if (covers(x, y, i, j))
+                {
+                    m_cells.push_back(cell_type(i, j));
+                }
+            }
+        }
+    }
+
+    //! Sorts the cells and counts the points covering each of them
+    inline void finish()
+    {
+        std::sort(m_cells.begin(), m_cells.end());
+
+        std::vector<cell_type> unique_cells;
+        for (std::size_t i = 0; i < m_cells.size(); i++)
+        {
+            if (unique_cells.empty() || unique_cells.back() != m_cells[i])
+            {
+                unique_cells.push_back(m_cells[i]);
+                m_counts.push_back(0);
+            }
+            m_counts.back()++;
+        }
+        m_cells.swap(unique_cells);
+    }
+
+    //! Removes the point if all cells around it are covered by others,
+    //! and returns true if it is removed
+    template <typename Point>
+    inline bool remove_if_covered(Point const& point)
+    {
+        CalculationType const x = geometry::get<0>(point);
+        CalculationType const y = geometry::get<1>(point);
+        std::size_t const first_i = index(x - m_outer_extent, m_min_x);
+        std::size_t const last_i = index(x + m_outer_extent, m_min_x);
+        std::size_t const first_j = index(y - m_outer_extent, m_min_y);
+        std::size_t const last_j = index(y + m_outer_extent, m_min_y);
+
+        for (std::size_t i = first_i; i <= last_i; i++)
+        {
+            for (std::size_t j = first_j; j <= last_j; j++)
+            {
+                std::size_t const cell = find(cell_type(i, j));
+                if (cell == m_cells.size()
+                    || m_counts[cell] <= (covers(x, y, i, j) ? 1u : 0u))
+                {
+                    return false;
+                }
+            }
+        }
+
+        for (std::size_t i = index(x - m_inner_radius, m_min_x);
+             i <= index(x + m_inner_radius, m_min_x); i++)
+        {
+            for (std::size_t j = index(y - m_inner_radius, m_min_y);
+                 j <= index(y + m_inner_radius, m_min_y); j++)
+            {
+                if (covers(x, y, i, j))
+                {
+                    m_counts[find(cell_type(i, j))]--;
+                }
+            }
+        }
+        return true;
+    }
+
+private :
+    inline std::size_t index(CalculationType const& c,
+                             CalculationType const& min_c) const
+    {
+        return static_cast<std::size_t>(std::floor((c - min_c) / m_cell_size));
+    }
+
+    inline bool covers(CalculationType const& x, CalculationType const& y,
+                       std::size_t i, std::size_t j) const
+    {
+        CalculationType const x0 = m_min_x + CalculationType(i) * m_cell_size;
+        CalculationType const y0 = m_min_y + CalculationType(j) * m_cell_size;
+        CalculationType const dx = (std::max)(geometry::math::abs(x0 - x),
+                geometry::math::abs(x0 + m_cell_size - x));
+        CalculationType const dy = (std::max)(geometry::math::abs(y0 - y),
+                geometry::math::abs(y0 + m_cell_size - y));
+        return dx * dx + dy * dy <= m_inner_radius * m_inner_radius;
+    }
+
+    inline std::size_t find(cell_type const& cell) const
+    {
+        typename std::vector<cell_type>::const_iterator it
+            = std::lower_bound(m_cells.begin(), m_cells.end(), cell);
+        return it != m_cells.end() && *it == cell
+            ? static_cast<std::size_t>(it - m_cells.begin())
+            : m_cells.size();
+    }
+
+    CalculationType m_min_x;
+    CalculationType m_min_y;
+    CalculationType m_cell_size;
+    CalculationType m_inner_radius;
+    CalculationType m_outer_extent;
+    std::vector<cell_type> m_cells;
+    std::vector<std::size_t> m_counts;
+};
+
+
+/*!
+\brief Marks the points of a multi point whose buffer is covered by the
+    buffers of the other (unmarked) points. Their buffers do not change the
+    union, and leaving them out avoids the turns between all overlapping
+    circles of dense point sets. It returns false if nothing is marked.
+\details The buffer of each point is assumed to be the same convex shape,
+    translated to the point. That is verified for the distance. The radius of
+    the largest circle inside the shape and the extent of the shape are
+    derived from the buffer of the first point.
+*/
+template
+<
+    typename OutputPoint,
+    typename MultiPoint,
+    typename DistanceStrategy,
+    typename PointStrategy
+>
+inline bool mark_covered_points(MultiPoint const& multi_point,
+        DistanceStrategy const& distance_strategy,
+        PointStrategy const& point_strategy,
+        std::vector<bool>& covered)
+{
+    typedef typename point_type<MultiPoint>::type point_type;
+    typedef typename geometry::select_most_precise
+        <
+            typename geometry::coordinate_type<point_type>::type,
+            double
+        >::type calculation_type;
+    typedef typename boost::range_iterator<MultiPoint const>::type iterator_type;
+
+    bool const cartesian = boost::is_same
+        <
+            typename cs_tag<point_type>::type,
+            cartesian_tag
+        >::value;
+
+    if (BOOST_GEOMETRY_CONDITION(! cartesian)
+        || boost::size(multi_point) < 3
+        || distance_strategy.negative())
+    {
+        return false;
+    }
+
+    point_type const& first = *boost::begin(multi_point);
+    calculation_type const distance = distance_strategy.apply(first, first,
+            strategy::buffer::buffer_side_left);
+
+    calculation_type min_x = geometry::get<0>(first);
+    calculation_type min_y = geometry::get<1>(first);
+    calculation_type max_x = min_x;
+    calculation_type max_y = min_y;
+    for (iterator_type it = boost::begin(multi_point);
+         it != boost::end(multi_point); ++it)
+    {
+        if (distance_strategy.apply(*it, *it,
+                strategy::buffer::buffer_side_left) != distance)
+        {
+            return false;
+        }
+        min_x = (std::min)(min_x, calculation_type(geometry::get<0>(*it)));
+        min_y = (std::min)(min_y, calculation_type(geometry::get<1>(*it)));
+        max_x = (std::max)(max_x, calculation_type(geometry::get<0>(*it)));
+        max_y = (std::max)(max_y, calculation_type(geometry::get<1>(*it)));
+    }
+
+    std::vector<OutputPoint> shape;
+    point_strategy.apply(first, distance_strategy, shape);
+    if (shape.size() < 4)
+    {
+        return false;
+    }
+
+    // Get the radius of the inner circle, from the distances of the center
+    // to the (closed) shape's edges, and the extent of the shape.
+    calculation_type const cx = geometry::get<0>(first);
+    calculation_type const cy = geometry::get<1>(first);
+    calculation_type inner_radius = distance;
+    calculation_type outer_extent = 0;
+    int orientation = 0;
+    for (std::size_t i = 0; i + 1 < shape.size(); i++)
+    {
+        calculation_type const ax = geometry::get<0>(shape[i]) - cx;
+        calculation_type const ay = geometry::get<1>(shape[i]) - cy;
+        calculation_type const bx = geometry::get<0>(shape[i + 1]) - cx;
+        calculation_type const by = geometry::get<1>(shape[i + 1]) - cy;
+
+        calculation_type const cross = ax * by - ay * bx;
+        int const sign = cross > 0 ? 1 : cross < 0 ? -1 : 0;
+        if (sign == 0 || (orientation != 0 && sign != orientation))
+        {
+            // Not convex around the point
+            return false;
+        }
+        orientation = sign;
+
+        calculation_type const length
+            = geometry::math::sqrt((bx - ax) * (bx - ax) + (by - ay) * (by - ay));
+        inner_radius = (std::min)(inner_radius,
+                                  geometry::math::abs(cross) / length);
+        outer_extent = (std::max)(outer_extent,
+                (std::max)(geometry::math::abs(ax), geometry::math::abs(ay)));
+    }
+
+    // Keep a margin for the rounding of the generated coordinates
+    inner_radius *= 0.999;
+    outer_extent *= 1.001;
+
+    // With cells of half the inner radius, each point covers several cells
+    calculation_type const cell_size = inner_radius / 2.0;
+    calculation_type const margin = outer_extent + cell_size;
+    if (! (cell_size > 0)
+        || (max_x - min_x + 2.0 * margin) / cell_size > 1.0e9
+        || (max_y - min_y + 2.0 * margin) / cell_size > 1.0e9)
+    {
+        return false;
+    }
+
+    point_buffer_grid<calculation_type> grid(min_x - margin, min_y - margin,
+            cell_size, inner_radius, outer_extent);
+    for (iterator_type it = boost::begin(multi_point);
+         it != boost::end(multi_point); ++it)
+    {
+        grid.add(*it);
+    }
+    grid.finish();
+
+    covered.resize(boost::size(multi_point));
+    bool result = false;
+    std::size_t index = 0;
+    for (iterator_type it = boost::begin(multi_point);
+         it != boost::end(multi_point); ++it, ++index)
+    {
+        covered[index] = grid.remove_if_covered(*it);
+        if (covered[index])
+        {
+            result = true;
+        }
+    }
+    return result;
+}
+
+
+template
+<
+    typename MultiPoint,
+    typename PolygonOutput,
+    typename Policy
+>
+struct buffer_multi_point
+{
+    template
+    <
+        typename Collection,
+        typename DistanceStrategy,
+        typename SideStrategy,
+        typename JoinStrategy,
+        typename EndStrategy,
+        typename PointStrategy,
+        typename RobustPolicy,
+        typename Strategy
+    >
+    static inline void apply(MultiPoint const& multi_point,
+            Collection& collection,
+            DistanceStrategy const& distance_strategy,
+            SideStrategy const& side_strategy,
+            JoinStrategy const& join_strategy,
+            EndStrategy const& end_strategy,
+            PointStrategy const& point_strategy,
+            RobustPolicy const& robust_policy,
+            Strategy const& strategy) // side strategy
+    {
+        std::vector<bool> covered;
+        bool const has_covered = mark_covered_points
+            <
+                typename point_type<PolygonOutput>::type
+            >(multi_point, distance_strategy, point_strategy, covered);
+
+        std::size_t index = 0;
+        for (typename boost::range_iterator<MultiPoint const>::type
+                it = boost::begin(multi_point);
+            it != boost::end(multi_point);
+            ++it, ++index)
+        {
+            if (! has_covered || ! covered[index])
+            {
+                Policy::apply(*it, collection,
+                    distance_strategy, side_strategy,
+                    join_strategy, end_strategy, point_strategy,
+                    robust_policy, strategy);
+            }
+        }
+    }
+};
+
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_MULTI_POINT_HPP
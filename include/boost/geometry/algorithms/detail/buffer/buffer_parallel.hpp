@@ -0,0 +1,422 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_PARALLEL_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/detail/buffer/buffer_box.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_chunked.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_inserter.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/expand/interface.hpp>
+#include <boost/geometry/algorithms/detail/parallel.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+
+template <typename Box>
+struct component_envelope
+{
+    Box envelope;
+    std::size_t index;
+};
+
+template <typename BoxExpandStrategy>
+struct component_envelope_get_box
+{
+    template <typename Box, typename Item>
+    static inline void apply(Box& total, Item const& item)
+    {
+        geometry::expand(total, item.envelope, BoxExpandStrategy());
+    }
+};
+
+template <typename DisjointBoxBoxStrategy>
+struct component_envelope_overlaps_box
+{
+    template <typename Box, typename Item>
+    static inline bool apply(Box const& box, Item const& item)
+    {
+        return ! geometry::detail::disjoint::disjoint_box_box(
+                    box, item.envelope, DisjointBoxBoxStrategy());
+    }
+};
+
+// Joins the groups (disjoint sets, stored as parent indices) of components
+// with overlapping or touching inflated envelopes
+template <typename DisjointBoxBoxStrategy>
+struct component_group_visitor
+{
+    explicit component_group_visitor(std::vector<std::size_t>& parents)
+        : m_parents(parents)
+    {}
+
+    template <typename Item>
+    inline bool apply(Item const& item1, Item const& item2)
+    {
+        if (! geometry::detail::disjoint::disjoint_box_box(
+                    item1.envelope, item2.envelope, DisjointBoxBoxStrategy()))
+        {
+            std::size_t const root1 = find_root(item1.index);
+            std::size_t const root2 = find_root(item2.index);
+            if (root1 != root2)
+            {
+                // Keep the lowest index as root, groups are then ordered
+                // by their first component
+                if (root1 < root2)
+                {
+                    m_parents[root2] = root1;
+                }
+                else
+                {
+                    m_parents[root1] = root2;
+                }
+            }
+        }
+        return true;
+    }
+
+    inline std::size_t find_root(std::size_t index)
+    {
+        std::size_t root = index;
+        while (m_parents[root] != root)
+        {
+            root = m_parents[root];
+        }
+        // Path compression
+        while (m_parents[index] != root)
+        {
+            std::size_t const next = m_parents[index];
+            m_parents[index] = root;
+            index = next;
+        }
+        return root;
+    }
+
+    std::vector<std::size_t>& m_parents;
+};
+
+
+template
+<
+    typename GeometryOutput,
+    typename RescalePolicy,
+    typename Multi,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy,
+    typename IntersectionStrategy
+>
+struct buffer_group_caller
+{
+    buffer_group_caller(Multi const& multi,
+            std::vector<std::vector<std::size_t> > const& groups,
+            std::vector<std::vector<GeometryOutput> >& results,
+            DistanceStrategy const& distance_strategy,
+            SideStrategy const& side_strategy,
+            JoinStrategy const& join_strategy,
+            EndStrategy const& end_strategy,
+            PointStrategy const& point_strategy,
+            IntersectionStrategy const& intersection_strategy)
+        : m_multi(multi)
+        , m_groups(groups)
+        , m_results(results)
+        , m_distance_strategy(distance_strategy)
+        , m_side_strategy(side_strategy)
+        , m_join_strategy(join_strategy)
+        , m_end_strategy(end_strategy)
+        , m_point_strategy(point_strategy)
+        , m_intersection_strategy(intersection_strategy)
+    {}
+
+    inline void operator()(std::size_t index) const
+    {
+        std::vector<std::size_t> const& group = m_groups[index];
+
+        Multi group_geometry;
+        for (std::size_t i = 0; i < group.size(); i++)
+        {
+            range::push_back(group_geometry, range::at(m_multi, group[i]));
+        }
+
+        buffer_group<GeometryOutput, RescalePolicy>(group_geometry,
+                std::back_inserter(m_results[index]),
+                m_distance_strategy, m_side_strategy, m_join_strategy,
+                m_end_strategy, m_point_strategy, m_intersection_strategy);
+    }
+
+    Multi const& m_multi;
+    std::vector<std::vector<std::size_t> > const& m_groups;
+    std::vector<std::vector<GeometryOutput> >& m_results;
+    DistanceStrategy const& m_distance_strategy;
+    SideStrategy const& m_side_strategy;
+    JoinStrategy const& m_join_strategy;
+    EndStrategy const& m_end_strategy;
+    PointStrategy const& m_point_strategy;
+    IntersectionStrategy const& m_intersection_strategy;
+};
+
+
+template <typename Tag>
+struct buffer_parallel
+{
+    // Single geometries are buffered as one piece collection
+    template
+    <
+        typename GeometryOutput,
+        typename RescalePolicy,
+        typename Geometry,
+        typename OutputIterator,
+        typename DistanceStrategy,
+        typename SideStrategy,
+        typename JoinStrategy,
+        typename EndStrategy,
+        typename PointStrategy,
+        typename IntersectionStrategy
+    >
+    static inline void apply(Geometry const& geometry, OutputIterator out,
+            DistanceStrategy const& distance_strategy,
+            SideStrategy const& side_strategy,
+            JoinStrategy const& join_strategy,
+            EndStrategy const& end_strategy,
+            PointStrategy const& point_strategy,
+            IntersectionStrategy const& intersection_strategy,
+            std::size_t )
+    {
+        buffer_group<GeometryOutput, RescalePolicy>(geometry, out,
+                distance_strategy, side_strategy, join_strategy,
+                end_strategy, point_strategy, intersection_strategy);
+    }
+};
+
+template <>
+struct buffer_parallel<linestring_tag>
+{
+    template
+    <
+        typename GeometryOutput,
+        typename RescalePolicy,
+        typename Linestring,
+        typename OutputIterator,
+        typename DistanceStrategy,
+        typename SideStrategy,
+        typename JoinStrategy,
+        typename EndStrategy,
+        typename PointStrategy,
+        typename IntersectionStrategy
+    >
+    static inline void apply(Linestring const& linestring, OutputIterator out,
+            DistanceStrategy const& distance_strategy,
+            SideStrategy const& side_strategy,
+            JoinStrategy const& join_strategy,
+            EndStrategy const& end_strategy,
+            PointStrategy const& point_strategy,
+            IntersectionStrategy const& intersection_strategy,
+            std::size_t threads)
+    {
+        std::size_t const size = boost::size(linestring);
+        if (size > 2 * buffer_chunk_segment_count
+            && ! distance_strategy.negative())
+        {
+            buffer_chunked<GeometryOutput, RescalePolicy>(linestring, out,
+                    distance_strategy, side_strategy, join_strategy,
+                    end_strategy, point_strategy, intersection_strategy,
+                    threads);
+        }
+        else
+        {
+            buffer_group<GeometryOutput, RescalePolicy>(linestring, out,
+                    distance_strategy, side_strategy, join_strategy,
+                    end_strategy, point_strategy, intersection_strategy);
+        }
+    }
+};
+
+template <>
+struct buffer_parallel<multi_tag>
+{
+    template
+    <
+        typename GeometryOutput,
+        typename RescalePolicy,
+        typename Multi,
+        typename OutputIterator,
+        typename DistanceStrategy,
+        typename SideStrategy,
+        typename JoinStrategy,
+        typename EndStrategy,
+        typename PointStrategy,
+        typename IntersectionStrategy
+    >
+    static inline void apply(Multi const& multi, OutputIterator out,
+            DistanceStrategy const& distance_strategy,
+            SideStrategy const& side_strategy,
+            JoinStrategy const& join_strategy,
+            EndStrategy const& end_strategy,
+            PointStrategy const& point_strategy,
+            IntersectionStrategy const& intersection_strategy,
+            std::size_t threads)
+    {
+        typedef typename point_type<Multi>::type point_type;
+        typedef model::box<point_type> box_type;
+        typedef component_envelope<box_type> item_type;
+        typedef typename IntersectionStrategy::disjoint_box_box_strategy_type
+            disjoint_box_box_strategy_type;
+
+        std::size_t const count = boost::size(multi);
+
+        // Components can only interact if their buffers can overlap, which
+        // is conservatively detected by their envelopes inflated by the
+        // maximal buffer distance
+        std::vector<item_type> items(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            geometry::envelope(range::at(multi, i), items[i].envelope);
+            buffer_box(items[i].envelope,
+                    distance_strategy.max_distance(join_strategy, end_strategy),
+                    items[i].envelope);
+            items[i].index = i;
+        }
+
+        std::vector<std::size_t> parents(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            parents[i] = i;
+        }
+
+        component_group_visitor<disjoint_box_box_strategy_type> visitor(parents);
+        geometry::partition
+            <
+                box_type
+            >::apply(items, visitor,
+                     component_envelope_get_box
+                        <
+                            typename IntersectionStrategy::expand_box_strategy_type
+                        >(),
+                     component_envelope_overlaps_box
+                        <
+                            disjoint_box_box_strategy_type
+                        >());
+
+        // Collect the groups, ordered by their first component
+        std::vector<std::size_t> group_of(count);
+        std::vector<std::vector<std::size_t> > groups;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            std::size_t const root = visitor.find_root(i);
+            if (root == i)
+            {
+                group_of[i] = groups.size();
+                groups.push_back(std::vector<std::size_t>());
+            }
+            groups[group_of[root]].push_back(i);
+        }
+
+        if (groups.size() <= 1)
+        {
+            buffer_group<GeometryOutput, RescalePolicy>(multi, out,
+                    distance_strategy, side_strategy, join_strategy,
+                    end_strategy, point_strategy, intersection_strategy);
+            return;
+        }
+
+        // The buffers of different groups are disjoint, so they can be
+        // generated independently and do not need to be merged
+        std::vector<std::vector<GeometryOutput> > results(groups.size());
+        geometry::detail::parallel::for_each_index(groups.size(), threads,
+            buffer_group_caller
+                <
+                    GeometryOutput, RescalePolicy, Multi,
+                    DistanceStrategy, SideStrategy, JoinStrategy,
+                    EndStrategy, PointStrategy, IntersectionStrategy
+                >(multi, groups, results,
+                  distance_strategy, side_strategy, join_strategy,
+                  end_strategy, point_strategy, intersection_strategy));
+
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            for (std::size_t j = 0; j < results[i].size(); j++)
+            {
+                *out++ = results[i][j];
+            }
+        }
+    }
+};
+
+
+/*!
+\brief Buffers a geometry. Components of a multi geometry are divided in
+    groups of possibly interacting components, and the groups are buffered
+    independently using the specified number of threads (0: as many as the
+    hardware supports).
+*/
+template
+<
+    typename GeometryOutput,
+    typename RescalePolicy,
+    typename GeometryInput,
+    typename OutputIterator,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy,
+    typename IntersectionStrategy
+>
+inline void buffer_inserter_parallel(GeometryInput const& geometry_input,
+        OutputIterator out,
+        DistanceStrategy const& distance_strategy,
+        SideStrategy const& side_strategy,
+        JoinStrategy const& join_strategy,
+        EndStrategy const& end_strategy,
+        PointStrategy const& point_strategy,
+        IntersectionStrategy const& intersection_strategy,
+        std::size_t threads)
+{
+    buffer_parallel
+        <
+            typename tag_cast
+                <
+                    typename tag<GeometryInput>::type,
+                    multi_tag
+                >::type
+        >::template apply<GeometryOutput, RescalePolicy>(geometry_input, out,
+                distance_strategy, side_strategy, join_strategy,
+                end_strategy, point_strategy, intersection_strategy,
+                threads);
+}
+
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_PARALLEL_HPP
@@ -22,6 +22,8 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISJOINT_LINEAR_SEGMENT_OR_BOX_HPP
 
 
+#include <iterator>
+
 #include <boost/geometry/algorithms/detail/disjoint/multirange_geometry.hpp>
 #include <boost/geometry/algorithms/dispatch/disjoint.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
@@ -101,6 +103,13 @@ struct disjoint_range_segment_or_box
 
         typedef typename ::boost::range_size<view_type>::type size_type;
 
+        // The segment refers to the points, points created by the
+        // iterators are kept here (as copies)
+        typedef typename std::iterator_traits
+            <
+                const_iterator
+            >::reference point_reference;
+
         typedef typename geometry::model::referring_segment
             <
                 point_type const
@@ -131,7 +140,9 @@ struct disjoint_range_segment_or_box
 
             for ( ; it1 != last ; ++it0, ++it1 )
             {
-                range_segment rng_segment(*it0, *it1);
+                point_reference p0 = *it0;
+                point_reference p1 = *it1;
+                range_segment rng_segment(p0, p1);
                 if ( !dispatch::disjoint
                          <
                              range_segment, SegmentOrBox
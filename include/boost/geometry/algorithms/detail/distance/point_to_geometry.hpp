@@ -21,6 +21,7 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISTANCE_POINT_TO_GEOMETRY_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISTANCE_POINT_TO_GEOMETRY_HPP
 
+#include <cstddef>
 #include <iterator>
 
 #include <boost/core/ignore_unused.hpp>
@@ -29,6 +30,7 @@
 
 #include <boost/geometry/core/closure.hpp>
 #include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/core/exterior_ring.hpp>
 #include <boost/geometry/core/interior_rings.hpp>
 #include <boost/geometry/core/tag.hpp>
@@ -351,6 +353,92 @@ struct point_to_multigeometry<Point, MultiPolygon, Strategy, true>
 };
 
 
+template
+<
+    typename Point,
+    typename MultiPoint,
+    typename Strategy,
+    bool EnableBatch = strategy::distance::services::enable_batch
+        <
+            Strategy
+        >::value
+>
+struct point_to_multipoint
+    : point_to_multigeometry<Point, MultiPoint, Strategy>
+{};
+
+// The distances to the points of a block are calculated together,
+// the result is the same as the result of point_to_multigeometry
+template <typename Point, typename MultiPoint, typename Strategy>
+struct point_to_multipoint<Point, MultiPoint, Strategy, true>
+{
+    typedef typename point_type<MultiPoint>::type point_type2;
+
+    typedef typename strategy::distance::services::return_type
+        <
+            Strategy, Point, point_type2
+        >::type return_type;
+
+    static inline return_type apply(Point const& point,
+                                    MultiPoint const& multipoint,
+                                    Strategy const& strategy)
+    {
+        typedef typename Strategy::template calculation_type
+            <
+                Point, point_type2
+            >::type calculation_type;
+        typedef typename boost::range_iterator
+            <
+                MultiPoint const
+            >::type iterator_type;
+
+        static std::size_t const block_size = 256;
+
+        calculation_type lon1[block_size];
+        calculation_type lat1[block_size];
+        calculation_type lon2[block_size];
+        calculation_type lat2[block_size];
+        calculation_type distances[block_size];
+
+        calculation_type const lon = get_as_radian<0>(point);
+        calculation_type const lat = get_as_radian<1>(point);
+        for (std::size_t i = 0; i < block_size; i++)
+        {
+            lon1[i] = lon;
+            lat1[i] = lat;
+        }
+
+        bool first = true;
+        calculation_type result = calculation_type();
+
+        iterator_type it = boost::begin(multipoint);
+        iterator_type const end = boost::end(multipoint);
+        while (it != end)
+        {
+            std::size_t n = 0;
+            for ( ; it != end && n < block_size; ++it, ++n)
+            {
+                lon2[n] = get_as_radian<0>(*it);
+                lat2[n] = get_as_radian<1>(*it);
+            }
+
+            strategy.apply_n(lon1, lat1, lon2, lat2, n, distances);
+
+            for (std::size_t i = 0; i < n; i++)
+            {
+                if (first || distances[i] < result)
+                {
+                    result = distances[i];
+                    first = false;
+                }
+            }
+        }
+
+        return result;
+    }
+};
+
+
 }} // namespace detail::distance
 #endif // DOXYGEN_NO_DETAIL
 
@@ -457,7 +545,7 @@ struct distance
     <
         Point, MultiPoint, Strategy, point_tag, multi_point_tag,
         strategy_tag_distance_point_point, false
-    > : detail::distance::point_to_multigeometry
+    > : detail::distance::point_to_multipoint
         <
             Point, MultiPoint, Strategy
         >
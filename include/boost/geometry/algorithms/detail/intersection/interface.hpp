@@ -122,11 +122,11 @@ struct intersection
                              GeometryOut & geometry_out,
                              Strategy const& strategy)
     {
-        typedef typename geometry::rescale_overlay_policy_type
+        typedef typename geometry::rescale_overlay_policy_type_for_strategy
             <
                 Geometry1,
                 Geometry2,
-                typename Strategy::cs_tag
+                Strategy
             >::type rescale_policy_type;
         
         rescale_policy_type robust_policy
@@ -17,6 +17,7 @@
 
 
 #include <cstddef>
+#include <iterator>
 #include <map>
 
 #include <boost/array.hpp>
@@ -253,6 +254,11 @@ class get_turns_in_sections
     typedef ever_circling_iterator<range1_iterator> circular1_iterator;
     typedef ever_circling_iterator<range2_iterator> circular2_iterator;
 
+    // The sub ranges refer to the points, if the ranges create their
+    // points when they are accessed they are kept here (as copies)
+    typedef typename std::iterator_traits<range1_iterator>::reference point1_reference;
+    typedef typename std::iterator_traits<range2_iterator>::reference point2_reference;
+
     template <typename Geometry, typename Section>
     static inline bool adjacent(Section const& section,
             signed_size_type index1, signed_size_type index2)
@@ -351,13 +357,15 @@ public :
             it1 != end1 && ! detail::section::exceeding<0>(dir1, *prev1, sec1.bounding_box, sec2.bounding_box, robust_policy);
             ++prev1, ++it1, ++index1, ++next1, ++ndi1)
         {
+            point1_reference prev1_point = *prev1;
+            point1_reference it1_point = *it1;
             unique_sub_range_from_section
                 <
                     areal1, Section1, point1_type, circular1_iterator,
                     IntersectionStrategy, RobustPolicy
                 > unique_sub_range1(sec1, index1,
                                     circular1_iterator(begin_range_1, end_range_1, next1, true),
-                                    *prev1, *it1,
+                                    prev1_point, it1_point,
                                     robust_policy);
 
             signed_size_type index2 = sec2.begin_index;
@@ -404,13 +412,15 @@ public :
 
                 if (! skip)
                 {
+                    point2_reference prev2_point = *prev2;
+                    point2_reference it2_point = *it2;
                     unique_sub_range_from_section
                         <
                             areal2, Section2, point2_type, circular2_iterator,
                             IntersectionStrategy, RobustPolicy
                         > unique_sub_range2(sec2, index2,
                                             circular2_iterator(begin_range_2, end_range_2, next2),
-                                            *prev2, *it2,
+                                            prev2_point, it2_point,
                                             robust_policy);
 
                     typedef typename boost::range_value<Turns>::type turn_info;
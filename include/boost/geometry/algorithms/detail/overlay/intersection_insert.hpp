@@ -1545,11 +1545,11 @@ inline OutputIterator intersection_insert(Geometry1 const& geometry1,
     concepts::check<Geometry1 const>();
     concepts::check<Geometry2 const>();
 
-    typedef typename geometry::rescale_overlay_policy_type
+    typedef typename geometry::rescale_overlay_policy_type_for_strategy
         <
             Geometry1,
             Geometry2,
-            typename Strategy::cs_tag
+            Strategy
         >::type rescale_policy_type;
 
     rescale_policy_type robust_policy
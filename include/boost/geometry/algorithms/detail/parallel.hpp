@@ -0,0 +1,323 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_HPP
+
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+
+#include <boost/config.hpp>
+
+// Worker threads are used if the standard library provides them. Define
+// BOOST_GEOMETRY_NO_THREADS to force sequential execution of everything
+// built on top of these helpers.
+#if ! defined(BOOST_GEOMETRY_NO_THREADS) \
+    && ! defined(BOOST_NO_CXX11_HDR_THREAD) \
+    && ! defined(BOOST_NO_CXX11_HDR_FUTURE) \
+    && ! defined(BOOST_NO_CXX11_HDR_ATOMIC)
+#define BOOST_GEOMETRY_PARALLEL_USE_THREADS
+#endif
+
+#ifdef BOOST_GEOMETRY_PARALLEL_USE_THREADS
+#include <atomic>
+#include <future>
+#include <thread>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel
+{
+
+
+/*!
+\brief Returns the number of threads to use for a requested number,
+    0 meaning as many as the hardware supports. Without thread support
+    it is always 1.
+*/
+inline std::size_t thread_count(std::size_t requested)
+{
+#ifdef BOOST_GEOMETRY_PARALLEL_USE_THREADS
+    if (requested == 0)
+    {
+        std::size_t const hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : hardware;
+    }
+    return requested;
+#else
+    return 1;
+#endif
+}
+
+
+#ifdef BOOST_GEOMETRY_PARALLEL_USE_THREADS
+template <typename Function>
+struct index_worker
+{
+    index_worker(Function const& f, std::atomic<std::size_t>& next,
+                 std::size_t count)
+        : m_function(f)
+        , m_next(next)
+        , m_count(count)
+    {}
+
+    void operator()() const
+    {
+        try
+        {
+            for (std::size_t i = m_next++; i < m_count; i = m_next++)
+            {
+                m_function(i);
+            }
+        }
+        catch (...)
+        {
+            // Let the other workers stop as soon as possible
+            m_next = m_count;
+            throw;
+        }
+    }
+
+    Function const& m_function;
+    std::atomic<std::size_t>& m_next;
+    std::size_t m_count;
+};
+#endif
+
+
+/*!
+\brief Calls f(i) for each i in [0, count), using at most the specified
+    number of threads (see thread_count). The function object must be safe
+    to call concurrently for distinct indices. If a call throws, the
+    remaining indices are skipped and the first exception is rethrown
+    after all threads finished.
+*/
+template <typename Function>
+inline void for_each_index(std::size_t count, std::size_t threads,
+                           Function const& f)
+{
+    std::size_t const used_threads = (std::min)(thread_count(threads), count);
+
+    if (used_threads <= 1)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            f(i);
+        }
+        return;
+    }
+
+#ifdef BOOST_GEOMETRY_PARALLEL_USE_THREADS
+    std::atomic<std::size_t> next(0);
+    index_worker<Function> const worker(f, next, count);
+
+    std::vector<std::future<void> > futures;
+    futures.reserve(used_threads - 1);
+
+    std::exception_ptr error;
+    try
+    {
+        for (std::size_t i = 1; i < used_threads; i++)
+        {
+            futures.push_back(std::async(std::launch::async, worker));
+        }
+        // The calling thread participates as well
+        worker();
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+        next = count;
+    }
+
+    for (std::size_t i = 0; i < futures.size(); i++)
+    {
+        try
+        {
+            futures[i].get();
+        }
+        catch (...)
+        {
+            if (! error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+#endif
+}
+
+
+// Returns the first index of the chunk with the specified index, when
+// [0, size) is divided into chunk_count chunks. For index == chunk_count
+// it returns size.
+inline std::size_t chunk_begin(std::size_t index, std::size_t size,
+                               std::size_t chunk_count)
+{
+    // Distribute the remainder over the first chunks
+    std::size_t const base = size / chunk_count;
+    std::size_t const remainder = size % chunk_count;
+    return index * base + (std::min)(index, remainder);
+}
+
+
+template <typename Function>
+struct chunk_caller
+{
+    chunk_caller(Function const& f, std::size_t size, std::size_t chunk_count)
+        : m_function(f)
+        , m_size(size)
+        , m_chunk_count(chunk_count)
+    {}
+
+    void operator()(std::size_t index) const
+    {
+        m_function(index, chunk_begin(index, m_size, m_chunk_count),
+                   chunk_begin(index + 1, m_size, m_chunk_count));
+    }
+
+    Function const& m_function;
+    std::size_t m_size;
+    std::size_t m_chunk_count;
+};
+
+
+/*!
+\brief Returns the number of chunks [0, size) is divided in for the
+    specified number of threads, such that each chunk contains at least
+    min_chunk_size elements. It is at least 1.
+*/
+inline std::size_t chunk_count(std::size_t size, std::size_t threads,
+                               std::size_t min_chunk_size)
+{
+    std::size_t const used_threads = thread_count(threads);
+    std::size_t const max_chunks = min_chunk_size == 0
+        ? size : size / min_chunk_size;
+    std::size_t const result = (std::min)(used_threads, max_chunks);
+    return result == 0 ? 1 : result;
+}
+
+
+/*!
+\brief Divides [0, size) into chunk_count contiguous chunks and calls
+    f(chunk_index, first, last) for each of them (see for_each_index).
+*/
+template <typename Function>
+inline void for_each_chunk(std::size_t size, std::size_t chunk_count,
+                           std::size_t threads, Function const& f)
+{
+    for_each_index(chunk_count, threads,
+                   chunk_caller<Function>(f, size, chunk_count));
+}
+
+
+template <typename RandomIt, typename Less>
+struct sort_chunk
+{
+    sort_chunk(RandomIt first, Less const& less)
+        : m_first(first)
+        , m_less(less)
+    {}
+
+    void operator()(std::size_t, std::size_t first, std::size_t last) const
+    {
+        std::sort(m_first + first, m_first + last, m_less);
+    }
+
+    RandomIt m_first;
+    Less const& m_less;
+};
+
+
+template <typename RandomIt, typename Less>
+struct merge_chunks
+{
+    merge_chunks(RandomIt first, std::vector<std::size_t> const& bounds,
+                 std::size_t step, Less const& less)
+        : m_first(first)
+        , m_bounds(bounds)
+        , m_step(step)
+        , m_less(less)
+    {}
+
+    void operator()(std::size_t index) const
+    {
+        std::size_t const chunks = m_bounds.size() - 1;
+        std::size_t const first = index * 2 * m_step;
+        std::size_t const middle = first + m_step;
+        std::size_t const last = (std::min)(middle + m_step, chunks);
+        if (middle < last)
+        {
+            std::inplace_merge(m_first + m_bounds[first],
+                               m_first + m_bounds[middle],
+                               m_first + m_bounds[last],
+                               m_less);
+        }
+    }
+
+    RandomIt m_first;
+    std::vector<std::size_t> const& m_bounds;
+    std::size_t m_step;
+    Less const& m_less;
+};
+
+
+/*!
+\brief Sorts [first, last) with the specified number of threads, by sorting
+    chunks concurrently and merging them pairwise. Small ranges are sorted
+    on the calling thread.
+*/
+template <typename RandomIt, typename Less>
+inline void sort(RandomIt first, RandomIt last, Less const& less,
+                 std::size_t threads)
+{
+    static std::size_t const min_chunk_size = 1 << 14;
+
+    std::size_t const size = static_cast<std::size_t>(last - first);
+    std::size_t const chunks = chunk_count(size, threads, min_chunk_size);
+    if (chunks <= 1)
+    {
+        std::sort(first, last, less);
+        return;
+    }
+
+    std::vector<std::size_t> bounds(chunks + 1);
+    for (std::size_t i = 0; i <= chunks; i++)
+    {
+        bounds[i] = chunk_begin(i, size, chunks);
+    }
+
+    for_each_chunk(size, chunks, threads,
+                   sort_chunk<RandomIt, Less>(first, less));
+
+    for (std::size_t step = 1; step < chunks; step *= 2)
+    {
+        std::size_t const merges = (chunks + 2 * step - 1) / (2 * step);
+        for_each_index(merges, threads,
+                       merge_chunks<RandomIt, Less>(first, bounds, step, less));
+    }
+}
+
+
+}} // namespace detail::parallel
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_HPP
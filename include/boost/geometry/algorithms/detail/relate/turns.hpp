@@ -58,11 +58,11 @@ struct get_turns
 
     template <typename Strategy>
     struct robust_policy_type
-        : geometry::rescale_overlay_policy_type
+        : geometry::rescale_overlay_policy_type_for_strategy
             <
                 Geometry1,
                 Geometry2,
-                typename Strategy::cs_tag
+                Strategy
             >
     {};
 
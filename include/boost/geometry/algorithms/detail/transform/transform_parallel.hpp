@@ -0,0 +1,475 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_TRANSFORM_TRANSFORM_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_TRANSFORM_TRANSFORM_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/core/addressof.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/parallel.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace transform
+{
+
+
+template <typename T1, typename T2>
+inline bool same_object(T1 const& , T2 const& )
+{
+    return false;
+}
+
+template <typename T>
+inline bool same_object(T const& o1, T const& o2)
+{
+    return boost::addressof(o1) == boost::addressof(o2);
+}
+
+
+// Input ranges and the output ranges their points are written to,
+// starting at the given offsets. Output ranges are resized when a range
+// is added, so the points can be written concurrently afterwards.
+// As in the sequential transform, add() appends the points to the output
+// range and assign() replaces its points.
+template <typename Range1, typename Range2>
+struct range_pieces
+{
+    void add(Range1 const& input, Range2& output)
+    {
+        add_at(input, output, boost::size(output));
+    }
+
+    void assign(Range1 const& input, Range2& output)
+    {
+        add_at(input, output, 0);
+    }
+
+    std::size_t size() const
+    {
+        return inputs.size();
+    }
+
+    std::vector<Range1 const*> inputs;
+    std::vector<Range2*> outputs;
+    std::vector<std::size_t> offsets;
+
+private :
+    void add_at(Range1 const& input, Range2& output, std::size_t offset)
+    {
+        range::resize(output, offset + boost::size(input));
+
+        inputs.push_back(boost::addressof(input));
+        outputs.push_back(boost::addressof(output));
+        offsets.push_back(offset);
+    }
+};
+
+// Input ranges and output ranges which are left as they are, for callers
+// filling the output ranges themselves
+template <typename Range1, typename Range2>
+struct range_references
+{
+    typedef Range2 output_type;
+
+    void add(Range1 const& input, Range2& output)
+    {
+        inputs.push_back(boost::addressof(input));
+        outputs.push_back(boost::addressof(output));
+    }
+
+    void assign(Range1 const& input, Range2& output)
+    {
+        add(input, output);
+    }
+
+    std::size_t size() const
+    {
+        return inputs.size();
+    }
+
+    std::vector<Range1 const*> inputs;
+    std::vector<Range2*> outputs;
+};
+
+
+// Part [first, last) of the points of a piece
+struct range_task
+{
+    std::size_t piece;
+    std::size_t first;
+    std::size_t last;
+};
+
+
+// Divides each piece, of the specified number of points, into parts of
+// at least half of the chunk size, such that a long range is processed
+// by several threads and short ranges are not divided
+inline void make_range_tasks(std::vector<std::size_t> const& sizes,
+                             std::size_t chunk_size,
+                             std::vector<range_task>& tasks)
+{
+    for (std::size_t i = 0; i < sizes.size(); i++)
+    {
+        std::size_t const count = sizes[i];
+        std::size_t const parts = count <= chunk_size
+            ? 1 : (count + chunk_size - 1) / chunk_size;
+        for (std::size_t j = 0; j < parts; j++)
+        {
+            range_task task;
+            task.piece = i;
+            task.first = j * count / parts;
+            task.last = (j + 1) * count / parts;
+            tasks.push_back(task);
+        }
+    }
+}
+
+
+template <typename Function>
+struct range_part_task
+{
+    range_part_task(std::vector<range_task> const& tasks,
+                    std::vector<char>& results, Function const& function)
+        : m_tasks(tasks)
+        , m_results(results)
+        , m_function(function)
+    {}
+
+    void operator()(std::size_t index) const
+    {
+        range_task const& task = m_tasks[index];
+        if (! m_function(task.piece, task.first, task.last))
+        {
+            m_results[index] = 0;
+        }
+    }
+
+    std::vector<range_task> const& m_tasks;
+    std::vector<char>& m_results;
+    Function const& m_function;
+};
+
+
+/*!
+\brief Calls the function for parts of pieces of the specified sizes
+    using the specified number of threads. The function is called
+    with the index of the piece and the first and last point of the part
+    and has to be safe to call concurrently. Returns false if any of
+    the calls returned false.
+*/
+template <typename Function>
+inline bool for_each_range_part(std::vector<std::size_t> const& sizes,
+                                std::size_t threads,
+                                std::size_t min_chunk_size,
+                                Function const& function)
+{
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < sizes.size(); i++)
+    {
+        total += sizes[i];
+    }
+
+    // Use more tasks than threads, they are of different sizes
+    std::size_t const chunks = parallel::chunk_count(total, threads,
+                                                     min_chunk_size);
+    std::size_t const chunk_size = chunks <= 1 ? total
+        : (std::max)(min_chunk_size, total / (4 * chunks));
+
+    std::vector<range_task> tasks;
+    make_range_tasks(sizes, chunk_size, tasks);
+
+    std::vector<char> results(tasks.size(), 1);
+    parallel::for_each_index(tasks.size(), chunks <= 1 ? 1 : threads,
+        range_part_task<Function>(tasks, results, function));
+
+    return std::find(results.begin(), results.end(), 0) == results.end();
+}
+
+
+template <typename Pieces, typename Strategy>
+struct transform_range_part
+{
+    transform_range_part(Pieces& pieces, Strategy const& strategy)
+        : m_pieces(pieces)
+        , m_strategy(strategy)
+    {}
+
+    bool operator()(std::size_t piece, std::size_t first,
+                    std::size_t last) const
+    {
+        std::size_t const offset = m_pieces.offsets[piece];
+        for (std::size_t i = first; i < last; i++)
+        {
+            if (! m_strategy.apply(range::at(*m_pieces.inputs[piece], i),
+                                   range::at(*m_pieces.outputs[piece], offset + i)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Pieces& m_pieces;
+    Strategy const& m_strategy;
+};
+
+
+template
+<
+    typename Range1, typename Range2,
+    template <typename, typename> class Pieces = range_pieces
+>
+struct collect_range_pieces
+{
+    typedef Pieces<Range1, Range2> pieces_type;
+
+    static inline void apply(Range1 const& range1, Range2& range2,
+                             pieces_type& pieces)
+    {
+        pieces.add(range1, range2);
+    }
+};
+
+template
+<
+    typename Polygon1, typename Polygon2,
+    template <typename, typename> class Pieces = range_pieces
+>
+struct collect_polygon_pieces
+{
+    typedef Pieces
+        <
+            typename ring_type<Polygon1>::type,
+            typename ring_type<Polygon2>::type
+        > pieces_type;
+
+    static inline void apply(Polygon1 const& poly1, Polygon2& poly2,
+                             pieces_type& pieces)
+    {
+        if (! same_object(poly1, poly2))
+        {
+            geometry::clear(poly2);
+        }
+
+        pieces.add(geometry::exterior_ring(poly1),
+                   geometry::exterior_ring(poly2));
+
+        // Note: here a resizeable container is assumed.
+        traits::resize
+            <
+                typename boost::remove_reference
+                <
+                    typename traits::interior_mutable_type<Polygon2>::type
+                >::type
+            >::apply(geometry::interior_rings(poly2),
+                     geometry::num_interior_rings(poly1));
+
+        typename geometry::interior_return_type<Polygon1 const>::type
+            rings1 = geometry::interior_rings(poly1);
+        typename geometry::interior_return_type<Polygon2>::type
+            rings2 = geometry::interior_rings(poly2);
+
+        typename detail::interior_iterator<Polygon1 const>::type
+            it1 = boost::begin(rings1);
+        typename detail::interior_iterator<Polygon2>::type
+            it2 = boost::begin(rings2);
+        for ( ; it1 != boost::end(rings1); ++it1, ++it2)
+        {
+            pieces.add(*it1, *it2);
+        }
+    }
+};
+
+template <typename Multi1, typename Multi2, typename Policy>
+struct collect_multi_pieces
+{
+    typedef typename Policy::pieces_type pieces_type;
+
+    static inline void apply(Multi1 const& multi1, Multi2& multi2,
+                             pieces_type& pieces)
+    {
+        traits::resize<Multi2>::apply(multi2, boost::size(multi1));
+
+        typename boost::range_iterator<Multi1 const>::type it1
+                = boost::begin(multi1);
+        typename boost::range_iterator<Multi2>::type it2
+                = boost::begin(multi2);
+
+        for (; it1 != boost::end(multi1); ++it1, ++it2)
+        {
+            Policy::apply(*it1, *it2, pieces);
+        }
+    }
+};
+
+// Points of a multi point replace the points of the output, as the
+// sequential transform_multi resizes it and assigns its points
+template
+<
+    typename MultiPoint1, typename MultiPoint2,
+    template <typename, typename> class Pieces = range_pieces
+>
+struct collect_multi_point_pieces
+{
+    typedef Pieces<MultiPoint1, MultiPoint2> pieces_type;
+
+    static inline void apply(MultiPoint1 const& multi1, MultiPoint2& multi2,
+                             pieces_type& pieces)
+    {
+        pieces.assign(multi1, multi2);
+    }
+};
+
+
+// Collects the ranges of points of geometries having them, there is no
+// collector for other geometries
+template
+<
+    typename Geometry1, typename Geometry2,
+    template <typename, typename> class Pieces = range_pieces,
+    typename Tag = typename tag<Geometry1>::type
+>
+struct collect_pieces
+{};
+
+template
+<
+    typename Linestring1, typename Linestring2,
+    template <typename, typename> class Pieces
+>
+struct collect_pieces<Linestring1, Linestring2, Pieces, linestring_tag>
+    : collect_range_pieces<Linestring1, Linestring2, Pieces>
+{};
+
+template
+<
+    typename Ring1, typename Ring2,
+    template <typename, typename> class Pieces
+>
+struct collect_pieces<Ring1, Ring2, Pieces, ring_tag>
+    : collect_range_pieces<Ring1, Ring2, Pieces>
+{};
+
+template
+<
+    typename Polygon1, typename Polygon2,
+    template <typename, typename> class Pieces
+>
+struct collect_pieces<Polygon1, Polygon2, Pieces, polygon_tag>
+    : collect_polygon_pieces<Polygon1, Polygon2, Pieces>
+{};
+
+template
+<
+    typename MultiPoint1, typename MultiPoint2,
+    template <typename, typename> class Pieces
+>
+struct collect_pieces<MultiPoint1, MultiPoint2, Pieces, multi_point_tag>
+    : collect_multi_point_pieces<MultiPoint1, MultiPoint2, Pieces>
+{};
+
+template
+<
+    typename MultiLinestring1, typename MultiLinestring2,
+    template <typename, typename> class Pieces
+>
+struct collect_pieces
+    <
+        MultiLinestring1, MultiLinestring2, Pieces, multi_linestring_tag
+    >
+    : collect_multi_pieces
+        <
+            MultiLinestring1, MultiLinestring2,
+            collect_range_pieces
+                <
+                    typename boost::range_value<MultiLinestring1>::type,
+                    typename boost::range_value<MultiLinestring2>::type,
+                    Pieces
+                >
+        >
+{};
+
+template
+<
+    typename MultiPolygon1, typename MultiPolygon2,
+    template <typename, typename> class Pieces
+>
+struct collect_pieces
+    <
+        MultiPolygon1, MultiPolygon2, Pieces, multi_polygon_tag
+    >
+    : collect_multi_pieces
+        <
+            MultiPolygon1, MultiPolygon2,
+            collect_polygon_pieces
+                <
+                    typename boost::range_value<MultiPolygon1>::type,
+                    typename boost::range_value<MultiPolygon2>::type,
+                    Pieces
+                >
+        >
+{};
+
+
+/*!
+\brief Transforms the points of all ranges of a geometry with a strategy
+    using the specified number of threads. Long ranges are divided
+    into parts. The ranges have to be random access ranges and the
+    strategy has to be safe to call concurrently.
+*/
+template <typename CollectPolicy>
+struct transform_pieces_parallel
+{
+    template <typename Geometry1, typename Geometry2, typename Strategy>
+    static inline bool apply(Geometry1 const& geometry1, Geometry2& geometry2,
+                             Strategy const& strategy, std::size_t threads)
+    {
+        static std::size_t const min_chunk_size = 1 << 14;
+
+        typedef typename CollectPolicy::pieces_type pieces_type;
+
+        pieces_type pieces;
+        CollectPolicy::apply(geometry1, geometry2, pieces);
+
+        std::vector<std::size_t> sizes(pieces.size());
+        for (std::size_t i = 0; i < pieces.size(); i++)
+        {
+            sizes[i] = boost::size(*pieces.inputs[i]);
+        }
+
+        return for_each_range_part(sizes, threads, min_chunk_size,
+            transform_range_part<pieces_type, Strategy>(pieces, strategy));
+    }
+};
+
+
+}} // namespace detail::transform
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_TRANSFORM_TRANSFORM_PARALLEL_HPP
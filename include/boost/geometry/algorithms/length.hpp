@@ -20,6 +20,7 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_LENGTH_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_LENGTH_HPP
 
+#include <cstddef>
 #include <iterator>
 
 #include <boost/concept_check.hpp>
@@ -36,12 +37,15 @@
 #include <boost/range/end.hpp>
 #include <boost/range/iterator.hpp>
 #include <boost/range/value_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/variant/apply_visitor.hpp>
 #include <boost/variant/static_visitor.hpp>
 #include <boost/variant/variant_fwd.hpp>
 
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/core/tags.hpp>
 
 #include <boost/geometry/geometries/concepts/check.hpp>
@@ -95,6 +99,18 @@ struct range_length
     template <typename Strategy>
     static inline return_type apply(
             Range const& range, Strategy const& strategy)
+    {
+        return apply(range, strategy,
+                     typename strategy::distance::services::enable_batch
+                        <
+                            Strategy
+                        >::type());
+    }
+
+private:
+    template <typename Strategy>
+    static inline return_type apply(
+            Range const& range, Strategy const& strategy, boost::false_type)
     {
         boost::ignore_unused(strategy);
         typedef typename closeable_view<Range const, Closure>::type view_type;
@@ -120,6 +136,67 @@ struct range_length
 
         return sum;
     }
+
+    // The distances of the segments of a block are calculated together
+    // and added in the same order as above
+    template <typename Strategy>
+    static inline return_type apply(
+            Range const& range, Strategy const& strategy, boost::true_type)
+    {
+        typedef typename closeable_view<Range const, Closure>::type view_type;
+        typedef typename boost::range_iterator
+            <
+                view_type const
+            >::type iterator_type;
+        typedef typename point_type<Range>::type point_type;
+        typedef typename Strategy::template calculation_type
+            <
+                point_type, point_type
+            >::type calculation_type;
+
+        static std::size_t const block_size = 256;
+
+        calculation_type lon1[block_size];
+        calculation_type lat1[block_size];
+        calculation_type lon2[block_size];
+        calculation_type lat2[block_size];
+        calculation_type distances[block_size];
+
+        return_type sum = return_type();
+        view_type view(range);
+        iterator_type it = boost::begin(view), end = boost::end(view);
+        if(it == end)
+        {
+            return sum;
+        }
+
+        calculation_type lon = get_as_radian<0>(*it);
+        calculation_type lat = get_as_radian<1>(*it);
+        ++it;
+
+        while (it != end)
+        {
+            std::size_t n = 0;
+            for ( ; it != end && n < block_size; ++it, ++n)
+            {
+                lon1[n] = lon;
+                lat1[n] = lat;
+                lon = get_as_radian<0>(*it);
+                lat = get_as_radian<1>(*it);
+                lon2[n] = lon;
+                lat2[n] = lat;
+            }
+
+            strategy.apply_n(lon1, lat1, lon2, lat2, n, distances);
+
+            for (std::size_t i = 0; i < n; i++)
+            {
+                sum += distances[i];
+            }
+        }
+
+        return sum;
+    }
 };
 
 
@@ -246,11 +246,11 @@ inline OutputIterator sym_difference_insert(Geometry1 const& geometry1,
     concepts::check<Geometry2 const>();
     concepts::check<GeometryOut>();
 
-    typedef typename geometry::rescale_overlay_policy_type
+    typedef typename geometry::rescale_overlay_policy_type_for_strategy
         <
             Geometry1,
             Geometry2,
-            typename Strategy::cs_tag
+            Strategy
         >::type rescale_policy_type;
 
     rescale_policy_type robust_policy
@@ -28,6 +28,8 @@
 #include <boost/geometry/algorithms/assign.hpp>
 #include <boost/geometry/algorithms/clear.hpp>
 #include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/parallel.hpp>
+#include <boost/geometry/algorithms/detail/transform/transform_parallel.hpp>
 #include <boost/geometry/algorithms/num_interior_rings.hpp>
 
 #include <boost/geometry/core/cs.hpp>
@@ -336,6 +338,93 @@ struct transform
 {};
 
 
+
+// Geometries without ranges of points are transformed sequentially
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename Tag1 = typename tag<Geometry1>::type,
+    typename Tag2 = typename tag<Geometry2>::type
+>
+struct transform_parallel
+{
+    template <typename Strategy>
+    static inline bool apply(Geometry1 const& geometry1, Geometry2& geometry2,
+                             Strategy const& strategy, std::size_t )
+    {
+        return transform<Geometry1, Geometry2>::apply(geometry1, geometry2,
+                                                      strategy);
+    }
+};
+
+template <typename Linestring1, typename Linestring2>
+struct transform_parallel
+    <
+        Linestring1, Linestring2,
+        linestring_tag, linestring_tag
+    >
+    : detail::transform::transform_pieces_parallel
+        <
+            detail::transform::collect_pieces<Linestring1, Linestring2>
+        >
+{};
+
+template <typename Ring1, typename Ring2>
+struct transform_parallel<Ring1, Ring2, ring_tag, ring_tag>
+    : detail::transform::transform_pieces_parallel
+        <
+            detail::transform::collect_pieces<Ring1, Ring2>
+        >
+{};
+
+template <typename Polygon1, typename Polygon2>
+struct transform_parallel<Polygon1, Polygon2, polygon_tag, polygon_tag>
+    : detail::transform::transform_pieces_parallel
+        <
+            detail::transform::collect_pieces<Polygon1, Polygon2>
+        >
+{};
+
+template <typename MultiPoint1, typename MultiPoint2>
+struct transform_parallel
+    <
+        MultiPoint1, MultiPoint2,
+        multi_point_tag, multi_point_tag
+    >
+    : detail::transform::transform_pieces_parallel
+        <
+            detail::transform::collect_pieces<MultiPoint1, MultiPoint2>
+        >
+{};
+
+template <typename MultiLinestring1, typename MultiLinestring2>
+struct transform_parallel
+    <
+        MultiLinestring1, MultiLinestring2,
+        multi_linestring_tag, multi_linestring_tag
+    >
+    : detail::transform::transform_pieces_parallel
+        <
+            detail::transform::collect_pieces
+                <
+                    MultiLinestring1, MultiLinestring2
+                >
+        >
+{};
+
+template <typename MultiPolygon1, typename MultiPolygon2>
+struct transform_parallel
+    <
+        MultiPolygon1, MultiPolygon2,
+        multi_polygon_tag, multi_polygon_tag
+    >
+    : detail::transform::transform_pieces_parallel
+        <
+            detail::transform::collect_pieces<MultiPolygon1, MultiPolygon2>
+        >
+{};
+
+
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
@@ -370,6 +459,46 @@ struct transform
             typename detail::transform::select_strategy<Geometry1, Geometry2>::type()
         );
     }
+
+    template <typename Geometry1, typename Geometry2, typename Strategy>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2& geometry2,
+                             Strategy const& strategy,
+                             std::size_t threads)
+    {
+        concepts::check<Geometry1 const>();
+        concepts::check<Geometry2>();
+
+        if (detail::parallel::thread_count(threads) <= 1)
+        {
+            return dispatch::transform<Geometry1, Geometry2>::apply(
+                geometry1,
+                geometry2,
+                strategy
+            );
+        }
+
+        return dispatch::transform_parallel<Geometry1, Geometry2>::apply(
+            geometry1,
+            geometry2,
+            strategy,
+            threads
+        );
+    }
+
+    template <typename Geometry1, typename Geometry2>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2& geometry2,
+                             default_strategy,
+                             std::size_t threads)
+    {
+        return apply(
+            geometry1,
+            geometry2,
+            typename detail::transform::select_strategy<Geometry1, Geometry2>::type(),
+            threads
+        );
+    }
 };
 
 } // namespace resolve_strategy
@@ -391,6 +520,20 @@ struct transform
             strategy
         );
     }
+
+    template <typename Strategy>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2& geometry2,
+                             Strategy const& strategy,
+                             std::size_t threads)
+    {
+        return resolve_strategy::transform::apply(
+            geometry1,
+            geometry2,
+            strategy,
+            threads
+        );
+    }
 };
 
 template <BOOST_VARIANT_ENUM_PARAMS(typename T), typename Geometry2>
@@ -418,6 +561,32 @@ struct transform<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>, Geometry2>
         }
     };
 
+    template <typename Strategy>
+    struct visitor_threads: static_visitor<bool>
+    {
+        Geometry2& m_geometry2;
+        Strategy const& m_strategy;
+        std::size_t m_threads;
+
+        visitor_threads(Geometry2& geometry2, Strategy const& strategy,
+                        std::size_t threads)
+            : m_geometry2(geometry2)
+            , m_strategy(strategy)
+            , m_threads(threads)
+        {}
+
+        template <typename Geometry1>
+        inline bool operator()(Geometry1 const& geometry1) const
+        {
+            return transform<Geometry1, Geometry2>::apply(
+                geometry1,
+                m_geometry2,
+                m_strategy,
+                m_threads
+            );
+        }
+    };
+
     template <typename Strategy>
     static inline bool apply(
         boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry1,
@@ -427,6 +596,19 @@ struct transform<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>, Geometry2>
     {
         return boost::apply_visitor(visitor<Strategy>(geometry2, strategy), geometry1);
     }
+
+    template <typename Strategy>
+    static inline bool apply(
+        boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry1,
+        Geometry2& geometry2,
+        Strategy const& strategy,
+        std::size_t threads
+    )
+    {
+        return boost::apply_visitor(
+            visitor_threads<Strategy>(geometry2, strategy, threads),
+            geometry1);
+    }
 };
 
 } // namespace resolve_variant
@@ -456,6 +638,38 @@ inline bool transform(Geometry1 const& geometry1, Geometry2& geometry2,
 }
 
 
+/*!
+\brief Transforms from one geometry to another geometry  \brief_strategy
+\ingroup transform
+\details The points of multi geometries, polygons and long ranges are
+    divided over the specified number of threads. The strategy has to be
+    safe to call concurrently and the ranges of points have to be random
+    access ranges. If a point cannot be transformed false is returned and
+    the content of geometry2 is undefined, as in the sequential version.
+    For any number of threads, geometry2 is modified as by the sequential
+    version: points of (multi) linestrings and rings are appended to the
+    output ranges, polygons and multi points are replaced.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Strategy strategy
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param strategy The strategy to be used for transformation
+\param threads The number of threads to be used, 0 means as many as the
+    hardware supports
+\return True if the transformation could be done
+
+\qbk{distinguish,with strategy and number of threads}
+ */
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline bool transform(Geometry1 const& geometry1, Geometry2& geometry2,
+            Strategy const& strategy, std::size_t threads)
+{
+    return resolve_variant::transform<Geometry1, Geometry2>
+                          ::apply(geometry1, geometry2, strategy, threads);
+}
+
+
 /*!
 \brief Transforms from one geometry to another geometry using a strategy
 \ingroup transform
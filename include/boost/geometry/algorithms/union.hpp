@@ -255,11 +255,11 @@ struct union_
     {
         typedef typename boost::range_value<Collection>::type geometry_out;
 
-        typedef typename geometry::rescale_overlay_policy_type
+        typedef typename geometry::rescale_overlay_policy_type_for_strategy
             <
                 Geometry1,
                 Geometry2,
-                typename Strategy::cs_tag
+                Strategy
             >::type rescale_policy_type;
 
         rescale_policy_type robust_policy
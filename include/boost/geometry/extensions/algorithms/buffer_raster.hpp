@@ -0,0 +1,798 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_BUFFER_RASTER_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_BUFFER_RASTER_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <boost/range.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/for_each.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/default_area_result.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Raster of square cells, each of them is inside or outside
+\details The cell (x, y) is centered at
+    min_corner + ((x + 0.5) * cell_size, (y + 0.5) * cell_size)
+\tparam Point point type of the minimal corner, the coordinate type is used
+    for the cell size
+*/
+template <typename Point>
+class raster_mask
+{
+public :
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    raster_mask()
+        : m_cell_size(1)
+        , m_width(0)
+        , m_height(0)
+    {}
+
+    //! Resets the raster to the specified size, all cells are outside
+    inline void assign(Point const& min_corner, coordinate_type const& cell_size,
+                       std::size_t width, std::size_t height)
+    {
+        m_min_corner = min_corner;
+        m_cell_size = cell_size;
+        m_width = width;
+        m_height = height;
+        m_cells.assign(width * height, 0);
+    }
+
+    inline Point const& min_corner() const { return m_min_corner; }
+    inline coordinate_type const& cell_size() const { return m_cell_size; }
+    inline std::size_t width() const { return m_width; }
+    inline std::size_t height() const { return m_height; }
+
+    inline bool get(std::size_t x, std::size_t y) const
+    {
+        return m_cells[y * m_width + x] != 0;
+    }
+
+    inline void set(std::size_t x, std::size_t y, bool value)
+    {
+        m_cells[y * m_width + x] = value ? 1 : 0;
+    }
+
+    //! Returns true if the point is located in a cell which is inside
+    template <typename P>
+    inline bool covers(P const& point) const
+    {
+        coordinate_type const x
+            = (geometry::get<0>(point) - geometry::get<0>(m_min_corner)) / m_cell_size;
+        coordinate_type const y
+            = (geometry::get<1>(point) - geometry::get<1>(m_min_corner)) / m_cell_size;
+        if (! (x >= 0 && y >= 0
+               && x < coordinate_type(m_width)
+               && y < coordinate_type(m_height)))
+        {
+            return false;
+        }
+        return get(static_cast<std::size_t>(x), static_cast<std::size_t>(y));
+    }
+
+private :
+    Point m_min_corner;
+    coordinate_type m_cell_size;
+    std::size_t m_width;
+    std::size_t m_height;
+    std::vector<unsigned char> m_cells;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer_raster
+{
+
+
+// Marks the cells containing the vertices and the segments of a geometry,
+// the segments are sampled with half the cell size
+template <typename Point>
+struct mark_cells
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    explicit mark_cells(raster_mask<Point>& mask)
+        : m_mask(&mask)
+    {}
+
+    template <typename P>
+    inline void operator()(P const& point)
+    {
+        mark(geometry::get<0>(point), geometry::get<1>(point));
+    }
+
+    template <typename Segment>
+    inline void segment(Segment const& s)
+    {
+        coordinate_type const x0 = geometry::get<0, 0>(s);
+        coordinate_type const y0 = geometry::get<0, 1>(s);
+        coordinate_type const dx = geometry::get<1, 0>(s) - x0;
+        coordinate_type const dy = geometry::get<1, 1>(s) - y0;
+        coordinate_type const length
+            = (std::max)(geometry::math::abs(dx), geometry::math::abs(dy));
+        std::size_t const steps = static_cast<std::size_t>(
+                std::ceil(2 * length / m_mask->cell_size()));
+        for (std::size_t i = 0; i <= steps; i++)
+        {
+            coordinate_type const f = steps == 0 ? 0
+                : coordinate_type(i) / coordinate_type(steps);
+            mark(x0 + f * dx, y0 + f * dy);
+        }
+    }
+
+    inline void mark(coordinate_type const& x, coordinate_type const& y)
+    {
+        Point const& min_corner = m_mask->min_corner();
+        coordinate_type const cx = (x - geometry::get<0>(min_corner)) / m_mask->cell_size();
+        coordinate_type const cy = (y - geometry::get<1>(min_corner)) / m_mask->cell_size();
+        if (cx >= 0 && cy >= 0
+            && cx < coordinate_type(m_mask->width())
+            && cy < coordinate_type(m_mask->height()))
+        {
+            m_mask->set(static_cast<std::size_t>(cx),
+                        static_cast<std::size_t>(cy), true);
+        }
+    }
+
+    raster_mask<Point>* m_mask;
+};
+
+template <typename Point>
+struct mark_segment_cells
+{
+    explicit mark_segment_cells(mark_cells<Point>& marker)
+        : m_marker(&marker)
+    {}
+
+    template <typename Segment>
+    inline void operator()(Segment const& s)
+    {
+        m_marker->segment(s);
+    }
+
+    mark_cells<Point>* m_marker;
+};
+
+// Collects, per row of the raster, the x-coordinates where the segments
+// cross the horizontal line through the cell centers of that row
+template <typename Point>
+struct collect_crossings
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    collect_crossings(raster_mask<Point> const& mask,
+                      std::vector<std::vector<coordinate_type> >& rows)
+        : m_mask(&mask)
+        , m_rows(&rows)
+    {}
+
+    template <typename Segment>
+    inline void operator()(Segment const& s)
+    {
+        coordinate_type const cell_size = m_mask->cell_size();
+        coordinate_type const min_y = geometry::get<1>(m_mask->min_corner());
+
+        coordinate_type const x0 = geometry::get<0, 0>(s);
+        coordinate_type const y0 = geometry::get<0, 1>(s);
+        coordinate_type const x1 = geometry::get<1, 0>(s);
+        coordinate_type const y1 = geometry::get<1, 1>(s);
+        if (y0 == y1)
+        {
+            return;
+        }
+
+        // Rows with y0 <= center < y1 (or reversed), half-open such that
+        // vertices are counted once
+        coordinate_type const low = (std::min)(y0, y1);
+        coordinate_type const high = (std::max)(y0, y1);
+        coordinate_type const first = std::ceil((low - min_y) / cell_size - 0.5);
+        coordinate_type const last = std::ceil((high - min_y) / cell_size - 0.5);
+        for (coordinate_type r = (std::max)(first, coordinate_type(0));
+             r < last && r < coordinate_type(m_rows->size()); r += 1)
+        {
+            coordinate_type const y = min_y + (r + 0.5) * cell_size;
+            (*m_rows)[static_cast<std::size_t>(r)].push_back(
+                    x0 + (y - y0) * (x1 - x0) / (y1 - y0));
+        }
+    }
+
+    raster_mask<Point> const* m_mask;
+    std::vector<std::vector<coordinate_type> >* m_rows;
+};
+
+// Marks the cells whose centers are inside the areal geometry, using the
+// even-odd rule on the crossings of each row
+template <typename Point, typename Geometry>
+inline void fill_interior(Geometry const& geometry, raster_mask<Point>& mask)
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    std::vector<std::vector<coordinate_type> > rows(mask.height());
+    geometry::for_each_segment(geometry,
+            collect_crossings<Point>(mask, rows));
+
+    coordinate_type const min_x = geometry::get<0>(mask.min_corner());
+    for (std::size_t y = 0; y < rows.size(); y++)
+    {
+        std::vector<coordinate_type>& xs = rows[y];
+        std::sort(xs.begin(), xs.end());
+        for (std::size_t i = 0; i + 1 < xs.size(); i += 2)
+        {
+            coordinate_type const first = std::ceil(
+                    (xs[i] - min_x) / mask.cell_size() - 0.5);
+            coordinate_type const last = std::floor(
+                    (xs[i + 1] - min_x) / mask.cell_size() - 0.5);
+            for (coordinate_type x = (std::max)(first, coordinate_type(0));
+                 x <= last && x < coordinate_type(mask.width()); x += 1)
+            {
+                mask.set(static_cast<std::size_t>(x), y, true);
+            }
+        }
+    }
+}
+
+// One-dimensional squared Euclidean distance transform of sampled function f
+// (Felzenszwalb and Huttenlocher, "Distance Transforms of Sampled
+// Functions", 2012)
+template <typename T>
+inline void distance_transform_1d(std::vector<T> const& f, std::vector<T>& d,
+                                  std::vector<std::size_t>& v,
+                                  std::vector<T>& z)
+{
+    std::size_t const n = f.size();
+    v.resize(n);
+    z.resize(n + 1);
+    d.resize(n);
+
+    std::size_t k = 0;
+    v[0] = 0;
+    z[0] = -std::numeric_limits<T>::max();
+    z[1] = std::numeric_limits<T>::max();
+    for (std::size_t q = 1; q < n; q++)
+    {
+        T const tq = T(q);
+        T s;
+        for (;;)
+        {
+            T const tv = T(v[k]);
+            s = ((f[q] + tq * tq) - (f[v[k]] + tv * tv)) / (2 * tq - 2 * tv);
+            if (s > z[k] || k == 0)
+            {
+                break;
+            }
+            k--;
+        }
+        if (s <= z[k])
+        {
+            // Only possible for k == 0: q replaces the first parabola
+            v[0] = q;
+            z[0] = -std::numeric_limits<T>::max();
+            z[1] = std::numeric_limits<T>::max();
+            continue;
+        }
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = std::numeric_limits<T>::max();
+    }
+
+    k = 0;
+    for (std::size_t q = 0; q < n; q++)
+    {
+        while (z[k + 1] < T(q))
+        {
+            k++;
+        }
+        T const diff = T(q) - T(v[k]);
+        d[q] = diff * diff + f[v[k]];
+    }
+}
+
+// Returns the squared distance (in cells) of each cell to the nearest cell
+// for which feature returns true
+template <typename T, typename Point>
+inline void distance_transform(raster_mask<Point> const& mask, bool feature,
+                               std::vector<T>& result)
+{
+    std::size_t const width = mask.width();
+    std::size_t const height = mask.height();
+
+    // Larger than any squared distance in the raster, but finite
+    T const infinity = T(width) * T(width) + T(height) * T(height) + 1;
+
+    result.resize(width * height);
+
+    std::vector<T> f, d, z;
+    std::vector<std::size_t> v;
+
+    f.resize(height);
+    for (std::size_t x = 0; x < width; x++)
+    {
+        for (std::size_t y = 0; y < height; y++)
+        {
+            f[y] = mask.get(x, y) == feature ? T(0) : infinity;
+        }
+        distance_transform_1d(f, d, v, z);
+        for (std::size_t y = 0; y < height; y++)
+        {
+            result[y * width + x] = d[y];
+        }
+    }
+
+    f.resize(width);
+    for (std::size_t y = 0; y < height; y++)
+    {
+        std::copy(result.begin() + y * width,
+                  result.begin() + (y + 1) * width, f.begin());
+        distance_transform_1d(f, d, v, z);
+        std::copy(d.begin(), d.end(), result.begin() + y * width);
+    }
+}
+
+
+// Identifies the edges between horizontally (even) or vertically (odd)
+// neighbouring cell centers. The marching squares vertices are their
+// midpoints.
+struct cell_edges
+{
+    explicit cell_edges(std::size_t width)
+        : m_width(width)
+    {}
+
+    inline std::size_t horizontal(std::size_t x, std::size_t y) const
+    {
+        return 2 * (y * m_width + x);
+    }
+
+    inline std::size_t vertical(std::size_t x, std::size_t y) const
+    {
+        return 2 * (y * m_width + x) + 1;
+    }
+
+    template <typename Point, typename Mask>
+    inline Point midpoint(std::size_t edge, Mask const& mask) const
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+        std::size_t const cell = edge / 2;
+        coordinate_type const x = coordinate_type(cell % m_width);
+        coordinate_type const y = coordinate_type(cell / m_width);
+        bool const is_horizontal = edge % 2 == 0;
+        coordinate_type const cs = mask.cell_size();
+
+        Point result;
+        geometry::set<0>(result, geometry::get<0>(mask.min_corner())
+                + (is_horizontal ? x + 1 : x + 0.5) * cs);
+        geometry::set<1>(result, geometry::get<1>(mask.min_corner())
+                + (is_horizontal ? y + 0.5 : y + 1) * cs);
+        return result;
+    }
+
+    std::size_t m_width;
+};
+
+
+// Envelope of a ring, partitioned to find the outer ring of holes
+template <typename Box>
+struct ring_envelope
+{
+    Box envelope;
+    std::size_t index;
+};
+
+struct ring_envelope_expand
+{
+    template <typename Box, typename Item>
+    static inline void apply(Box& total, Item const& item)
+    {
+        geometry::expand(total, item.envelope);
+    }
+};
+
+struct ring_envelope_overlaps
+{
+    template <typename Box, typename Item>
+    static inline bool apply(Box const& box, Item const& item)
+    {
+        return ! geometry::disjoint(box, item.envelope);
+    }
+};
+
+// Selects for each hole the outer ring with the smallest area containing it
+template <typename Rings, typename Areas>
+struct assign_holes_visitor
+{
+    assign_holes_visitor(Rings const& outers, Areas const& areas,
+                         Rings const& holes, std::vector<std::size_t>& parents)
+        : m_outers(outers)
+        , m_areas(areas)
+        , m_holes(holes)
+        , m_parents(parents)
+    {}
+
+    template <typename Item>
+    inline bool apply(Item const& outer, Item const& hole)
+    {
+        std::size_t& parent = m_parents[hole.index];
+        if ((parent == m_outers.size()
+                || m_areas[outer.index] < m_areas[parent])
+            && geometry::covered_by(range::front(m_holes[hole.index]),
+                                    m_outers[outer.index]))
+        {
+            parent = outer.index;
+        }
+        return true;
+    }
+
+    Rings const& m_outers;
+    Areas const& m_areas;
+    Rings const& m_holes;
+    std::vector<std::size_t>& m_parents;
+};
+
+template <typename Box, typename Rings>
+inline void fill_envelopes(Rings const& rings,
+                           std::vector<ring_envelope<Box> >& items)
+{
+    items.resize(rings.size());
+    for (std::size_t i = 0; i < rings.size(); i++)
+    {
+        geometry::envelope(rings[i], items[i].envelope);
+        items[i].index = i;
+    }
+}
+
+
+}} // namespace detail::buffer_raster
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Calculates an approximate buffer of a geometry as a raster mask
+\details The geometry is rasterized: cells whose center is inside an areal
+    geometry, and cells containing a vertex or a part of a segment, are
+    marked. The exact Euclidean distance transform of that raster gives for
+    each cell the distance of its center to the nearest marked cell center.
+    Cells with a distance not larger than the buffer distance are inside the
+    mask. For a negative distance, areal geometries are deflated in the same
+    way, using the distance to the nearest unmarked cell. The result is
+    accurate to about one cell size, the costs depend on the number of cells
+    and not on the complexity of the buffer.
+\tparam Geometry \tparam_geometry
+\tparam Point point type of the raster mask
+\tparam DistanceStrategy A strategy defining distance (or radius), its
+    distance at the left side is used for the whole geometry
+\param geometry \param_geometry
+\param mask the raster mask, it covers the envelope of the buffer and a
+    margin of two cells
+\param distance_strategy The distance strategy to be used
+\param cell_size The size of the cells of the raster
+*/
+template <typename Geometry, typename Point, typename DistanceStrategy>
+inline void buffer_raster_mask(Geometry const& geometry,
+        raster_mask<Point>& mask,
+        DistanceStrategy const& distance_strategy,
+        typename coordinate_type<Point>::type const& cell_size)
+{
+    concepts::check<Geometry const>();
+
+    typedef typename coordinate_type<Point>::type coordinate_type;
+    typedef typename geometry::point_type<Geometry>::type point_type;
+
+    if (! (cell_size > 0))
+    {
+        BOOST_THROW_EXCEPTION(invalid_input_exception());
+    }
+
+    mask.assign(Point(), cell_size, 0, 0);
+    if (geometry::is_empty(geometry))
+    {
+        return;
+    }
+
+    bool const areal = boost::is_same
+        <
+            typename tag_cast<typename tag<Geometry>::type, areal_tag>::type,
+            areal_tag
+        >::value;
+
+    model::box<point_type> box;
+    geometry::envelope(geometry, box);
+
+    // The distance strategy returns the absolute distance
+    point_type const& min_corner = box.min_corner();
+    bool const deflate = distance_strategy.negative();
+    coordinate_type const distance = distance_strategy.apply(
+            min_corner, min_corner, strategy::buffer::buffer_side_left);
+    if (deflate && ! areal)
+    {
+        return;
+    }
+
+    coordinate_type const margin
+        = (deflate ? coordinate_type(0) : distance) + 2 * cell_size;
+    Point origin;
+    geometry::set<0>(origin, geometry::get<0>(min_corner) - margin);
+    geometry::set<1>(origin, geometry::get<1>(min_corner) - margin);
+
+    std::size_t const width = static_cast<std::size_t>(std::ceil(
+            (geometry::get<max_corner, 0>(box) - geometry::get<0>(min_corner)
+             + 2 * margin) / cell_size)) + 1;
+    std::size_t const height = static_cast<std::size_t>(std::ceil(
+            (geometry::get<max_corner, 1>(box) - geometry::get<1>(min_corner)
+             + 2 * margin) / cell_size)) + 1;
+    mask.assign(origin, cell_size, width, height);
+
+    if (BOOST_GEOMETRY_CONDITION(areal))
+    {
+        detail::buffer_raster::fill_interior(geometry, mask);
+    }
+    detail::buffer_raster::mark_cells<Point> marker(mask);
+    geometry::for_each_point(geometry, marker);
+    geometry::for_each_segment(geometry,
+            detail::buffer_raster::mark_segment_cells<Point>(marker));
+
+    // Squared distances in cell units
+    coordinate_type const limit = distance / cell_size;
+    coordinate_type const squared_limit = limit * limit;
+
+    std::vector<coordinate_type> squared_distances;
+    if (! deflate)
+    {
+        detail::buffer_raster::distance_transform(mask, true,
+                                                  squared_distances);
+        for (std::size_t y = 0; y < height; y++)
+        {
+            for (std::size_t x = 0; x < width; x++)
+            {
+                mask.set(x, y, squared_distances[y * width + x] <= squared_limit);
+            }
+        }
+    }
+    else
+    {
+        detail::buffer_raster::distance_transform(mask, false,
+                                                  squared_distances);
+        for (std::size_t y = 0; y < height; y++)
+        {
+            for (std::size_t x = 0; x < width; x++)
+            {
+                mask.set(x, y, squared_distances[y * width + x] > squared_limit);
+            }
+        }
+    }
+}
+
+
+/*!
+\brief Converts a raster mask to polygons, using marching squares
+\details The vertices of the polygons are the midpoints between the centers
+    of neighbouring cells where one cell is inside and the other is outside.
+    Diagonally neighbouring cells which are inside are connected.
+\tparam Point point type of the raster mask
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\param mask the raster mask, its border cells should be outside
+\param multi_polygon output multi polygon
+*/
+template <typename Point, typename MultiPolygon>
+inline void raster_to_polygons(raster_mask<Point> const& mask,
+                               MultiPolygon& multi_polygon)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename geometry::point_type<polygon_type>::type point_type;
+    typedef model::ring<point_type, false> ring_type;
+    typedef model::box<point_type> box_type;
+
+    concepts::check<polygon_type>();
+
+    geometry::clear(multi_polygon);
+
+    std::size_t const width = mask.width();
+    std::size_t const height = mask.height();
+    if (width < 2 || height < 2)
+    {
+        return;
+    }
+
+    detail::buffer_raster::cell_edges const edges(width);
+    std::size_t const none = 2 * width * height;
+    std::vector<std::size_t> next(2 * width * height, none);
+
+    // Directed segments per square of four cell centers, with the inside
+    // at the left side. Corners: 1 bottom left, 2 bottom right, 4 top right,
+    // 8 top left. Square sides: bottom, right, top, left.
+    static int const segments[16][4] =
+    {
+        { -1, -1, -1, -1 }, // 0
+        {  0,  3, -1, -1 }, // 1: bottom to left
+        {  1,  0, -1, -1 }, // 2: right to bottom
+        {  1,  3, -1, -1 }, // 3: right to left
+        {  2,  1, -1, -1 }, // 4: top to right
+        {  0,  1,  2,  3 }, // 5: bottom to right, top to left
+        {  2,  0, -1, -1 }, // 6: top to bottom
+        {  2,  3, -1, -1 }, // 7: top to left
+        {  3,  2, -1, -1 }, // 8: left to top
+        {  0,  2, -1, -1 }, // 9: bottom to top
+        {  3,  0,  1,  2 }, // 10: left to bottom, right to top
+        {  1,  2, -1, -1 }, // 11: right to top
+        {  3,  1, -1, -1 }, // 12: left to right
+        {  0,  1, -1, -1 }, // 13: bottom to right
+        {  3,  0, -1, -1 }, // 14: left to bottom
+        { -1, -1, -1, -1 }  // 15
+    };
+
+    for (std::size_t y = 0; y + 1 < height; y++)
+    {
+        for (std::size_t x = 0; x + 1 < width; x++)
+        {
+            int const index = (mask.get(x, y) ? 1 : 0)
+                + (mask.get(x + 1, y) ? 2 : 0)
+                + (mask.get(x + 1, y + 1) ? 4 : 0)
+                + (mask.get(x, y + 1) ? 8 : 0);
+
+            std::size_t const sides[4] =
+            {
+                edges.horizontal(x, y),
+                edges.vertical(x + 1, y),
+                edges.horizontal(x, y + 1),
+                edges.vertical(x, y)
+            };
+
+            for (int i = 0; i < 4 && segments[index][i] >= 0; i += 2)
+            {
+                next[sides[segments[index][i]]] = sides[segments[index][i + 1]];
+            }
+        }
+    }
+
+    // Trace the rings, outer rings are counter clockwise and holes clockwise
+    std::vector<ring_type> outers, holes;
+    for (std::size_t start = 0; start < next.size(); start++)
+    {
+        if (next[start] == none)
+        {
+            continue;
+        }
+
+        ring_type ring;
+        std::size_t edge = start;
+        while (next[edge] != none)
+        {
+            range::push_back(ring, edges.midpoint<point_type>(edge, mask));
+            std::size_t const following = next[edge];
+            next[edge] = none;
+            edge = following;
+        }
+        range::push_back(ring, range::front(ring));
+
+        if (geometry::area(ring) > 0)
+        {
+            outers.push_back(ring);
+        }
+        else
+        {
+            holes.push_back(ring);
+        }
+    }
+
+    typedef typename geometry::default_area_result<ring_type>::type area_type;
+    std::vector<polygon_type> polygons(outers.size());
+    std::vector<area_type> areas(outers.size());
+    for (std::size_t i = 0; i < outers.size(); i++)
+    {
+        areas[i] = geometry::area(outers[i]);
+        std::copy(boost::begin(outers[i]), boost::end(outers[i]),
+                  range::back_inserter(geometry::exterior_ring(polygons[i])));
+    }
+
+    // Assign each hole to the smallest outer ring containing it, only
+    // outer rings with envelopes overlapping the envelope of the hole are
+    // checked
+    std::vector<detail::buffer_raster::ring_envelope<box_type> > outer_items, hole_items;
+    detail::buffer_raster::fill_envelopes(outers, outer_items);
+    detail::buffer_raster::fill_envelopes(holes, hole_items);
+
+    std::vector<std::size_t> parents(holes.size(), outers.size());
+    detail::buffer_raster::assign_holes_visitor
+        <
+            std::vector<ring_type>, std::vector<area_type>
+        > visitor(outers, areas, holes, parents);
+    geometry::partition
+        <
+            box_type
+        >::apply(outer_items, hole_items, visitor,
+                 detail::buffer_raster::ring_envelope_expand(),
+                 detail::buffer_raster::ring_envelope_overlaps());
+
+    for (std::size_t h = 0; h < holes.size(); h++)
+    {
+        if (parents[h] < outers.size())
+        {
+            typename geometry::ring_type<polygon_type>::type hole;
+            std::copy(boost::begin(holes[h]), boost::end(holes[h]),
+                      range::back_inserter(hole));
+            range::push_back(geometry::interior_rings(polygons[parents[h]]), hole);
+        }
+    }
+
+    for (std::size_t i = 0; i < polygons.size(); i++)
+    {
+        geometry::correct(polygons[i]);
+        range::push_back(multi_polygon, polygons[i]);
+    }
+}
+
+
+/*!
+\brief Calculates an approximate buffer of a geometry as polygons
+\details The geometry is buffered into a raster mask (see
+    buffer_raster_mask) and the mask is converted to polygons (see
+    raster_to_polygons)
+\tparam Geometry \tparam_geometry
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\tparam DistanceStrategy A strategy defining distance (or radius)
+\param geometry \param_geometry
+\param multi_polygon output multi polygon
+\param distance_strategy The distance strategy to be used
+\param cell_size The size of the cells of the raster
+*/
+template <typename Geometry, typename MultiPolygon, typename DistanceStrategy>
+inline void buffer_raster(Geometry const& geometry,
+        MultiPolygon& multi_polygon,
+        DistanceStrategy const& distance_strategy,
+        typename coordinate_type<MultiPolygon>::type const& cell_size)
+{
+    typedef typename geometry::point_type<MultiPolygon>::type point_type;
+
+    raster_mask<point_type> mask;
+    buffer_raster_mask(geometry, mask, distance_strategy, cell_size);
+    raster_to_polygons(mask, multi_polygon);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_BUFFER_RASTER_HPP
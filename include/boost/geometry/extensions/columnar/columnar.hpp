@@ -0,0 +1,18 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_COLUMNAR_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_COLUMNAR_HPP
+
+
+#include <boost/geometry/extensions/columnar/geometries/array.hpp>
+#include <boost/geometry/extensions/columnar/geometries/buffers.hpp>
+#include <boost/geometry/extensions/columnar/geometries/multi.hpp>
+#include <boost/geometry/extensions/columnar/geometries/point_range.hpp>
+#include <boost/geometry/extensions/columnar/geometries/polygon.hpp>
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_COLUMNAR_HPP
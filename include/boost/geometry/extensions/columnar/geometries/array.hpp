@@ -0,0 +1,225 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_ARRAY_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_ARRAY_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/extensions/columnar/geometries/buffers.hpp>
+#include <boost/geometry/extensions/columnar/geometries/multi.hpp>
+#include <boost/geometry/extensions/columnar/geometries/point_range.hpp>
+#include <boost/geometry/extensions/columnar/geometries/polygon.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace columnar
+{
+
+template <typename Range, typename Buffers, typename Offset>
+inline Range make_point_range(Buffers const& buffers, Offset first, Offset last)
+{
+    return Range(buffers.coordinates + std::size_t(first) * dimension<Range>::value,
+                 std::size_t(last - first));
+}
+
+template <typename T>
+inline T const* data(std::vector<T> const& vector)
+{
+    return vector.empty() ? NULL : &vector[0];
+}
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct storage
+    : not_implemented<Geometry>
+{};
+
+// Linestrings and multi points refer to the coordinates directly
+template <typename Geometry>
+struct point_range_storage
+{
+    template <typename Buffers, typename Offset>
+    inline void build(Buffers const& buffers, Offset const* offsets,
+                      std::size_t count, std::vector<Geometry>& geometries)
+    {
+        geometries.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            geometries.push_back(make_point_range<Geometry>(buffers,
+                                    offsets[i], offsets[i + 1]));
+        }
+    }
+};
+
+// Polygons and multi linestrings refer to the views of their rings
+// or linestrings, all of them are created at once
+template <typename Geometry, typename Range>
+struct ring_storage
+{
+    std::vector<Range> ranges;
+
+    template <typename Buffers, typename Offset>
+    inline void build(Buffers const& buffers, Offset const* offsets,
+                      std::size_t count, std::vector<Geometry>& geometries)
+    {
+        Offset const first = offsets[0];
+        build_ranges(buffers, first, offsets[count]);
+
+        geometries.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            geometries.push_back(Geometry(data(ranges) + (offsets[i] - first),
+                                          std::size_t(offsets[i + 1] - offsets[i])));
+        }
+    }
+
+    template <typename Buffers, typename Offset>
+    inline void build_ranges(Buffers const& buffers, Offset first, Offset last)
+    {
+        ranges.reserve(std::size_t(last - first));
+        for (Offset i = first; i < last; i++)
+        {
+            ranges.push_back(make_point_range<Range>(buffers,
+                                buffers.ring_offsets[i], buffers.ring_offsets[i + 1]));
+        }
+    }
+};
+
+template <typename Geometry>
+struct storage<Geometry, linestring_tag>
+    : point_range_storage<Geometry>
+{};
+
+template <typename Geometry>
+struct storage<Geometry, multi_point_tag>
+    : point_range_storage<Geometry>
+{};
+
+template <typename Geometry>
+struct storage<Geometry, polygon_tag>
+    : ring_storage<Geometry, typename Geometry::ring_type>
+{};
+
+template <typename Geometry>
+struct storage<Geometry, multi_linestring_tag>
+    : ring_storage<Geometry, typename boost::range_value<Geometry>::type>
+{};
+
+template <typename Geometry>
+struct storage<Geometry, multi_polygon_tag>
+{
+    typedef typename boost::range_value<Geometry>::type polygon_type;
+
+    ring_storage<polygon_type, typename polygon_type::ring_type> rings;
+    std::vector<polygon_type> polygons;
+
+    template <typename Buffers, typename Offset>
+    inline void build(Buffers const& buffers, Offset const* offsets,
+                      std::size_t count, std::vector<Geometry>& geometries)
+    {
+        Offset const first = offsets[0];
+        rings.build(buffers, buffers.part_offsets + first,
+                    std::size_t(offsets[count] - first), polygons);
+
+        geometries.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            geometries.push_back(Geometry(data(polygons) + (offsets[i] - first),
+                                          std::size_t(offsets[i + 1] - offsets[i])));
+        }
+    }
+};
+
+}} // namespace detail::columnar
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace model
+{
+
+/*!
+\brief Read-only column of geometries stored in columnar buffers
+\details The geometry i consists of the elements [offsets[i], offsets[i + 1])
+    of its level, as the geometry offsets of a GeoArrow array.
+    Coordinates are not copied. Only the views of the rings and of the
+    polygons are created, in one vector per level, so that algorithms can
+    refer to them, the points are created when they are accessed.
+    The array refers to its views and cannot be copied.
+\tparam Geometry columnar geometry, e.g. columnar_polygon
+\tparam Offset type of the offsets, boost::int32_t or boost::int64_t
+\ingroup geometries
+*/
+template <typename Geometry, typename Offset = boost::int32_t>
+class columnar_array
+    : boost::noncopyable
+{
+    typedef std::vector<Geometry> container_type;
+
+public:
+    typedef Geometry value_type;
+    typedef Geometry const& reference;
+    typedef Geometry const& const_reference;
+    typedef columnar_buffers
+        <
+            typename geometry::point_type<Geometry>::type, Offset
+        > buffers_type;
+    typedef typename container_type::const_iterator iterator;
+    typedef typename container_type::const_iterator const_iterator;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    /*!
+    \brief Constructs the column of count geometries, the offsets
+        array has count + 1 elements
+    */
+    inline columnar_array(buffers_type const& buffers,
+                          Offset const* offsets, std::size_t count)
+    {
+        if (count > 0)
+        {
+            m_storage.build(buffers, offsets, count, m_geometries);
+        }
+    }
+
+    inline std::size_t size() const { return m_geometries.size(); }
+    inline bool empty() const { return m_geometries.empty(); }
+
+    inline const_iterator begin() const { return m_geometries.begin(); }
+    inline const_iterator end() const { return m_geometries.end(); }
+
+    inline Geometry const& operator[](std::size_t i) const { return m_geometries[i]; }
+    inline Geometry const& front() const { return m_geometries.front(); }
+    inline Geometry const& back() const { return m_geometries.back(); }
+
+private:
+    geometry::detail::columnar::storage<Geometry> m_storage;
+    container_type m_geometries;
+};
+
+} // namespace model
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_ARRAY_HPP
@@ -0,0 +1,171 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_BUFFERS_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_BUFFERS_HPP
+
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <boost/geometry/core/coordinate_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+namespace model
+{
+
+/*!
+\brief Buffers of a column of geometries in the GeoArrow layout
+\details Coordinates are interleaved (x y x y ...), with as many values per
+    point as the dimension of the point type. The offsets of each level
+    index the elements of the level below them, the geometry i of a level
+    consists of the elements [offsets[i], offsets[i + 1]).
+    - ring_offsets: points of linestrings and of rings
+    - part_offsets: rings of polygons of multi polygons
+    The offsets of the geometries of the column (the geometry offsets of
+    GeoArrow) are passed to columnar_array. The buffers are not copied,
+    they have to outlive the array.
+\tparam Point point type of the views
+\tparam Offset type of the offsets, boost::int32_t or boost::int64_t
+\ingroup geometries
+*/
+template <typename Point, typename Offset = boost::int32_t>
+struct columnar_buffers
+{
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+    typedef Offset offset_type;
+
+    inline columnar_buffers()
+        : coordinates(NULL)
+        , ring_offsets(NULL)
+        , part_offsets(NULL)
+    {}
+
+    inline explicit columnar_buffers(coordinate_type const* coordinates_,
+                                     Offset const* ring_offsets_ = NULL,
+                                     Offset const* part_offsets_ = NULL)
+        : coordinates(coordinates_)
+        , ring_offsets(ring_offsets_)
+        , part_offsets(part_offsets_)
+    {}
+
+    coordinate_type const* coordinates;
+    Offset const* ring_offsets;
+    Offset const* part_offsets;
+};
+
+} // namespace model
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace columnar
+{
+
+// Random access iterator over a view, elements are created when the
+// iterator is dereferenced (the reference type is the value type)
+template <typename View, typename Value>
+class index_iterator
+    : public boost::iterator_facade
+        <
+            index_iterator<View, Value>,
+            Value,
+            boost::random_access_traversal_tag,
+            Value
+        >
+{
+public:
+    inline index_iterator()
+        : m_index(0)
+    {}
+
+    inline index_iterator(View const& view, std::size_t index)
+        : m_view(view)
+        , m_index(index)
+    {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline Value dereference() const
+    {
+        return m_view[m_index];
+    }
+
+    inline bool equal(index_iterator const& other) const
+    {
+        return m_index == other.m_index;
+    }
+
+    inline void increment() { ++m_index; }
+    inline void decrement() { --m_index; }
+
+    inline void advance(std::ptrdiff_t n)
+    {
+        m_index = std::size_t(std::ptrdiff_t(m_index) + n);
+    }
+
+    inline std::ptrdiff_t distance_to(index_iterator const& other) const
+    {
+        return std::ptrdiff_t(other.m_index) - std::ptrdiff_t(m_index);
+    }
+
+    View m_view;
+    std::size_t m_index;
+};
+
+// Read-only range of consecutive views owned by columnar_array,
+// the elements are lvalues
+template <typename Geometry>
+class span
+{
+public:
+    typedef Geometry value_type;
+    typedef Geometry const& reference;
+    typedef Geometry const& const_reference;
+    typedef Geometry const* iterator;
+    typedef Geometry const* const_iterator;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    inline span()
+        : m_first(NULL)
+        , m_size(0)
+    {}
+
+    inline span(Geometry const* first, std::size_t size)
+        : m_first(first)
+        , m_size(size)
+    {}
+
+    inline std::size_t size() const { return m_size; }
+    inline bool empty() const { return m_size == 0; }
+
+    inline const_iterator begin() const { return m_first; }
+    inline const_iterator end() const { return m_first + m_size; }
+
+    inline Geometry const& operator[](std::size_t i) const { return m_first[i]; }
+    inline Geometry const& front() const { return m_first[0]; }
+    inline Geometry const& back() const { return m_first[m_size - 1]; }
+
+private:
+    Geometry const* m_first;
+    std::size_t m_size;
+};
+
+}} // namespace detail::columnar
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_BUFFERS_HPP
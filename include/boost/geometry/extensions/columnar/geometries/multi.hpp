@@ -0,0 +1,108 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_MULTI_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_MULTI_HPP
+
+
+#include <cstddef>
+
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/extensions/columnar/geometries/buffers.hpp>
+#include <boost/geometry/extensions/columnar/geometries/point_range.hpp>
+#include <boost/geometry/extensions/columnar/geometries/polygon.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace model
+{
+
+/*!
+\brief Read-only multi linestring of a columnar buffer
+\details The multi linestring refers to consecutive linestring views
+    owned by a columnar_array
+\ingroup geometries
+*/
+template <typename Point>
+class columnar_multi_linestring
+    : public geometry::detail::columnar::span<columnar_linestring<Point> >
+{
+    typedef geometry::detail::columnar::span<columnar_linestring<Point> > base_type;
+
+public:
+    inline columnar_multi_linestring()
+    {}
+
+    inline columnar_multi_linestring(columnar_linestring<Point> const* first,
+                                     std::size_t count)
+        : base_type(first, count)
+    {}
+};
+
+/*!
+\brief Read-only multi polygon of a columnar buffer
+\details The multi polygon refers to consecutive polygon views owned by
+    a columnar_array
+\ingroup geometries
+*/
+template
+<
+    typename Point,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class columnar_multi_polygon
+    : public geometry::detail::columnar::span
+        <
+            columnar_polygon<Point, ClockWise, Closed>
+        >
+{
+    typedef geometry::detail::columnar::span
+        <
+            columnar_polygon<Point, ClockWise, Closed>
+        > base_type;
+
+public:
+    inline columnar_multi_polygon()
+    {}
+
+    inline columnar_multi_polygon(columnar_polygon<Point, ClockWise, Closed> const* first,
+                                  std::size_t count)
+        : base_type(first, count)
+    {}
+};
+
+} // namespace model
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point>
+struct tag<model::columnar_multi_linestring<Point> >
+{
+    typedef multi_linestring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<model::columnar_multi_polygon<Point, ClockWise, Closed> >
+{
+    typedef multi_polygon_tag type;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_MULTI_HPP
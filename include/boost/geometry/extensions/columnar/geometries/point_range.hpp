@@ -0,0 +1,230 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_POINT_RANGE_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_POINT_RANGE_HPP
+
+
+#include <cstddef>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/point_concept.hpp>
+
+#include <boost/geometry/extensions/columnar/geometries/buffers.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace columnar
+{
+
+template <typename Point, std::size_t I = 0, std::size_t N = dimension<Point>::value>
+struct load_point
+{
+    template <typename T>
+    static inline void apply(T const* coordinates, Point& point)
+    {
+        geometry::set<I>(point, coordinates[I]);
+        load_point<Point, I + 1, N>::apply(coordinates, point);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct load_point<Point, N, N>
+{
+    template <typename T>
+    static inline void apply(T const*, Point&)
+    {}
+};
+
+// Range of consecutive points of the coordinates buffer
+template <typename Point>
+class point_range
+{
+    BOOST_CONCEPT_ASSERT( (concepts::Point<Point>) );
+
+public:
+    typedef Point value_type;
+    typedef Point reference;
+    typedef Point const_reference;
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+    typedef index_iterator<point_range, Point> iterator;
+    typedef iterator const_iterator;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    static const std::size_t point_size = dimension<Point>::value;
+
+    inline point_range()
+        : m_coordinates(NULL)
+        , m_size(0)
+    {}
+
+    inline point_range(coordinate_type const* coordinates, std::size_t size)
+        : m_coordinates(coordinates)
+        , m_size(size)
+    {}
+
+    inline std::size_t size() const { return m_size; }
+    inline bool empty() const { return m_size == 0; }
+
+    inline const_iterator begin() const { return const_iterator(*this, 0); }
+    inline const_iterator end() const { return const_iterator(*this, m_size); }
+
+    inline Point operator[](std::size_t i) const
+    {
+        Point point;
+        load_point<Point>::apply(m_coordinates + i * point_size, point);
+        return point;
+    }
+
+    inline Point front() const { return (*this)[0]; }
+    inline Point back() const { return (*this)[m_size - 1]; }
+
+    //! Coordinates of the points, interleaved
+    inline coordinate_type const* coordinates() const { return m_coordinates; }
+
+private:
+    coordinate_type const* m_coordinates;
+    std::size_t m_size;
+};
+
+}} // namespace detail::columnar
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace model
+{
+
+/*!
+\brief Read-only linestring of a columnar buffer
+\details Points are created when the range is accessed, algorithms read
+    the coordinates directly from the buffer.
+\tparam Point point type, its coordinate type and dimension are those of
+    the coordinates buffer
+\ingroup geometries
+*/
+template <typename Point>
+class columnar_linestring
+    : public geometry::detail::columnar::point_range<Point>
+{
+    typedef geometry::detail::columnar::point_range<Point> base_type;
+
+public:
+    typedef typename base_type::coordinate_type coordinate_type;
+
+    inline columnar_linestring()
+    {}
+
+    inline columnar_linestring(coordinate_type const* coordinates, std::size_t size)
+        : base_type(coordinates, size)
+    {}
+};
+
+/*!
+\brief Read-only ring of a columnar buffer
+\tparam Point point type
+\tparam ClockWise true for clockwise direction, false for CounterClockWise direction
+\tparam Closed true for closed rings, false for open rings
+\ingroup geometries
+*/
+template
+<
+    typename Point,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class columnar_ring
+    : public geometry::detail::columnar::point_range<Point>
+{
+    typedef geometry::detail::columnar::point_range<Point> base_type;
+
+public:
+    typedef typename base_type::coordinate_type coordinate_type;
+
+    inline columnar_ring()
+    {}
+
+    inline columnar_ring(coordinate_type const* coordinates, std::size_t size)
+        : base_type(coordinates, size)
+    {}
+};
+
+/*!
+\brief Read-only multi point of a columnar buffer
+\ingroup geometries
+*/
+template <typename Point>
+class columnar_multi_point
+    : public geometry::detail::columnar::point_range<Point>
+{
+    typedef geometry::detail::columnar::point_range<Point> base_type;
+
+public:
+    typedef typename base_type::coordinate_type coordinate_type;
+
+    inline columnar_multi_point()
+    {}
+
+    inline columnar_multi_point(coordinate_type const* coordinates, std::size_t size)
+        : base_type(coordinates, size)
+    {}
+};
+
+} // namespace model
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point>
+struct tag<model::columnar_linestring<Point> >
+{
+    typedef linestring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<model::columnar_ring<Point, ClockWise, Closed> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct point_order<model::columnar_ring<Point, ClockWise, Closed> >
+{
+    static const order_selector value = ClockWise ? clockwise : counterclockwise;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct closure<model::columnar_ring<Point, ClockWise, Closed> >
+{
+    static const closure_selector value = Closed ? closed : open;
+};
+
+template <typename Point>
+struct tag<model::columnar_multi_point<Point> >
+{
+    typedef multi_point_tag type;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_POINT_RANGE_HPP
@@ -0,0 +1,146 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_POLYGON_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_POLYGON_HPP
+
+
+#include <cstddef>
+
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/extensions/columnar/geometries/buffers.hpp>
+#include <boost/geometry/extensions/columnar/geometries/point_range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace model
+{
+
+/*!
+\brief Read-only polygon of a columnar buffer
+\details The polygon refers to consecutive ring views, the first one is
+    the exterior ring. The ring views are owned by a columnar_array.
+\tparam Point point type
+\tparam ClockWise true for clockwise direction, false for CounterClockWise direction
+\tparam Closed true for closed polygons, false for open polygons
+\ingroup geometries
+*/
+template
+<
+    typename Point,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class columnar_polygon
+{
+public:
+    typedef Point point_type;
+    typedef columnar_ring<Point, ClockWise, Closed> ring_type;
+    typedef geometry::detail::columnar::span<ring_type> inner_container_type;
+
+    inline columnar_polygon()
+    {}
+
+    inline columnar_polygon(ring_type const* rings, std::size_t count)
+        : m_outer(count > 0 ? rings[0] : ring_type())
+        , m_inners(rings + (count > 0 ? 1 : 0), count > 0 ? count - 1 : 0)
+    {}
+
+    inline ring_type const& outer() const { return m_outer; }
+    inline inner_container_type const& inners() const { return m_inners; }
+
+private:
+    ring_type m_outer;
+    inner_container_type m_inners;
+};
+
+} // namespace model
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef polygon_tag type;
+};
+
+// The polygon is read-only, the mutable types are the const types
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_const_type<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef typename model::columnar_polygon
+        <
+            Point, ClockWise, Closed
+        >::ring_type const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_mutable_type<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef typename model::columnar_polygon
+        <
+            Point, ClockWise, Closed
+        >::ring_type const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_const_type<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef typename model::columnar_polygon
+        <
+            Point, ClockWise, Closed
+        >::inner_container_type const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_mutable_type<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef typename model::columnar_polygon
+        <
+            Point, ClockWise, Closed
+        >::inner_container_type const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct exterior_ring<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef model::columnar_polygon<Point, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::ring_type const& get(polygon_type const& p)
+    {
+        return p.outer();
+    }
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_rings<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef model::columnar_polygon<Point, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::inner_container_type const& get(polygon_type const& p)
+    {
+        return p.inners();
+    }
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_COLUMNAR_GEOMETRIES_POLYGON_HPP
@@ -0,0 +1,15 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_COMPRESSED_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_COMPRESSED_HPP
+
+
+#include <boost/geometry/extensions/compressed/geometries/polygon.hpp>
+#include <boost/geometry/extensions/compressed/geometries/ring.hpp>
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_COMPRESSED_HPP
@@ -0,0 +1,80 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_DETAIL_VARINT_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_DETAIL_VARINT_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace compressed
+{
+
+// Deltas are computed modulo 2^32, so that the difference of any two
+// int32 values can be encoded and added again
+inline boost::uint32_t zigzag(boost::uint32_t delta)
+{
+    return (delta << 1) ^ (0u - (delta >> 31));
+}
+
+inline boost::uint32_t unzigzag(boost::uint32_t value)
+{
+    return (value >> 1) ^ (0u - (value & 1u));
+}
+
+// Little endian base 128: 7 bits per byte, the high bit is set in all
+// bytes but the last one of a value
+inline void put_varint(boost::uint32_t value, std::vector<boost::uint8_t>& bytes)
+{
+    while (value >= 0x80u)
+    {
+        bytes.push_back(static_cast<boost::uint8_t>(value | 0x80u));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<boost::uint8_t>(value));
+}
+
+inline boost::uint32_t get_varint(boost::uint8_t const*& it)
+{
+    boost::uint32_t value = 0;
+    int shift = 0;
+    while (*it >= 0x80u)
+    {
+        value |= boost::uint32_t(*it++ & 0x7Fu) << shift;
+        shift += 7;
+    }
+    value |= boost::uint32_t(*it++) << shift;
+    return value;
+}
+
+// Moves from the end of a value to its first byte
+inline void skip_varint_backward(boost::uint8_t const*& it,
+                                 boost::uint8_t const* first)
+{
+    --it;
+    while (it != first && it[-1] >= 0x80u)
+    {
+        --it;
+    }
+}
+
+}} // namespace detail::compressed
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_DETAIL_VARINT_HPP
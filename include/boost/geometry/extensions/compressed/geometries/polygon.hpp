@@ -0,0 +1,190 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_GEOMETRIES_POLYGON_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_GEOMETRIES_POLYGON_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/interior_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/extensions/compressed/geometries/ring.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace model
+{
+
+/*!
+\brief Polygon storing its rings as compressed_ring
+\details All rings have the same resolution. The polygon is built from
+    another polygon, the compressed rings are read-only.
+\tparam Point point type of the decoded points
+\tparam ClockWise true for clockwise direction, false for CounterClockWise direction
+\tparam Closed true for closed polygons, false for open polygons
+\ingroup geometries
+*/
+template
+<
+    typename Point,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class compressed_polygon
+{
+public:
+    typedef Point point_type;
+    typedef compressed_ring<Point, ClockWise, Closed> ring_type;
+    typedef std::vector<ring_type> inner_container_type;
+    typedef typename ring_type::coordinate_type coordinate_type;
+
+    inline compressed_polygon()
+    {}
+
+    /*!
+    \brief Constructs the polygon from the rings of another polygon
+    \param polygon polygon with the same point order and closure
+    \param resolution distance between quantized coordinates
+    */
+    template <typename Polygon>
+    inline explicit compressed_polygon(Polygon const& polygon,
+                                       coordinate_type const& resolution = coordinate_type(1))
+        : m_outer(geometry::exterior_ring(polygon), resolution)
+    {
+        typedef typename interior_return_type<Polygon const>::type interiors_type;
+        typedef typename boost::range_iterator
+            <
+                typename interior_type<Polygon const>::type
+            >::type iterator_type;
+
+        interiors_type interiors = geometry::interior_rings(polygon);
+        m_inners.reserve(boost::size(interiors));
+        for (iterator_type it = boost::begin(interiors); it != boost::end(interiors); ++it)
+        {
+            m_inners.push_back(ring_type(*it, resolution));
+        }
+    }
+
+    inline ring_type const& outer() const { return m_outer; }
+    inline inner_container_type const& inners() const { return m_inners; }
+
+    inline ring_type& outer() { return m_outer; }
+    inline inner_container_type& inners() { return m_inners; }
+
+    inline void clear()
+    {
+        m_outer.clear();
+        m_inners.clear();
+    }
+
+private:
+    ring_type m_outer;
+    inner_container_type m_inners;
+};
+
+} // namespace model
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<model::compressed_polygon<Point, ClockWise, Closed> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_const_type<model::compressed_polygon<Point, ClockWise, Closed> >
+{
+    typedef typename model::compressed_polygon
+        <
+            Point, ClockWise, Closed
+        >::ring_type const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_mutable_type<model::compressed_polygon<Point, ClockWise, Closed> >
+{
+    typedef typename model::compressed_polygon
+        <
+            Point, ClockWise, Closed
+        >::ring_type& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_const_type<model::compressed_polygon<Point, ClockWise, Closed> >
+{
+    typedef typename model::compressed_polygon
+        <
+            Point, ClockWise, Closed
+        >::inner_container_type const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_mutable_type<model::compressed_polygon<Point, ClockWise, Closed> >
+{
+    typedef typename model::compressed_polygon
+        <
+            Point, ClockWise, Closed
+        >::inner_container_type& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct exterior_ring<model::compressed_polygon<Point, ClockWise, Closed> >
+{
+    typedef model::compressed_polygon<Point, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::ring_type& get(polygon_type& p)
+    {
+        return p.outer();
+    }
+
+    static inline typename polygon_type::ring_type const& get(polygon_type const& p)
+    {
+        return p.outer();
+    }
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_rings<model::compressed_polygon<Point, ClockWise, Closed> >
+{
+    typedef model::compressed_polygon<Point, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::inner_container_type& get(polygon_type& p)
+    {
+        return p.inners();
+    }
+
+    static inline typename polygon_type::inner_container_type const& get(polygon_type const& p)
+    {
+        return p.inners();
+    }
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_GEOMETRIES_POLYGON_HPP
@@ -0,0 +1,490 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_GEOMETRIES_RING_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_GEOMETRIES_RING_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/concept/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/point_concept.hpp>
+#include <boost/geometry/util/math.hpp>
+
+#include <boost/geometry/extensions/compressed/detail/varint.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace compressed
+{
+
+template <typename Point, std::size_t I = 0, std::size_t N = dimension<Point>::value>
+struct quantize
+{
+    template <typename T>
+    static inline void apply(Point const& point, T const& resolution,
+                             boost::int32_t* q)
+    {
+        q[I] = math::rounding_cast<boost::int32_t>(geometry::get<I>(point) / resolution);
+        quantize<Point, I + 1, N>::apply(point, resolution, q);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct quantize<Point, N, N>
+{
+    template <typename T>
+    static inline void apply(Point const&, T const&, boost::int32_t*)
+    {}
+};
+
+template <typename Point, std::size_t I = 0, std::size_t N = dimension<Point>::value>
+struct dequantize
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    static inline void apply(boost::int32_t const* q,
+                             coordinate_type const& resolution, Point& point)
+    {
+        geometry::set<I>(point, coordinate_type(q[I]) * resolution);
+        dequantize<Point, I + 1, N>::apply(q, resolution, point);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct dequantize<Point, N, N>
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    static inline void apply(boost::int32_t const*, coordinate_type const&, Point&)
+    {}
+};
+
+// Iterator decoding the points of a compressed ring, the points are
+// created when the iterator is dereferenced. Points are decoded one by
+// one, other positions are reached from the preceding checkpoint.
+template <typename Ring>
+class delta_iterator
+    : public boost::iterator_facade
+        <
+            delta_iterator<Ring>,
+            typename Ring::value_type,
+            boost::random_access_traversal_tag,
+            typename Ring::value_type
+        >
+{
+    typedef typename Ring::value_type point_type;
+
+    static const std::size_t dimension_count = dimension<point_type>::value;
+
+public:
+    inline delta_iterator()
+        : m_ring(NULL)
+        , m_index(0)
+        , m_it(NULL)
+        , m_next(NULL)
+    {}
+
+    // Iterator at the point index, or after the last point
+    inline delta_iterator(Ring const& ring, std::size_t index)
+        : m_ring(&ring)
+        , m_index(0)
+        , m_it(NULL)
+        , m_next(NULL)
+    {
+        seek(index);
+    }
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline point_type dereference() const
+    {
+        point_type point;
+        dequantize<point_type>::apply(m_q, m_ring->resolution(), point);
+        return point;
+    }
+
+    inline bool equal(delta_iterator const& other) const
+    {
+        return m_index == other.m_index;
+    }
+
+    inline std::ptrdiff_t distance_to(delta_iterator const& other) const
+    {
+        return std::ptrdiff_t(other.m_index) - std::ptrdiff_t(m_index);
+    }
+
+    inline void advance(std::ptrdiff_t n)
+    {
+        std::size_t const index = std::size_t(std::ptrdiff_t(m_index) + n);
+        if (n >= 0 && n < std::ptrdiff_t(Ring::checkpoint_interval))
+        {
+            for ( ; n > 0; n--)
+            {
+                increment();
+            }
+        }
+        else if (n < 0 && -n < std::ptrdiff_t(Ring::checkpoint_interval))
+        {
+            for ( ; n < 0; n++)
+            {
+                decrement();
+            }
+        }
+        else
+        {
+            seek(index);
+        }
+    }
+
+    inline void increment()
+    {
+        m_it = m_next;
+        if (++m_index < m_ring->size())
+        {
+            load();
+        }
+    }
+
+    // The point before the current one is the current one minus the
+    // current delta, after the last point it is the stored last point
+    inline void decrement()
+    {
+        if (m_index == m_ring->size())
+        {
+            m_ring->last(m_q);
+        }
+        else
+        {
+            for (std::size_t d = 0; d < dimension_count; d++)
+            {
+                m_q[d] = boost::int32_t(boost::uint32_t(m_q[d]) - m_delta[d]);
+            }
+        }
+
+        m_next = m_it;
+        for (std::size_t d = 0; d < dimension_count; d++)
+        {
+            skip_varint_backward(m_it, m_ring->bytes());
+        }
+        --m_index;
+
+        boost::uint8_t const* it = m_it;
+        for (std::size_t d = 0; d < dimension_count; d++)
+        {
+            m_delta[d] = unzigzag(get_varint(it));
+        }
+    }
+
+    // Starts at the checkpoint preceding the point index and decodes
+    // the points up to it
+    inline void seek(std::size_t index)
+    {
+        for (std::size_t d = 0; d < dimension_count; d++)
+        {
+            m_delta[d] = 0;
+        }
+
+        if (index >= m_ring->size())
+        {
+            m_index = m_ring->size();
+            m_it = m_ring->bytes() + m_ring->byte_count();
+            m_next = m_it;
+            m_ring->last(m_q);
+            return;
+        }
+
+        std::size_t const checkpoint = index / Ring::checkpoint_interval;
+        m_index = checkpoint * Ring::checkpoint_interval;
+        m_it = m_ring->bytes() + m_ring->checkpoint(checkpoint, m_q);
+        load();
+        while (m_index < index)
+        {
+            increment();
+        }
+    }
+
+    // Reads the delta at the current position and adds it to the
+    // previous point
+    inline void load()
+    {
+        m_next = m_it;
+        for (std::size_t d = 0; d < dimension_count; d++)
+        {
+            m_delta[d] = unzigzag(get_varint(m_next));
+            m_q[d] = boost::int32_t(boost::uint32_t(m_q[d]) + m_delta[d]);
+        }
+    }
+
+    Ring const* m_ring;
+    std::size_t m_index;
+    boost::uint8_t const* m_it;
+    boost::uint8_t const* m_next;
+    boost::int32_t m_q[dimension_count];
+    boost::uint32_t m_delta[dimension_count];
+};
+
+}} // namespace detail::compressed
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace model
+{
+
+/*!
+\brief Ring storing its points as delta encoded, quantized coordinates
+\details Coordinates are quantized to int32 multiples of the resolution.
+    The first point is stored as it is and the next points as the
+    difference to the previous point, zigzag and varint encoded
+    (as the geometries of vector tiles). Points are decoded by the
+    iterators of the ring, so algorithms work directly on the compressed
+    points. The position of every 32nd point is stored, so that the
+    iterators are random access iterators.
+    Quantized coordinates have to be within the range of int32.
+\tparam Point point type of the decoded points
+\tparam ClockWise true for clockwise direction, false for CounterClockWise direction
+\tparam Closed true for closed rings, false for open rings
+\ingroup geometries
+*/
+template
+<
+    typename Point,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class compressed_ring
+{
+    BOOST_CONCEPT_ASSERT( (concepts::Point<Point>) );
+
+    static const std::size_t dimension_count = dimension<Point>::value;
+
+public:
+    static const std::size_t checkpoint_interval = 32;
+
+    typedef Point value_type;
+    typedef Point reference;
+    typedef Point const_reference;
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+    typedef geometry::detail::compressed::delta_iterator<compressed_ring> iterator;
+    typedef iterator const_iterator;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    inline compressed_ring()
+        : m_size(0)
+        , m_resolution(1)
+    {
+        clear_last();
+    }
+
+    /*!
+    \brief Constructs the ring from the points of a range
+    \param range range of points, in the order of the ring
+    \param resolution distance between quantized coordinates
+    */
+    template <typename Range>
+    inline explicit compressed_ring(Range const& range,
+                                    coordinate_type const& resolution = coordinate_type(1))
+        : m_size(0)
+        , m_resolution(resolution)
+    {
+        assign(range);
+    }
+
+    //! Replaces the points by the points of a range
+    template <typename Range>
+    inline void assign(Range const& range)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator_type;
+
+        clear();
+        for (iterator_type it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            push_back(*it);
+        }
+        shrink();
+    }
+
+    //! Appends a point
+    template <typename OtherPoint>
+    inline void push_back(OtherPoint const& point)
+    {
+        if (m_size % checkpoint_interval == 0)
+        {
+            m_checkpoints.push_back(boost::int32_t(m_bytes.size()));
+            m_checkpoints.insert(m_checkpoints.end(), m_last, m_last + dimension_count);
+        }
+
+        boost::int32_t q[dimension_count];
+        geometry::detail::compressed::quantize<OtherPoint>::apply(point, m_resolution, q);
+        for (std::size_t d = 0; d < dimension_count; d++)
+        {
+            boost::uint32_t const delta = boost::uint32_t(q[d]) - boost::uint32_t(m_last[d]);
+            geometry::detail::compressed::put_varint(
+                geometry::detail::compressed::zigzag(delta), m_bytes);
+            m_last[d] = q[d];
+        }
+        m_size++;
+    }
+
+    inline void clear()
+    {
+        m_bytes.clear();
+        m_checkpoints.clear();
+        m_size = 0;
+        clear_last();
+    }
+
+    //! Removes points after the first count points, or appends points
+    //! with zero coordinates
+    inline void resize(std::size_t count)
+    {
+        if (count < m_size)
+        {
+            std::size_t const offset = checkpoint(count / checkpoint_interval, m_last);
+            boost::uint8_t const* it = bytes() + offset;
+            for (std::size_t i = count % checkpoint_interval; i > 0; i--)
+            {
+                for (std::size_t d = 0; d < dimension_count; d++)
+                {
+                    m_last[d] = boost::int32_t(boost::uint32_t(m_last[d])
+                        + geometry::detail::compressed::unzigzag(
+                            geometry::detail::compressed::get_varint(it)));
+                }
+            }
+            m_bytes.resize(std::size_t(it - bytes()));
+            m_checkpoints.resize((count + checkpoint_interval - 1)
+                                 / checkpoint_interval * (dimension_count + 1));
+            m_size = count;
+        }
+
+        Point zero;
+        geometry::assign_zero(zero);
+        while (m_size < count)
+        {
+            push_back(zero);
+        }
+    }
+
+    //! Releases the capacity not used by the encoded points
+    inline void shrink()
+    {
+        std::vector<boost::uint8_t>(m_bytes).swap(m_bytes);
+        std::vector<boost::int32_t>(m_checkpoints).swap(m_checkpoints);
+    }
+
+    inline std::size_t size() const { return m_size; }
+    inline bool empty() const { return m_size == 0; }
+
+    inline const_iterator begin() const { return const_iterator(*this, 0); }
+    inline const_iterator end() const { return const_iterator(*this, m_size); }
+
+    inline Point operator[](std::size_t i) const { return *const_iterator(*this, i); }
+
+    inline Point front() const { return *begin(); }
+    inline Point back() const { return *(--end()); }
+
+    inline coordinate_type const& resolution() const { return m_resolution; }
+
+    //! Encoded points
+    inline boost::uint8_t const* bytes() const
+    {
+        return m_bytes.empty() ? NULL : &m_bytes[0];
+    }
+
+    inline std::size_t byte_count() const { return m_bytes.size(); }
+
+    //! Quantized coordinates of the last point
+    inline void last(boost::int32_t* q) const
+    {
+        for (std::size_t d = 0; d < dimension_count; d++)
+        {
+            q[d] = m_last[d];
+        }
+    }
+
+    //! Byte offset of the point i * checkpoint_interval, q is set to the
+    //! quantized coordinates of the point before it (zero for the first)
+    inline std::size_t checkpoint(std::size_t i, boost::int32_t* q) const
+    {
+        boost::int32_t const* entry = &m_checkpoints[i * (dimension_count + 1)];
+        for (std::size_t d = 0; d < dimension_count; d++)
+        {
+            q[d] = entry[d + 1];
+        }
+        return std::size_t(entry[0]);
+    }
+
+private:
+    inline void clear_last()
+    {
+        for (std::size_t d = 0; d < dimension_count; d++)
+        {
+            m_last[d] = 0;
+        }
+    }
+
+    std::vector<boost::uint8_t> m_bytes;
+    std::vector<boost::int32_t> m_checkpoints;
+    std::size_t m_size;
+    coordinate_type m_resolution;
+    boost::int32_t m_last[dimension_count];
+};
+
+} // namespace model
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<model::compressed_ring<Point, ClockWise, Closed> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct point_order<model::compressed_ring<Point, ClockWise, Closed> >
+{
+    static const order_selector value = ClockWise ? clockwise : counterclockwise;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct closure<model::compressed_ring<Point, ClockWise, Closed> >
+{
+    static const closure_selector value = Closed ? closed : open;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_COMPRESSED_GEOMETRIES_RING_HPP
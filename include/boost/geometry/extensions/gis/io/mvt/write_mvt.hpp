@@ -0,0 +1,676 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_MVT_WRITE_MVT_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_MVT_WRITE_MVT_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/strategies/transform/map_transformer.hpp>
+#include <boost/geometry/util/math.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Geometry types of Mapbox Vector Tiles
+\ingroup mvt
+*/
+struct mvt_geometry_type
+{
+    enum enum_t
+    {
+        unknown = 0,
+        point = 1,
+        linestring = 2,
+        polygon = 3
+    };
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace mvt
+{
+
+typedef model::point<double, 2, cs::cartesian> tile_point;
+
+struct integer_point
+{
+    integer_point(boost::int32_t x_, boost::int32_t y_)
+        : x(x_)
+        , y(y_)
+    {}
+
+    inline bool operator==(integer_point const& other) const
+    {
+        return x == other.x && y == other.y;
+    }
+
+    boost::int32_t x;
+    boost::int32_t y;
+};
+
+struct command
+{
+    enum enum_t
+    {
+        move_to = 1,
+        line_to = 2,
+        close_path = 7
+    };
+};
+
+inline boost::uint32_t zigzag(boost::int32_t value)
+{
+    return (boost::uint32_t(value) << 1) ^ (0u - (boost::uint32_t(value) >> 31));
+}
+
+inline boost::int64_t cross(integer_point const& a, integer_point const& b,
+                            integer_point const& c)
+{
+    return (boost::int64_t(b.x) - a.x) * (boost::int64_t(c.y) - b.y)
+         - (boost::int64_t(b.y) - a.y) * (boost::int64_t(c.x) - b.x);
+}
+
+inline boost::int64_t dot(integer_point const& a, integer_point const& b,
+                          integer_point const& c)
+{
+    return (boost::int64_t(b.x) - a.x) * (boost::int64_t(c.x) - b.x)
+         + (boost::int64_t(b.y) - a.y) * (boost::int64_t(c.y) - b.y);
+}
+
+// Intersection of the segment with the line where coordinate Dimension
+// has the value limit
+template <std::size_t Dimension>
+inline tile_point intersection(tile_point const& s, tile_point const& e,
+                               double limit)
+{
+    double const t = (limit - geometry::get<Dimension>(s))
+                   / (geometry::get<Dimension>(e) - geometry::get<Dimension>(s));
+    tile_point p(geometry::get<0>(s) + t * (geometry::get<0>(e) - geometry::get<0>(s)),
+                 geometry::get<1>(s) + t * (geometry::get<1>(e) - geometry::get<1>(s)));
+    geometry::set<Dimension>(p, limit);
+    return p;
+}
+
+// One step of Sutherland-Hodgman, keeps the part of the ring on the
+// inner side of the line where coordinate Dimension has the value limit
+template <std::size_t Dimension, bool Max>
+inline void clip_ring(std::vector<tile_point> const& input,
+                      std::vector<tile_point>& output,
+                      double limit)
+{
+    output.clear();
+    if (input.empty())
+    {
+        return;
+    }
+
+    tile_point s = input.back();
+    bool s_inside = Max ? geometry::get<Dimension>(s) <= limit
+                        : geometry::get<Dimension>(s) >= limit;
+    for (std::size_t i = 0; i < input.size(); i++)
+    {
+        tile_point const& e = input[i];
+        bool const e_inside = Max ? geometry::get<Dimension>(e) <= limit
+                                  : geometry::get<Dimension>(e) >= limit;
+        if (e_inside != s_inside)
+        {
+            output.push_back(intersection<Dimension>(s, e, limit));
+        }
+        if (e_inside)
+        {
+            output.push_back(e);
+        }
+        s = e;
+        s_inside = e_inside;
+    }
+}
+
+
+// Maps geometries into the tile, clips them at the tile extended by the
+// buffer and appends the commands. The vectors are kept between geometries.
+class encoder
+{
+    typedef strategy::transform::map_transformer
+        <
+            double, 2, 2, true, false
+        > transformer_type;
+
+public:
+    template <typename Box>
+    inline encoder(Box const& tile, boost::uint32_t extent, boost::uint32_t buffer)
+        : m_transformer(tile, double(extent), double(extent))
+        , m_min(-double(buffer))
+        , m_max(double(extent) + double(buffer))
+        , m_commands(NULL)
+        , m_cursor(0, 0)
+    {}
+
+    inline void begin(std::vector<boost::uint32_t>& commands)
+    {
+        commands.clear();
+        m_commands = &commands;
+        m_cursor = integer_point(0, 0);
+    }
+
+    template <typename Point>
+    inline void add_point(Point const& point)
+    {
+        tile_point const p = transform(point);
+        if (inside(p))
+        {
+            m_path.push_back(quantize(p));
+        }
+    }
+
+    // Writes the points added by add_point with one MoveTo
+    inline void flush_points()
+    {
+        if (! m_path.empty())
+        {
+            put_command(command::move_to, m_path.size());
+            for (std::size_t i = 0; i < m_path.size(); i++)
+            {
+                put_parameters(m_path[i]);
+            }
+            m_path.clear();
+        }
+    }
+
+    // The linestring is clipped segment by segment, each part inside
+    // the tile is written when it leaves the tile
+    template <typename Range>
+    inline void add_linestring(Range const& range)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator_type;
+
+        m_path.clear();
+        iterator_type it = boost::begin(range);
+        if (it == boost::end(range))
+        {
+            return;
+        }
+
+        tile_point previous = transform(*it);
+        for (++it; it != boost::end(range); ++it)
+        {
+            tile_point const current = transform(*it);
+            tile_point a = previous;
+            tile_point b = current;
+            bool leaves = false;
+            if (clip_segment(a, b, leaves))
+            {
+                if (m_path.empty())
+                {
+                    add_path_point(quantize(a), false);
+                }
+                add_path_point(quantize(b), false);
+                if (leaves)
+                {
+                    flush_linestring();
+                }
+            }
+            previous = current;
+        }
+        flush_linestring();
+    }
+
+    // Returns false if nothing of the ring is left, the ring is written
+    // with the winding order of exterior or interior rings
+    template <typename Range>
+    inline bool add_ring(Range const& range, bool exterior)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator_type;
+
+        m_tile.clear();
+        bool inside_tile = true;
+        for (iterator_type it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            m_tile.push_back(transform(*it));
+            inside_tile = inside_tile && inside(m_tile.back());
+        }
+
+        if (! inside_tile)
+        {
+            clip_ring<0, false>(m_tile, m_clipped, m_min);
+            clip_ring<0, true>(m_clipped, m_tile, m_max);
+            clip_ring<1, false>(m_tile, m_clipped, m_min);
+            clip_ring<1, true>(m_clipped, m_tile, m_max);
+        }
+
+        m_path.clear();
+        for (std::size_t i = 0; i < m_tile.size(); i++)
+        {
+            add_path_point(quantize(m_tile[i]), true);
+        }
+        close_ring();
+
+        if (m_path.size() < 3)
+        {
+            return false;
+        }
+
+        // Surveyor's formula, exterior rings are positive in tile
+        // coordinates (with y pointing down)
+        boost::int64_t area = 0;
+        for (std::size_t i = 0, j = m_path.size() - 1; i < m_path.size(); j = i++)
+        {
+            area += boost::int64_t(m_path[j].x) * m_path[i].y
+                  - boost::int64_t(m_path[i].x) * m_path[j].y;
+        }
+        if (area == 0)
+        {
+            return false;
+        }
+        if ((area > 0) != exterior)
+        {
+            std::reverse(m_path.begin() + 1, m_path.end());
+        }
+
+        put_command(command::move_to, 1);
+        put_parameters(m_path[0]);
+        put_command(command::line_to, m_path.size() - 1);
+        for (std::size_t i = 1; i < m_path.size(); i++)
+        {
+            put_parameters(m_path[i]);
+        }
+        put_command(command::close_path, 1);
+        return true;
+    }
+
+private:
+    template <typename Point>
+    inline tile_point transform(Point const& point) const
+    {
+        tile_point result;
+        m_transformer.apply(point, result);
+        return result;
+    }
+
+    inline bool inside(tile_point const& p) const
+    {
+        return geometry::get<0>(p) >= m_min && geometry::get<0>(p) <= m_max
+            && geometry::get<1>(p) >= m_min && geometry::get<1>(p) <= m_max;
+    }
+
+    static inline integer_point quantize(tile_point const& p)
+    {
+        return integer_point(math::rounding_cast<boost::int32_t>(geometry::get<0>(p)),
+                             math::rounding_cast<boost::int32_t>(geometry::get<1>(p)));
+    }
+
+    // Liang-Barsky, leaves is set if b is replaced by the point where
+    // the segment leaves the clip box
+    inline bool clip_segment(tile_point& a, tile_point& b, bool& leaves) const
+    {
+        double const x0 = geometry::get<0>(a);
+        double const y0 = geometry::get<1>(a);
+        double const dx = geometry::get<0>(b) - x0;
+        double const dy = geometry::get<1>(b) - y0;
+
+        double t0 = 0;
+        double t1 = 1;
+        if (! clip_parameter(-dx, x0 - m_min, t0, t1)
+            || ! clip_parameter(dx, m_max - x0, t0, t1)
+            || ! clip_parameter(-dy, y0 - m_min, t0, t1)
+            || ! clip_parameter(dy, m_max - y0, t0, t1))
+        {
+            return false;
+        }
+
+        if (t0 > 0)
+        {
+            geometry::set<0>(a, x0 + t0 * dx);
+            geometry::set<1>(a, y0 + t0 * dy);
+        }
+        leaves = t1 < 1;
+        if (leaves)
+        {
+            geometry::set<0>(b, x0 + t1 * dx);
+            geometry::set<1>(b, y0 + t1 * dy);
+        }
+        return true;
+    }
+
+    static inline bool clip_parameter(double p, double q, double& t0, double& t1)
+    {
+        if (p == 0)
+        {
+            return q >= 0;
+        }
+        double const r = q / p;
+        if (p < 0)
+        {
+            if (r > t1)
+            {
+                return false;
+            }
+            t0 = (std::max)(t0, r);
+        }
+        else
+        {
+            if (r < t0)
+            {
+                return false;
+            }
+            t1 = (std::min)(t1, r);
+        }
+        return true;
+    }
+
+    // A point is removed if it is a duplicate, or if it lies on the line
+    // through its neighbours. Within linestrings only if it is between
+    // them, so that the linestring keeps its extent.
+    inline bool removable(integer_point const& a, integer_point const& b,
+                          integer_point const& c, bool ring) const
+    {
+        return cross(a, b, c) == 0 && (ring || dot(a, b, c) >= 0);
+    }
+
+    inline void add_path_point(integer_point const& p, bool ring)
+    {
+        while (m_path.size() >= 2
+               && removable(m_path[m_path.size() - 2], m_path.back(), p, ring))
+        {
+            m_path.pop_back();
+        }
+        if (m_path.empty() || ! (m_path.back() == p))
+        {
+            m_path.push_back(p);
+        }
+    }
+
+    // Removes the closing point and the collinear points around it
+    inline void close_ring()
+    {
+        if (m_path.size() > 1 && m_path.back() == m_path.front())
+        {
+            m_path.pop_back();
+        }
+
+        while (m_path.size() >= 3)
+        {
+            std::size_t const n = m_path.size();
+            if (removable(m_path[n - 2], m_path[n - 1], m_path[0], true))
+            {
+                m_path.pop_back();
+            }
+            else if (removable(m_path[n - 1], m_path[0], m_path[1], true))
+            {
+                m_path.erase(m_path.begin());
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    inline void flush_linestring()
+    {
+        if (m_path.size() >= 2)
+        {
+            put_command(command::move_to, 1);
+            put_parameters(m_path[0]);
+            put_command(command::line_to, m_path.size() - 1);
+            for (std::size_t i = 1; i < m_path.size(); i++)
+            {
+                put_parameters(m_path[i]);
+            }
+        }
+        m_path.clear();
+    }
+
+    inline void put_command(command::enum_t id, std::size_t count)
+    {
+        m_commands->push_back(boost::uint32_t(id) | (boost::uint32_t(count) << 3));
+    }
+
+    // Coordinates are relative to the previous point, also between parts
+    inline void put_parameters(integer_point const& p)
+    {
+        m_commands->push_back(zigzag(p.x - m_cursor.x));
+        m_commands->push_back(zigzag(p.y - m_cursor.y));
+        m_cursor = p;
+    }
+
+    transformer_type m_transformer;
+    double m_min;
+    double m_max;
+    std::vector<boost::uint32_t>* m_commands;
+    integer_point m_cursor;
+    std::vector<tile_point> m_tile;
+    std::vector<tile_point> m_clipped;
+    std::vector<integer_point> m_path;
+};
+
+}} // namespace detail::mvt
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct write_mvt
+    : not_implemented<Geometry>
+{};
+
+template <typename Point>
+struct write_mvt<Point, point_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::point;
+
+    static inline void apply(Point const& point, detail::mvt::encoder& encoder)
+    {
+        encoder.add_point(point);
+        encoder.flush_points();
+    }
+};
+
+template <typename MultiPoint>
+struct write_mvt<MultiPoint, multi_point_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::point;
+
+    static inline void apply(MultiPoint const& multi_point, detail::mvt::encoder& encoder)
+    {
+        typedef typename boost::range_iterator<MultiPoint const>::type iterator_type;
+        for (iterator_type it = boost::begin(multi_point); it != boost::end(multi_point); ++it)
+        {
+            encoder.add_point(*it);
+        }
+        encoder.flush_points();
+    }
+};
+
+template <typename Linestring>
+struct write_mvt<Linestring, linestring_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::linestring;
+
+    static inline void apply(Linestring const& linestring, detail::mvt::encoder& encoder)
+    {
+        encoder.add_linestring(linestring);
+    }
+};
+
+template <typename MultiLinestring>
+struct write_mvt<MultiLinestring, multi_linestring_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::linestring;
+
+    static inline void apply(MultiLinestring const& multi, detail::mvt::encoder& encoder)
+    {
+        typedef typename boost::range_iterator<MultiLinestring const>::type iterator_type;
+        for (iterator_type it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            encoder.add_linestring(*it);
+        }
+    }
+};
+
+template <typename Ring>
+struct write_mvt<Ring, ring_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::polygon;
+
+    static inline void apply(Ring const& ring, detail::mvt::encoder& encoder)
+    {
+        encoder.add_ring(ring, true);
+    }
+};
+
+// Interior rings are dropped with their exterior ring
+template <typename Polygon>
+struct write_mvt<Polygon, polygon_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::polygon;
+
+    static inline void apply(Polygon const& polygon, detail::mvt::encoder& encoder)
+    {
+        typedef typename interior_return_type<Polygon const>::type interiors_type;
+        typedef typename boost::range_iterator
+            <
+                typename interior_type<Polygon const>::type
+            >::type iterator_type;
+
+        if (! encoder.add_ring(exterior_ring(polygon), true))
+        {
+            return;
+        }
+
+        interiors_type interiors = interior_rings(polygon);
+        for (iterator_type it = boost::begin(interiors); it != boost::end(interiors); ++it)
+        {
+            encoder.add_ring(*it, false);
+        }
+    }
+};
+
+template <typename MultiPolygon>
+struct write_mvt<MultiPolygon, multi_polygon_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::polygon;
+
+    static inline void apply(MultiPolygon const& multi, detail::mvt::encoder& encoder)
+    {
+        typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+        typedef typename boost::range_iterator<MultiPolygon const>::type iterator_type;
+        for (iterator_type it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            write_mvt<polygon_type>::apply(*it, encoder);
+        }
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Encodes geometries as geometries of Mapbox Vector Tiles
+\details The geometries are mapped into the tile, with the y axis pointing
+    down, and clipped at the tile extended by the buffer. In the same pass
+    coordinates are rounded to integers. Duplicate points and points on
+    the line through their neighbours are removed. Rings which become
+    degenerate are removed, together with the interior rings of a removed
+    exterior ring. Rings get the winding order of the specification:
+    exterior rings have a positive area in tile coordinates.
+    The commands are appended to a vector, and the vectors used for
+    clipping are kept, so an encoder can be used for all features of a
+    tile without allocations.
+\ingroup mvt
+*/
+class mvt_encoder
+{
+public:
+    /*!
+    \brief Constructs the encoder for a tile
+    \param tile box of the tile, in coordinates of the geometries
+    \param extent size of the tile in tile coordinates
+    \param buffer distance outside the tile, in tile coordinates, where
+        geometries are clipped
+    */
+    template <typename Box>
+    inline explicit mvt_encoder(Box const& tile,
+                                boost::uint32_t extent = 4096,
+                                boost::uint32_t buffer = 0)
+        : m_encoder(tile, extent, buffer)
+    {}
+
+    /*!
+    \brief Encodes a geometry into command integers
+    \param geometry \param_geometry
+    \param commands cleared and filled with the command integers
+    \return the geometry type, or unknown if nothing of the geometry is
+        left in the tile (then commands is empty)
+    */
+    template <typename Geometry>
+    inline mvt_geometry_type::enum_t encode(Geometry const& geometry,
+                                            std::vector<boost::uint32_t>& commands)
+    {
+        concepts::check<Geometry const>();
+
+        m_encoder.begin(commands);
+        dispatch::write_mvt<Geometry>::apply(geometry, m_encoder);
+        return commands.empty()
+            ? mvt_geometry_type::unknown
+            : dispatch::write_mvt<Geometry>::type;
+    }
+
+private:
+    detail::mvt::encoder m_encoder;
+};
+
+
+/*!
+\brief Encodes a geometry as geometry of a Mapbox Vector Tile
+\ingroup mvt
+\param geometry \param_geometry
+\param tile box of the tile, in coordinates of the geometry
+\param commands cleared and filled with the command integers
+\param extent size of the tile in tile coordinates
+\param buffer distance outside the tile, in tile coordinates, where the
+    geometry is clipped
+\return the geometry type, or unknown if nothing of the geometry is left
+*/
+template <typename Geometry, typename Box>
+inline mvt_geometry_type::enum_t write_mvt(Geometry const& geometry, Box const& tile,
+                                           std::vector<boost::uint32_t>& commands,
+                                           boost::uint32_t extent = 4096,
+                                           boost::uint32_t buffer = 0)
+{
+    mvt_encoder encoder(tile, extent, buffer);
+    return encoder.encode(geometry, commands);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_MVT_WRITE_MVT_HPP
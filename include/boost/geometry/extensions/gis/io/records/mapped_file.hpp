@@ -0,0 +1,31 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_RECORDS_MAPPED_FILE_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_RECORDS_MAPPED_FILE_HPP
+
+
+#include <boost/geometry/io/detail/mapped_file.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Read-only mapping of a whole file
+\details The pages are loaded by the OS when they are touched, so the
+    geometries of a large file can be read without copying the file.
+    Where mmap() is not available the file is read into memory.
+\ingroup io
+*/
+typedef detail::mapped_file mapped_file;
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_RECORDS_MAPPED_FILE_HPP
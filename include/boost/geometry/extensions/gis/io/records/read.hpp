@@ -0,0 +1,491 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_RECORDS_READ_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_RECORDS_READ_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/io/io.hpp>
+#include <boost/geometry/io/wkb/read.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace records
+{
+
+// Characters of the records and the positions in the input are
+// represented as char, WKB bytes are converted when they are read
+inline boost::uint8_t byte_at(char const* it)
+{
+    return static_cast<boost::uint8_t>(*it);
+}
+
+inline bool is_wkt_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r'
+        || c == '\v' || c == '\f';
+}
+
+
+template <typename Format>
+struct record_format
+{};
+
+// One WKT geometry per line, empty lines are skipped
+template <>
+struct record_format<format_wkt>
+{
+    // Finds the first record in [first, last). If the record is not
+    // terminated with a new line it is complete only if last is the end
+    // of the input. Returns false if there is no complete record.
+    static inline bool find(char const* first, char const* last, bool at_end,
+                            char const*& record_first, char const*& record_last)
+    {
+        while (first != last && is_wkt_space(*first))
+        {
+            ++first;
+        }
+        record_first = first;
+        if (first == last)
+        {
+            record_last = last;
+            return false;
+        }
+
+        char const* const new_line = std::find(first, last, '\n');
+        record_last = new_line;
+        return new_line != last || at_end;
+    }
+
+    // Returns the beginning of the first record starting at or after
+    // position. Any known record boundary before position can be passed
+    // as boundary.
+    static inline char const* next_boundary(char const* /*boundary*/,
+                                            char const* position,
+                                            char const* last)
+    {
+        char const* const new_line = std::find(position, last, '\n');
+        return new_line == last ? last : new_line + 1;
+    }
+
+    template <typename Geometry>
+    static inline void parse(char const* first, char const* last,
+                             Geometry& geometry)
+    {
+        geometry::read_wkt(first, last, geometry);
+    }
+};
+
+// Concatenated WKB geometries. Records are not delimited so their sizes
+// are calculated from the headers and the numbers of elements. ISO and
+// EWKB dimensions flags and EWKB SRIDs are taken into account.
+template <>
+struct record_format<format_wkb>
+{
+    static const int max_depth = 32;
+
+    static inline bool find(char const* first, char const* last, bool at_end,
+                            char const*& record_first, char const*& record_last)
+    {
+        record_first = first;
+        record_last = last;
+        if (first == last)
+        {
+            return false;
+        }
+
+        if (find_end(first, last, record_last, 0))
+        {
+            return true;
+        }
+
+        if (at_end)
+        {
+            // The last record is truncated
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+        return false;
+    }
+
+    static inline char const* next_boundary(char const* boundary,
+                                            char const* position,
+                                            char const* last)
+    {
+        while (boundary < position)
+        {
+            char const* end = last;
+            if (! find_end(boundary, last, end, 0))
+            {
+                BOOST_THROW_EXCEPTION(read_wkb_exception());
+            }
+            boundary = end;
+        }
+        return boundary;
+    }
+
+    template <typename Geometry>
+    static inline void parse(char const* first, char const* last,
+                             Geometry& geometry)
+    {
+        boost::uint8_t const* begin = reinterpret_cast<boost::uint8_t const*>(first);
+        boost::uint8_t const* end = reinterpret_cast<boost::uint8_t const*>(last);
+        if (! geometry::read_wkb(begin, end, geometry))
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+    }
+
+private:
+    static inline boost::uint32_t load_uint32(char const* it, bool little_endian)
+    {
+        boost::uint32_t result = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            int const shift = little_endian ? 8 * i : 8 * (3 - i);
+            result |= boost::uint32_t(byte_at(it + i)) << shift;
+        }
+        return result;
+    }
+
+    static inline bool read_count(char const*& it, char const* last,
+                                  bool little_endian, boost::uint32_t& count)
+    {
+        if (last - it < 4)
+        {
+            return false;
+        }
+        count = load_uint32(it, little_endian);
+        it += 4;
+        return true;
+    }
+
+    static inline bool skip_points(char const*& it, char const* last,
+                                   bool little_endian, std::size_t point_size)
+    {
+        boost::uint32_t count = 0;
+        if (! read_count(it, last, little_endian, count))
+        {
+            return false;
+        }
+        boost::uint64_t const size = boost::uint64_t(count) * point_size;
+        if (boost::uint64_t(last - it) < size)
+        {
+            return false;
+        }
+        it += std::size_t(size);
+        return true;
+    }
+
+    // Sets end to the end of the geometry starting at it, returns false
+    // if [it, last) does not contain the whole geometry
+    static inline bool find_end(char const* it, char const* last,
+                                char const*& end, int depth)
+    {
+        if (depth > max_depth)
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+        if (last - it < 5)
+        {
+            return false;
+        }
+
+        boost::uint8_t const order = byte_at(it);
+        if (order > 1)
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+        bool const little_endian = order == 1;
+
+        boost::uint32_t type = load_uint32(it + 1, little_endian);
+        it += 5;
+
+        bool has_z = (type & 0x80000000) != 0;
+        bool has_m = (type & 0x40000000) != 0;
+        bool const has_srid = (type & 0x20000000) != 0;
+        type &= 0x0fffffff;
+
+        boost::uint32_t const iso_dimension = type / 1000;
+        type %= 1000;
+        if (iso_dimension > 3)
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+        has_z = has_z || iso_dimension == 1 || iso_dimension == 3;
+        has_m = has_m || iso_dimension == 2 || iso_dimension == 3;
+
+        std::size_t const point_size = 8 * (2 + (has_z ? 1 : 0) + (has_m ? 1 : 0));
+
+        if (has_srid)
+        {
+            if (last - it < 4)
+            {
+                return false;
+            }
+            it += 4;
+        }
+
+        switch (type)
+        {
+        case 1 : // point
+            if (std::size_t(last - it) < point_size)
+            {
+                return false;
+            }
+            it += point_size;
+            break;
+        case 2 : // linestring
+            if (! skip_points(it, last, little_endian, point_size))
+            {
+                return false;
+            }
+            break;
+        case 3 : // polygon
+            {
+                boost::uint32_t rings = 0;
+                if (! read_count(it, last, little_endian, rings))
+                {
+                    return false;
+                }
+                for (boost::uint32_t i = 0; i < rings; i++)
+                {
+                    if (! skip_points(it, last, little_endian, point_size))
+                    {
+                        return false;
+                    }
+                }
+            }
+            break;
+        case 4 : // multipoint
+        case 5 : // multilinestring
+        case 6 : // multipolygon
+        case 7 : // geometrycollection
+            {
+                boost::uint32_t count = 0;
+                if (! read_count(it, last, little_endian, count))
+                {
+                    return false;
+                }
+                for (boost::uint32_t i = 0; i < count; i++)
+                {
+                    if (! find_end(it, last, it, depth + 1))
+                    {
+                        return false;
+                    }
+                }
+            }
+            break;
+        default :
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+
+        end = it;
+        return true;
+    }
+};
+
+
+}} // namespace detail::records
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Reads geometries one by one from a file containing many of them
+\details The records are read either from a range of characters, e.g.
+    a mapped_file, or from an input stream which is read in blocks into
+    a buffer. Records are parsed where they are, without copying them.
+    The geometry passed to read() is cleared and filled with the next
+    record so its storage can be reused for all records.
+\tparam Format format_wkt (one geometry per line, empty lines are
+    skipped) or format_wkb (concatenated WKB geometries, the stream
+    should be opened in binary mode)
+\ingroup io
+*/
+template <typename Format>
+class record_reader
+{
+    typedef detail::records::record_format<Format> format_type;
+
+public:
+    /*!
+    \brief Reads records from characters in memory, which are not copied
+    */
+    record_reader(char const* first, char const* last)
+        : m_stream(NULL)
+        , m_first(first)
+        , m_last(last)
+        , m_position(first)
+        , m_at_end(true)
+        , m_block_size(0)
+        , m_discarded(0)
+        , m_record_offset(0)
+    {}
+
+    /*!
+    \brief Reads records from a stream, block_size characters at a time
+    */
+    explicit record_reader(std::istream& stream, std::size_t block_size = 65536)
+        : m_stream(&stream)
+        , m_first(NULL)
+        , m_last(NULL)
+        , m_position(NULL)
+        , m_at_end(false)
+        , m_block_size((std::max)(block_size, std::size_t(1)))
+        , m_discarded(0)
+        , m_record_offset(0)
+    {}
+
+    /*!
+    \brief Reads the next geometry, returns false if there are no more
+        records
+    \details read_wkt_exception or read_wkb_exception is thrown if the
+        record is invalid.
+    */
+    template <typename Geometry>
+    bool read(Geometry& geometry)
+    {
+        concepts::check<Geometry>();
+
+        char const* record_first = NULL;
+        char const* record_last = NULL;
+        while (! format_type::find(m_position, m_last, m_at_end,
+                                   record_first, record_last))
+        {
+            if (m_at_end)
+            {
+                m_position = m_last;
+                return false;
+            }
+            fill(record_first);
+        }
+
+        m_position = record_last;
+        m_record_offset = m_discarded + std::size_t(record_first - m_first);
+        format_type::parse(record_first, record_last, geometry);
+        return true;
+    }
+
+    /*!
+    \brief Returns the offset of the last record read, in characters from
+        the beginning of the input
+    */
+    std::size_t record_offset() const
+    {
+        return m_record_offset;
+    }
+
+private:
+    // Moves the characters of the incomplete record starting at position
+    // to the front of the buffer and appends characters read from the
+    // stream. At least as many characters as kept are read so records
+    // longer than a block are searched a logarithmic number of times.
+    void fill(char const* position)
+    {
+        std::size_t const kept = std::size_t(m_last - position);
+        std::size_t const discarded = std::size_t(position - m_first);
+        if (kept > 0 && discarded > 0)
+        {
+            std::memmove(&m_buffer[0], position, kept);
+        }
+        m_discarded += discarded;
+
+        std::size_t const requested = (std::max)(m_block_size, kept);
+        m_buffer.resize(kept + requested);
+        m_stream->read(&m_buffer[kept], std::streamsize(requested));
+        std::size_t const count = std::size_t(m_stream->gcount());
+        m_buffer.resize(kept + count);
+        m_at_end = count < requested;
+
+        m_first = m_buffer.empty() ? NULL : &m_buffer[0];
+        m_last = m_first + m_buffer.size();
+        m_position = m_first;
+    }
+
+    std::istream* m_stream;
+    std::vector<char> m_buffer;
+
+    char const* m_first;
+    char const* m_last;
+    char const* m_position;
+    bool m_at_end;
+
+    std::size_t m_block_size;
+    std::size_t m_discarded;
+    std::size_t m_record_offset;
+};
+
+
+/*!
+\brief Reads all records, calls the function with the geometry of each one
+\details The same geometry is reused for all records.
+\return The function
+\ingroup io
+*/
+template <typename Format, typename Geometry, typename Function>
+inline Function for_each_record(record_reader<Format>& reader,
+                                Geometry& geometry, Function f)
+{
+    while (reader.read(geometry))
+    {
+        f(geometry);
+    }
+    return f;
+}
+
+
+/*!
+\brief Divides characters into parts containing whole records
+\details The parts have approximately the same number of characters.
+    They can be read in parallel by record_readers created for
+    the ranges [boundaries[i], boundaries[i + 1]).
+\param boundaries count + 1 pointers, the first one is first and the last
+    one is last, some parts can be empty
+\ingroup io
+*/
+template <typename Format>
+inline void split_records(char const* first, char const* last,
+                          std::size_t count,
+                          std::vector<char const*>& boundaries)
+{
+    typedef detail::records::record_format<Format> format_type;
+
+    count = (std::max)(count, std::size_t(1));
+    std::size_t const size = std::size_t(last - first);
+
+    boundaries.clear();
+    boundaries.reserve(count + 1);
+    boundaries.push_back(first);
+    for (std::size_t i = 1; i < count; i++)
+    {
+        char const* const previous = boundaries.back();
+        char const* const position = first + size / count * i;
+        boundaries.push_back(position <= previous
+                             ? previous
+                             : format_type::next_boundary(previous, position, last));
+    }
+    boundaries.push_back(last);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_RECORDS_READ_HPP
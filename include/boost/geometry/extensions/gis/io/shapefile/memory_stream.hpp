@@ -0,0 +1,100 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MEMORY_STREAM_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MEMORY_STREAM_HPP
+
+
+#include <cstring>
+#include <ios>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Input stream over bytes in memory, e.g. over a memory mapped file
+\details Implements the part of the std::istream interface used by
+    read_shapefile. Reading is a memcpy, without sentries and without
+    a stream buffer, and the bytes are not copied in advance.
+\ingroup io
+*/
+class memory_stream
+{
+public:
+    typedef std::ios_base::seekdir seekdir;
+
+    static const seekdir beg = std::ios_base::beg;
+    static const seekdir cur = std::ios_base::cur;
+    static const seekdir end = std::ios_base::end;
+
+    inline memory_stream(char const* first, char const* last)
+        : m_first(first)
+        , m_last(last)
+        , m_it(first)
+        , m_good(true)
+    {}
+
+    inline memory_stream& read(char* s, std::streamsize n)
+    {
+        std::streamsize const left = m_good ? std::streamsize(m_last - m_it) : 0;
+        if (n > left)
+        {
+            std::memset(s, 0, std::size_t(n));
+            m_good = false;
+            return *this;
+        }
+        std::memcpy(s, m_it, std::size_t(n));
+        m_it += n;
+        return *this;
+    }
+
+    inline memory_stream& seekg(std::streamoff off, seekdir dir)
+    {
+        if (m_good)
+        {
+            char const* const origin = dir == std::ios_base::beg ? m_first
+                                     : dir == std::ios_base::end ? m_last
+                                     : m_it;
+            std::streamoff const pos = (origin - m_first) + off;
+            if (pos < 0 || pos > m_last - m_first)
+            {
+                m_good = false;
+            }
+            else
+            {
+                m_it = m_first + pos;
+            }
+        }
+        return *this;
+    }
+
+    inline memory_stream& seekg(std::streamoff pos)
+    {
+        return seekg(pos, std::ios_base::beg);
+    }
+
+    inline std::streamoff tellg() const
+    {
+        return m_good ? std::streamoff(m_it - m_first) : std::streamoff(-1);
+    }
+
+    inline bool good() const { return m_good; }
+    inline void clear() { m_good = true; }
+
+private:
+    char const* m_first;
+    char const* m_last;
+    char const* m_it;
+    bool m_good;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MEMORY_STREAM_HPP
@@ -11,6 +11,7 @@
 
 
 #include <algorithm>
+#include <ios>
 #include <vector>
 
 #include <boost/cstdint.hpp>
@@ -19,7 +20,12 @@
 #include <boost/throw_exception.hpp>
 
 #include <boost/geometry/algorithms/detail/calculate_point_order.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/exception.hpp>
 #include <boost/geometry/core/exterior_ring.hpp>
 #include <boost/geometry/core/interior_rings.hpp>
@@ -28,6 +34,7 @@
 #include <boost/geometry/core/closure.hpp>
 #include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/concepts/check.hpp>
 #include <boost/geometry/util/range.hpp>
 
@@ -168,16 +175,15 @@ inline boost::int32_t reset_and_read_header(IStream & is)
     return type;
 }
 
+// Reads the header of a record, the length of its content is returned
+// in bytes
 template <typename IStream>
-inline bool read_record_header(IStream & is)
+inline bool read_record_header(IStream & is, boost::int32_t & length)
 {
-    //read_big(is, number);
-    //read_big(is, length);
-
-    is.seekg(sizeof(boost::int32_t), IStream::cur);
-    // only to set flags
-    boost::int32_t foo;
-    read_native(is, foo);
+    boost::int32_t number = 0;
+    read_big(is, number);
+    read_big(is, length);
+    length *= 2;
 
     return is.good();
 }
@@ -509,6 +515,32 @@ struct read_polyline_policy
     }
 };
 
+// Envelope of a ring, partitioned to find the outer ring of inner rings
+template <typename Box>
+struct ring_envelope
+{
+    Box envelope;
+    std::size_t index;
+};
+
+struct ring_envelope_expand
+{
+    template <typename Box, typename Item>
+    static inline void apply(Box & total, Item const& item)
+    {
+        geometry::expand(total, item.envelope);
+    }
+};
+
+struct ring_envelope_overlaps
+{
+    template <typename Box, typename Item>
+    static inline bool apply(Box const& box, Item const& item)
+    {
+        return ! geometry::disjoint(box, item.envelope);
+    }
+};
+
 struct read_polygon_policy
 {
     template <typename IStream, typename Polygons, typename Strategy>
@@ -637,41 +669,52 @@ struct read_polygon_policy
                 range::push_back(polygons, poly); // TODO: move
             }
         }
-        else if (! outer_rings.empty()) // outer and inner rings
+        else if (outer_rings.size() == 1) // one outer and inner rings
         {
-            std::vector<bool> assigned(inner_rings.size(), false);
-            std::size_t assigned_count = 0;
-            for (size_t i = 0; i < outer_rings.size(); ++i)
+            poly_type poly;
+            geometry::exterior_ring(poly) = outer_rings.front(); // TODO: move
+            for (size_t j = 0; j < inner_rings.size(); ++j)
             {
-                poly_type poly;
-                geometry::exterior_ring(poly) = outer_rings[i]; // TODO: move
-                for (size_t j = 0; j < inner_rings.size(); ++j)
+                if (is_inner_ring(inner_rings[j],
+                                  geometry::exterior_ring(poly),
+                                  within_strategy))
                 {
-                    if (! assigned[j])
-                    {
-                        if (is_inner_ring(inner_rings[j],
-                                          geometry::exterior_ring(poly),
-                                          within_strategy))
-                        {
-                            range::push_back(geometry::interior_rings(poly), inner_rings[j]); // TODO: move
-                            ++assigned_count;
-                            assigned[j] = true;
-                        }
-                        // just in case, ignore empty
-                        else if (boost::empty(inner_rings[j]))
-                        {
-                            ++assigned_count;
-                            assigned[j] = true;
-                        }
-                    }
+                    range::push_back(geometry::interior_rings(poly), inner_rings[j]); // TODO: move
+                }
+                // just in case, ignore empty
+                else if (! boost::empty(inner_rings[j]))
+                {
+                    BOOST_THROW_EXCEPTION(read_shapefile_exception("Not all interior rings were assigned to polygons."));
                 }
-                range::push_back(polygons, poly); // TODO: move
             }
+            range::push_back(polygons, poly); // TODO: move
+        }
+        else if (! outer_rings.empty()) // outer and inner rings
+        {
+            // Each inner ring is assigned to the first outer ring containing
+            // it, only pairs of rings with overlapping envelopes are checked
+            std::vector<std::size_t> parents;
+            assign_parents(outer_rings, inner_rings, parents, within_strategy);
 
-            // check if all interior rings were assigned
-            if (assigned_count != inner_rings.size())
+            std::size_t const first_polygon = boost::size(polygons);
+            for (size_t i = 0; i < outer_rings.size(); ++i)
             {
-                BOOST_THROW_EXCEPTION(read_shapefile_exception("Not all interior rings were assigned to polygons."));
+                range::push_back(polygons, poly_type());
+                geometry::exterior_ring(range::back(polygons)) = outer_rings[i]; // TODO: move
+            }
+
+            for (size_t j = 0; j < inner_rings.size(); ++j)
+            {
+                if (parents[j] < outer_rings.size())
+                {
+                    poly_type & poly = range::at(polygons, first_polygon + parents[j]);
+                    range::push_back(geometry::interior_rings(poly), inner_rings[j]); // TODO: move
+                }
+                // just in case, ignore empty
+                else if (! boost::empty(inner_rings[j]))
+                {
+                    BOOST_THROW_EXCEPTION(read_shapefile_exception("Not all interior rings were assigned to polygons."));
+                }
             }
         }
         else // inner rings but no outer rings
@@ -694,6 +737,84 @@ struct read_polygon_policy
             || result == geometry::order_undetermined;
     }
 
+    // Sets the index of the first outer ring containing each inner ring,
+    // or the number of outer rings if there is none
+    template <typename Rings, typename Strategy>
+    static inline void assign_parents(Rings const& outer_rings,
+                                      Rings const& inner_rings,
+                                      std::vector<std::size_t> & parents,
+                                      Strategy const& within_strategy)
+    {
+        typedef typename boost::range_value<Rings>::type ring_type;
+        typedef model::box<typename geometry::point_type<ring_type>::type> box_type;
+        typedef ring_envelope<box_type> item_type;
+
+        std::vector<item_type> outer_items, inner_items;
+        fill_envelopes(outer_rings, outer_items);
+        fill_envelopes(inner_rings, inner_items);
+
+        parents.assign(inner_rings.size(), outer_rings.size());
+
+        assign_visitor<Rings, Strategy> visitor(outer_rings, inner_rings,
+                                                parents, within_strategy);
+        geometry::partition
+            <
+                box_type
+            >::apply(outer_items, inner_items, visitor,
+                     ring_envelope_expand(), ring_envelope_overlaps());
+    }
+
+    // Empty rings are not added
+    template <typename Rings, typename Items>
+    static inline void fill_envelopes(Rings const& rings, Items & items)
+    {
+        typedef typename boost::range_value<Items>::type item_type;
+
+        items.reserve(boost::size(rings));
+        for (std::size_t i = 0; i < boost::size(rings); ++i)
+        {
+            if (! boost::empty(rings[i]))
+            {
+                item_type item;
+                item.index = i;
+                geometry::envelope(rings[i], item.envelope);
+                items.push_back(item);
+            }
+        }
+    }
+
+    template <typename Rings, typename Strategy>
+    struct assign_visitor
+    {
+        assign_visitor(Rings const& outer_rings, Rings const& inner_rings,
+                       std::vector<std::size_t> & parents,
+                       Strategy const& within_strategy)
+            : m_outer_rings(outer_rings)
+            , m_inner_rings(inner_rings)
+            , m_parents(parents)
+            , m_within_strategy(within_strategy)
+        {}
+
+        template <typename Item>
+        inline bool apply(Item const& outer, Item const& inner)
+        {
+            std::size_t & parent = m_parents[inner.index];
+            if (outer.index < parent
+                && is_inner_ring(m_inner_rings[inner.index],
+                                 m_outer_rings[outer.index],
+                                 m_within_strategy))
+            {
+                parent = outer.index;
+            }
+            return true;
+        }
+
+        Rings const& m_outer_rings;
+        Rings const& m_inner_rings;
+        std::vector<std::size_t> & m_parents;
+        Strategy const& m_within_strategy;
+    };
+
     template <typename InnerRing, typename OuterRing, typename Strategy>
     static inline bool is_inner_ring(InnerRing const& inner_ring,
                                      OuterRing const& outer_ring,
@@ -715,23 +836,155 @@ struct read_polygon_policy
     }
 };
 
-template <typename Policy, typename IStream, typename Range, typename Strategy>
-inline void add_records(IStream & is, Range & rng, boost::int32_t type,
-                        Strategy const& strategy)
+// Records are visited by cursors, next() positions the stream at the
+// content of the next record to decode
+
+// All records, one after another
+struct sequential_records
+{
+    template <typename IStream>
+    inline bool next(IStream & is, boost::int32_t & length)
+    {
+        return read_record_header(is, length);
+    }
+};
+
+// Records [first, last) of the offsets read from the .shx file, in words
+struct indexed_records
+{
+    inline indexed_records(std::vector<boost::uint32_t> const& offsets,
+                           std::size_t first, std::size_t last)
+        : m_offsets(offsets)
+        , m_current(first)
+        , m_last(last)
+    {}
+
+    template <typename IStream>
+    inline bool next(IStream & is, boost::int32_t & length)
+    {
+        if (m_current >= m_last)
+        {
+            return false;
+        }
+
+        is.clear();
+        is.seekg(std::streamoff(m_offsets[m_current++]) * 2, IStream::beg);
+        if (! read_record_header(is, length))
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid record offset"));
+        }
+        return true;
+    }
+
+private:
+    std::vector<boost::uint32_t> const& m_offsets;
+    std::size_t m_current;
+    std::size_t m_last;
+};
+
+// Records of another cursor whose bounding box intersects the box,
+// the others are skipped without decoding
+template <typename Records, typename Box>
+struct filtered_records
+{
+    inline filtered_records(Records & records, Box const& box)
+        : m_records(records)
+        , m_box(box)
+    {}
+
+    template <typename IStream>
+    inline bool next(IStream & is, boost::int32_t & length)
+    {
+        while (m_records.next(is, length))
+        {
+            if (intersects_record(is, length))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    // Reads the type and the bounding box at the beginning of the content
+    // and moves to the content, or to the next record if it's skipped
+    template <typename IStream>
+    inline bool intersects_record(IStream & is, boost::int32_t length)
+    {
+        boost::int32_t type = 0;
+        read_little(is, type);
+
+        if (type == shape_type::null_shape || length < 4)
+        {
+            is.seekg(length - 4, IStream::cur);
+            return false;
+        }
+
+        bool const is_point = type == shape_type::point
+                           || type == shape_type::point_z
+                           || type == shape_type::point_m;
+
+        double min_x = 0, min_y = 0, max_x = 0, max_y = 0;
+        read_little(is, min_x);
+        read_little(is, min_y);
+        if (is_point)
+        {
+            max_x = min_x;
+            max_y = min_y;
+        }
+        else
+        {
+            read_little(is, max_x);
+            read_little(is, max_y);
+        }
+
+        if (! is.good())
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Read error"));
+        }
+
+        boost::int32_t const read_length = is_point ? 20 : 36;
+
+        // Other dimensions of the box are not filtered
+        Box record_box = m_box;
+        geometry::set<min_corner, 0>(record_box, min_x);
+        geometry::set<min_corner, 1>(record_box, min_y);
+        geometry::set<max_corner, 0>(record_box, max_x);
+        geometry::set<max_corner, 1>(record_box, max_y);
+
+        if (geometry::disjoint(record_box, m_box))
+        {
+            is.seekg(length - read_length, IStream::cur);
+            return false;
+        }
+
+        is.seekg(-read_length, IStream::cur);
+        return true;
+    }
+
+    Records & m_records;
+    Box const& m_box;
+};
+
+template <typename Policy, typename IStream, typename Records, typename Range, typename Strategy>
+inline void add_records(IStream & is, Records & records, Range & rng,
+                        boost::int32_t type, Strategy const& strategy)
 {
-    while (read_record_header(is))
+    boost::int32_t length = 0;
+    while (records.next(is, length))
     {
         Policy::apply(is, rng, type, strategy);
     }
 }
 
-template <typename Policy, typename IStream, typename Range, typename Strategy>
-inline void add_records_as_new_element(IStream & is, Range & rng, boost::int32_t type,
-                                       Strategy const& strategy)
+template <typename Policy, typename IStream, typename Records, typename Range, typename Strategy>
+inline void add_records_as_new_element(IStream & is, Records & records, Range & rng,
+                                       boost::int32_t type, Strategy const& strategy)
 {
     typedef typename boost::range_value<Range>::type val_type;
 
-    if (! read_record_header(is))
+    boost::int32_t length = 0;
+    if (! records.next(is, length))
     {
         return;
     }
@@ -743,16 +996,17 @@ inline void add_records_as_new_element(IStream & is, Range & rng, boost::int32_t
     {
         Policy::apply(is, elem, type, strategy);
     }
-    while (read_record_header(is));
+    while (records.next(is, length));
 }
 
-template <typename Policy, typename IStream, typename Range, typename Strategy>
-inline void add_records_as_new_elements(IStream & is, Range & rng, boost::int32_t type,
-                                        Strategy const& strategy)
+template <typename Policy, typename IStream, typename Records, typename Range, typename Strategy>
+inline void add_records_as_new_elements(IStream & is, Records & records, Range & rng,
+                                        boost::int32_t type, Strategy const& strategy)
 {
     typedef typename boost::range_value<Range>::type val_type;
 
-    while (read_record_header(is))
+    boost::int32_t length = 0;
+    while (records.next(is, length))
     {
         range::push_back(rng, val_type());
         val_type & elem = range::back(rng);
@@ -761,6 +1015,29 @@ inline void add_records_as_new_elements(IStream & is, Range & rng, boost::int32_
     }
 }
 
+template <typename IStream>
+inline void read_index(IStream & is, std::vector<boost::uint32_t> & offsets)
+{
+    reset_and_read_header(is);
+
+    offsets.clear();
+    for (;;)
+    {
+        boost::int32_t offset = 0, length = 0;
+        read_big(is, offset);
+        read_big(is, length);
+        if (! is.good())
+        {
+            break;
+        }
+        if (offset < 50 || length < 0)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid index record"));
+        }
+        offsets.push_back(boost::uint32_t(offset));
+    }
+}
+
 }} // namespace detail::shapefile
 
 namespace dispatch
@@ -778,8 +1055,9 @@ struct read_shapefile
 template <typename Geometry>
 struct read_shapefile<Geometry, point_tag>
 {
-    template <typename IStream, typename Points, typename Strategy>
-    static inline void apply(IStream &is, Points & points, Strategy const& strategy)
+    template <typename IStream, typename Records, typename Points, typename Strategy>
+    static inline void apply(IStream &is, Records & records, Points & points,
+                             Strategy const& strategy)
     {
         namespace shp = detail::shapefile;
         
@@ -789,13 +1067,13 @@ struct read_shapefile<Geometry, point_tag>
             || type == shp::shape_type::point_m
             || type == shp::shape_type::point_z)
         {
-            shp::add_records<shp::read_point_policy>(is, points, type, strategy);
+            shp::add_records<shp::read_point_policy>(is, records, points, type, strategy);
         }
         else if (type == detail::shapefile::shape_type::multipoint
               || type == detail::shapefile::shape_type::multipoint_m
               || type == detail::shapefile::shape_type::multipoint_z)
         {
-            shp::add_records<shp::read_multipoint_policy>(is, points, type, strategy);
+            shp::add_records<shp::read_multipoint_policy>(is, records, points, type, strategy);
         }
     }
 };
@@ -803,8 +1081,9 @@ struct read_shapefile<Geometry, point_tag>
 template <typename Geometry>
 struct read_shapefile<Geometry, multi_point_tag>
 {
-    template <typename IStream, typename MultiPoints, typename Strategy>
-    static inline void apply(IStream &is, MultiPoints & multi_points, Strategy const& strategy)
+    template <typename IStream, typename Records, typename MultiPoints, typename Strategy>
+    static inline void apply(IStream &is, Records & records, MultiPoints & multi_points,
+                             Strategy const& strategy)
     {
         namespace shp = detail::shapefile;
         
@@ -814,13 +1093,13 @@ struct read_shapefile<Geometry, multi_point_tag>
             || type == shp::shape_type::point_m
             || type == shp::shape_type::point_z)
         {
-            shp::add_records_as_new_element<shp::read_point_policy>(is, multi_points, type, strategy);
+            shp::add_records_as_new_element<shp::read_point_policy>(is, records, multi_points, type, strategy);
         }
         else if (type == detail::shapefile::shape_type::multipoint
               || type == detail::shapefile::shape_type::multipoint_m
               || type == detail::shapefile::shape_type::multipoint_z)
         {
-            shp::add_records_as_new_elements<shp::read_multipoint_policy>(is, multi_points, type, strategy);
+            shp::add_records_as_new_elements<shp::read_multipoint_policy>(is, records, multi_points, type, strategy);
         }
     }
 };
@@ -828,8 +1107,9 @@ struct read_shapefile<Geometry, multi_point_tag>
 template <typename Geometry>
 struct read_shapefile<Geometry, linestring_tag>
 {
-    template <typename IStream, typename Linestrings, typename Strategy>
-    static inline void apply(IStream &is, Linestrings & linestrings, Strategy const& strategy)
+    template <typename IStream, typename Records, typename Linestrings, typename Strategy>
+    static inline void apply(IStream &is, Records & records, Linestrings & linestrings,
+                             Strategy const& strategy)
     {
         namespace shp = detail::shapefile;
 
@@ -839,7 +1119,7 @@ struct read_shapefile<Geometry, linestring_tag>
             || type == shp::shape_type::polyline_m
             || type == shp::shape_type::polyline_z)
         {
-            shp::add_records<shp::read_polyline_policy>(is, linestrings, type, strategy);
+            shp::add_records<shp::read_polyline_policy>(is, records, linestrings, type, strategy);
         }
     }
 };
@@ -847,8 +1127,9 @@ struct read_shapefile<Geometry, linestring_tag>
 template <typename Geometry>
 struct read_shapefile<Geometry, multi_linestring_tag>
 {
-    template <typename IStream, typename MultiLinestrings, typename Strategy>
-    static inline void apply(IStream &is, MultiLinestrings & multi_linestrings, Strategy const& strategy)
+    template <typename IStream, typename Records, typename MultiLinestrings, typename Strategy>
+    static inline void apply(IStream &is, Records & records, MultiLinestrings & multi_linestrings,
+                             Strategy const& strategy)
     {
         namespace shp = detail::shapefile;
 
@@ -858,7 +1139,7 @@ struct read_shapefile<Geometry, multi_linestring_tag>
             || type == shp::shape_type::polyline_m
             || type == shp::shape_type::polyline_z)
         {
-            shp::add_records_as_new_elements<shp::read_polyline_policy>(is, multi_linestrings, type, strategy);
+            shp::add_records_as_new_elements<shp::read_polyline_policy>(is, records, multi_linestrings, type, strategy);
         }
     }
 };
@@ -866,8 +1147,9 @@ struct read_shapefile<Geometry, multi_linestring_tag>
 template <typename Geometry>
 struct read_shapefile<Geometry, polygon_tag>
 {
-    template <typename IStream, typename Polygons, typename Strategy>
-    static inline void apply(IStream &is, Polygons & polygons, Strategy const& strategy)
+    template <typename IStream, typename Records, typename Polygons, typename Strategy>
+    static inline void apply(IStream &is, Records & records, Polygons & polygons,
+                             Strategy const& strategy)
     {
         namespace shp = detail::shapefile;
 
@@ -877,7 +1159,7 @@ struct read_shapefile<Geometry, polygon_tag>
             || type == shp::shape_type::polygon_m
             || type == shp::shape_type::polygon_z)
         {
-            shp::add_records<shp::read_polygon_policy>(is, polygons, type, strategy);
+            shp::add_records<shp::read_polygon_policy>(is, records, polygons, type, strategy);
         }
     }
 };
@@ -885,8 +1167,9 @@ struct read_shapefile<Geometry, polygon_tag>
 template <typename Geometry>
 struct read_shapefile<Geometry, multi_polygon_tag>
 {
-    template <typename IStream, typename MultiPolygons, typename Strategy>
-    static inline void apply(IStream &is, MultiPolygons & multi_polygons, Strategy const& strategy)
+    template <typename IStream, typename Records, typename MultiPolygons, typename Strategy>
+    static inline void apply(IStream &is, Records & records, MultiPolygons & multi_polygons,
+                             Strategy const& strategy)
     {
         namespace shp = detail::shapefile;
 
@@ -896,7 +1179,7 @@ struct read_shapefile<Geometry, multi_polygon_tag>
             || type == shp::shape_type::polygon_m
             || type == shp::shape_type::polygon_z)
         {
-            shp::add_records_as_new_elements<shp::read_polygon_policy>(is, multi_polygons, type, strategy);
+            shp::add_records_as_new_elements<shp::read_polygon_policy>(is, records, multi_polygons, type, strategy);
         }
     }
 };
@@ -905,10 +1188,65 @@ struct read_shapefile<Geometry, multi_polygon_tag>
 } // namespace dispatch
 
 
-// Note: if an exception is thrown the output range may contain partial data
-template <typename IStream, typename RangeOfGeometries, typename Strategy>
-inline void read_shapefile(IStream &is, RangeOfGeometries & range_of_geometries,
-                           Strategy const& strategy)
+/*!
+\brief Index of the records of a shapefile, read from its .shx file
+\details The offsets of the records are used to read the records of the
+    .shp file in any order, e.g. by read_shapefile_record.
+\ingroup io
+*/
+class shapefile_index
+{
+public:
+    /*!
+    \brief Reads the index
+    \param shx stream of the .shx file, std::istream or memory_stream
+    */
+    template <typename IStream>
+    explicit shapefile_index(IStream & shx)
+    {
+        detail::shapefile::read_index(shx, m_offsets);
+    }
+
+    //! Number of records
+    inline std::size_t size() const { return m_offsets.size(); }
+
+    //! Position of the record in the .shp file, in bytes
+    inline boost::uint64_t offset(std::size_t record) const
+    {
+        return boost::uint64_t(m_offsets[record]) * 2;
+    }
+
+    inline std::vector<boost::uint32_t> const& offsets() const
+    {
+        return m_offsets;
+    }
+
+private:
+    // In 16-bit words, like in the file
+    std::vector<boost::uint32_t> m_offsets;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace shapefile
+{
+
+template <typename RangeOfGeometries>
+struct default_strategy
+{
+    typedef typename strategy::io::services::default_strategy
+        <
+            typename cs_tag
+                <
+                    typename boost::range_value<RangeOfGeometries>::type
+                >::type
+        >::type type;
+};
+
+template <typename IStream, typename Records, typename RangeOfGeometries, typename Strategy>
+inline void read_records(IStream &is, Records & records,
+                         RangeOfGeometries & range_of_geometries,
+                         Strategy const& strategy)
 {
     typedef typename boost::range_value<RangeOfGeometries>::type geometry_type;
 
@@ -916,25 +1254,111 @@ inline void read_shapefile(IStream &is, RangeOfGeometries & range_of_geometries,
 
     detail::shapefile::double_endianness_check();
 
-    dispatch::read_shapefile<geometry_type>::apply(is, range_of_geometries,
+    dispatch::read_shapefile<geometry_type>::apply(is, records,
+                                                   range_of_geometries,
                                                    strategy);
 }
 
+}} // namespace detail::shapefile
+#endif // DOXYGEN_NO_DETAIL
+
+
+// Note: if an exception is thrown the output range may contain partial data
+template <typename IStream, typename RangeOfGeometries, typename Strategy>
+inline void read_shapefile(IStream &is, RangeOfGeometries & range_of_geometries,
+                           Strategy const& strategy)
+{
+    detail::shapefile::sequential_records records;
+    detail::shapefile::read_records(is, records, range_of_geometries, strategy);
+}
+
 template <typename IStream, typename RangeOfGeometries>
 inline void read_shapefile(IStream &is, RangeOfGeometries & range_of_geometries)
 {
-    typedef typename boost::range_value<RangeOfGeometries>::type geometry_type;
-    typedef typename strategy::io::services::default_strategy
+    typedef typename detail::shapefile::default_strategy
         <
-            typename cs_tag<geometry_type>::type
+            RangeOfGeometries
         >::type strategy_type;
 
-    geometry::concepts::check<geometry_type>();
+    read_shapefile(is, range_of_geometries, strategy_type());
+}
 
-    detail::shapefile::double_endianness_check();
+/*!
+\brief Reads the records of a shapefile whose bounding boxes intersect a box
+\details The records are positioned with the index. Only the bounding
+    box of the other records is read, they are not decoded. The records
+    are added to the range like by read_shapefile. The stream can be a
+    memory_stream, e.g. over a memory mapped file.
+\param is stream of the .shp file
+\param index index read from the .shx file
+\param range_of_geometries output range
+\param box the box, only x and y coordinates are compared
+\param strategy io strategy
+\note If an exception is thrown the output range may contain partial data
+\ingroup io
+*/
+template <typename IStream, typename RangeOfGeometries, typename Box, typename Strategy>
+inline void read_shapefile(IStream &is, shapefile_index const& index,
+                           RangeOfGeometries & range_of_geometries,
+                           Box const& box, Strategy const& strategy)
+{
+    concepts::check<Box const>();
+
+    typedef detail::shapefile::indexed_records indexed_type;
+    indexed_type indexed(index.offsets(), 0, index.size());
+    detail::shapefile::filtered_records<indexed_type, Box> records(indexed, box);
+    detail::shapefile::read_records(is, records, range_of_geometries, strategy);
+}
+
+template <typename IStream, typename RangeOfGeometries, typename Box>
+inline void read_shapefile(IStream &is, shapefile_index const& index,
+                           RangeOfGeometries & range_of_geometries,
+                           Box const& box)
+{
+    typedef typename detail::shapefile::default_strategy
+        <
+            RangeOfGeometries
+        >::type strategy_type;
+
+    read_shapefile(is, index, range_of_geometries, box, strategy_type());
+}
+
+/*!
+\brief Reads one record of a shapefile, positioned with the index
+\details The record is added to the range like by read_shapefile.
+\param is stream of the .shp file
+\param index index read from the .shx file
+\param record number of the record, starting at 0
+\param range_of_geometries output range
+\param strategy io strategy
+\ingroup io
+*/
+template <typename IStream, typename RangeOfGeometries, typename Strategy>
+inline void read_shapefile_record(IStream &is, shapefile_index const& index,
+                                  std::size_t record,
+                                  RangeOfGeometries & range_of_geometries,
+                                  Strategy const& strategy)
+{
+    if (record >= index.size())
+    {
+        BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid record number"));
+    }
+
+    detail::shapefile::indexed_records records(index.offsets(), record, record + 1);
+    detail::shapefile::read_records(is, records, range_of_geometries, strategy);
+}
+
+template <typename IStream, typename RangeOfGeometries>
+inline void read_shapefile_record(IStream &is, shapefile_index const& index,
+                                  std::size_t record,
+                                  RangeOfGeometries & range_of_geometries)
+{
+    typedef typename detail::shapefile::default_strategy
+        <
+            RangeOfGeometries
+        >::type strategy_type;
 
-    dispatch::read_shapefile<geometry_type>::apply(is, range_of_geometries,
-                                                   strategy_type());
+    read_shapefile_record(is, index, record, range_of_geometries, strategy_type());
 }
 
 
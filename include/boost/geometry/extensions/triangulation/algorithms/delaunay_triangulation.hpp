@@ -0,0 +1,504 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_DELAUNAY_TRIANGULATION_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_DELAUNAY_TRIANGULATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/extensions/triangulation/algorithms/detail/spatial_sort.hpp>
+#include <boost/geometry/extensions/triangulation/geometries/triangulation.hpp>
+#include <boost/geometry/extensions/triangulation/strategies/cartesian/in_circle_robust.hpp>
+#include <boost/geometry/extensions/triangulation/strategies/cartesian/side_robust.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace delaunay_triangulation
+{
+
+// Incremental construction (Bowyer-Watson) in BRIO order. The convex hull
+// is closed with ghost triangles sharing a vertex at infinity, so points
+// outside the hull, on hull edges and inside are inserted in the same way:
+// the triangles in conflict with the new point form a star-shaped cavity,
+// which is retriangulated by connecting its boundary to the point.
+template
+<
+    typename Triangulation,
+    typename SideStrategy,
+    typename InCircleStrategy
+>
+class incremental_builder
+{
+    typedef typename Triangulation::index_type index_type;
+    typedef typename Triangulation::point_type point_type;
+
+    static constexpr index_type invalid = Triangulation::invalid_index;
+    // Vertex at infinity, the apex of all ghost triangles
+    static constexpr index_type infinite = Triangulation::invalid_index;
+
+    struct boundary_edge
+    {
+        index_type from, to, outside;
+    };
+
+public:
+    explicit incremental_builder(Triangulation& triangulation)
+        : m_points(triangulation.points())
+        , m_vertices(triangulation.vertices())
+        , m_opposites(triangulation.opposites())
+        , m_stamp(0)
+        , m_last(0)
+        , m_walk(0)
+    {}
+
+    void apply()
+    {
+        m_vertices.clear();
+        m_opposites.clear();
+
+        std::vector<index_type> order;
+        detail::spatial_sort::brio_order(m_points, order);
+
+        std::size_t first_three[3];
+        if (! initialize(order, first_three))
+        {
+            // Less than three distinct or only collinear points
+            m_vertices.clear();
+            m_opposites.clear();
+            return;
+        }
+
+        m_vertices.reserve(6 * m_points.size() + 12);
+        m_opposites.reserve(6 * m_points.size() + 12);
+        m_marks.reserve(2 * m_points.size() + 4);
+
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            if (i != first_three[0] && i != first_three[1]
+                && i != first_three[2])
+            {
+                insert(order[i]);
+            }
+        }
+
+        compact();
+    }
+
+private:
+    static inline index_type next(index_type e)
+    {
+        return Triangulation::next(e);
+    }
+
+    inline int side(index_type a, index_type b, point_type const& p) const
+    {
+        return SideStrategy::apply(m_points[a], m_points[b], p);
+    }
+
+    inline bool is_ghost(index_type t) const
+    {
+        return m_vertices[3 * t] == infinite
+            || m_vertices[3 * t + 1] == infinite
+            || m_vertices[3 * t + 2] == infinite;
+    }
+
+    static inline bool equals(point_type const& p1, point_type const& p2)
+    {
+        return get<0>(p1) == get<0>(p2) && get<1>(p1) == get<1>(p2);
+    }
+
+    // Finds three non-collinear points to start with. Returns their
+    // positions in the order.
+    bool initialize(std::vector<index_type> const& order,
+                    std::size_t (&positions)[3])
+    {
+        std::size_t const count = order.size();
+        if (count < 3)
+        {
+            return false;
+        }
+
+        positions[0] = 0;
+        point_type const& p0 = m_points[order[0]];
+
+        std::size_t i = 1;
+        while (i < count && equals(m_points[order[i]], p0))
+        {
+            ++i;
+        }
+        if (i == count)
+        {
+            return false;
+        }
+        positions[1] = i;
+
+        std::size_t j = i + 1;
+        while (j < count && side(order[0], order[i], m_points[order[j]]) == 0)
+        {
+            ++j;
+        }
+        if (j == count)
+        {
+            return false;
+        }
+        positions[2] = j;
+
+        index_type a = order[0], b = order[i], c = order[j];
+        if (side(a, b, m_points[c]) < 0)
+        {
+            std::swap(b, c);
+        }
+
+        // One finite triangle and the three ghost triangles at its edges
+        index_type const initial[] = { a, b, c,
+                                       b, a, infinite,
+                                       c, b, infinite,
+                                       a, c, infinite };
+        m_vertices.assign(initial, initial + 12);
+        m_opposites.assign(12, invalid);
+        m_marks.assign(4, 0);
+        for (index_type e = 0; e < 12; ++e)
+        {
+            for (index_type f = 0; f < 12; ++f)
+            {
+                if (m_vertices[e] == m_vertices[next(f)]
+                    && m_vertices[next(e)] == m_vertices[f])
+                {
+                    m_opposites[e] = f;
+                }
+            }
+        }
+        m_last = 0;
+        return true;
+    }
+
+    // Visibility walk from the last created triangle to the triangle
+    // containing p, or to a ghost triangle if p is outside the hull.
+    index_type locate(point_type const& p)
+    {
+        index_type t = m_last;
+        for (;;)
+        {
+            bool moved = false;
+            // Rotate the first tested edge, avoiding cycles in walks on
+            // triangulations which are not Delaunay due to rounding
+            std::size_t const offset = m_walk++ % 3;
+            for (std::size_t k = 0; k < 3 && ! moved; ++k)
+            {
+                index_type const e = 3 * t + (k + offset) % 3;
+                if (side(m_vertices[e], m_vertices[next(e)], p) < 0)
+                {
+                    t = m_opposites[e] / 3;
+                    moved = true;
+                }
+            }
+            if (! moved || is_ghost(t))
+            {
+                return t;
+            }
+        }
+    }
+
+    bool in_conflict(index_type t, point_type const& p) const
+    {
+        for (index_type i = 0; i < 3; ++i)
+        {
+            if (m_vertices[3 * t + i] == infinite)
+            {
+                // The finite edge b-a of the ghost triangle, seen from its
+                // finite neighbour as a-b
+                index_type const b = m_vertices[3 * t + (i + 1) % 3];
+                index_type const a = m_vertices[3 * t + (i + 2) % 3];
+                int const s = side(b, a, p);
+                if (s != 0)
+                {
+                    return s > 0;
+                }
+                return strictly_between(m_points[a], m_points[b], p);
+            }
+        }
+        return InCircleStrategy::apply(m_points[m_vertices[3 * t]],
+                                       m_points[m_vertices[3 * t + 1]],
+                                       m_points[m_vertices[3 * t + 2]],
+                                       p) > 0;
+    }
+
+    // For p collinear with segment a-b
+    static inline bool strictly_between(point_type const& a,
+                                        point_type const& b,
+                                        point_type const& p)
+    {
+        if (get<0>(a) != get<0>(b))
+        {
+            return (get<0>(a) < get<0>(p) && get<0>(p) < get<0>(b))
+                || (get<0>(b) < get<0>(p) && get<0>(p) < get<0>(a));
+        }
+        return (get<1>(a) < get<1>(p) && get<1>(p) < get<1>(b))
+            || (get<1>(b) < get<1>(p) && get<1>(p) < get<1>(a));
+    }
+
+    index_type allocate_triangle()
+    {
+        if (! m_free.empty())
+        {
+            index_type const t = m_free.back();
+            m_free.pop_back();
+            return t;
+        }
+        index_type const t = static_cast<index_type>(m_vertices.size() / 3);
+        m_vertices.resize(m_vertices.size() + 3, invalid);
+        m_opposites.resize(m_opposites.size() + 3, invalid);
+        m_marks.push_back(0);
+        return t;
+    }
+
+    void insert(index_type v)
+    {
+        point_type const& p = m_points[v];
+        index_type const start = locate(p);
+
+        if (! is_ghost(start))
+        {
+            for (index_type i = 0; i < 3; ++i)
+            {
+                if (equals(m_points[m_vertices[3 * start + i]], p))
+                {
+                    // Duplicate point, it is not part of the triangulation
+                    return;
+                }
+            }
+        }
+
+        // Collect the cavity, the triangles in conflict with p which are
+        // connected to the one containing it
+        m_stamp += 2;
+        std::size_t const in_cavity = m_stamp;
+        std::size_t const rejected = m_stamp + 1;
+
+        m_cavity.clear();
+        m_boundary.clear();
+        m_stack.clear();
+        m_stack.push_back(start);
+        m_marks[start] = in_cavity;
+        while (! m_stack.empty())
+        {
+            index_type const t = m_stack.back();
+            m_stack.pop_back();
+            m_cavity.push_back(t);
+            for (index_type i = 0; i < 3; ++i)
+            {
+                index_type const e = 3 * t + i;
+                index_type const o = m_opposites[e];
+                index_type const neighbour = o / 3;
+                if (m_marks[neighbour] == in_cavity)
+                {
+                    continue;
+                }
+                if (m_marks[neighbour] == rejected || ! in_conflict(neighbour, p))
+                {
+                    m_marks[neighbour] = rejected;
+                    boundary_edge const edge = { m_vertices[e],
+                                                 m_vertices[next(e)], o };
+                    m_boundary.push_back(edge);
+                    continue;
+                }
+                m_marks[neighbour] = in_cavity;
+                m_stack.push_back(neighbour);
+            }
+        }
+
+        m_free.insert(m_free.end(), m_cavity.begin(), m_cavity.end());
+
+        // Connect every boundary edge u-v to p, keeping the orientation
+        m_created.clear();
+        for (std::size_t i = 0; i < m_boundary.size(); ++i)
+        {
+            boundary_edge const& edge = m_boundary[i];
+            index_type const t = allocate_triangle();
+            m_marks[t] = 0;
+            m_vertices[3 * t] = edge.from;
+            m_vertices[3 * t + 1] = edge.to;
+            m_vertices[3 * t + 2] = v;
+            m_opposites[3 * t] = edge.outside;
+            m_opposites[edge.outside] = 3 * t;
+            m_created.push_back(std::make_pair(edge.from, t));
+        }
+
+        // The new triangles form a closed fan around p: the edge v-p of
+        // the triangle for u-v is shared with the triangle for v-w
+        std::sort(m_created.begin(), m_created.end());
+        for (std::size_t i = 0; i < m_created.size(); ++i)
+        {
+            index_type const t = m_created[i].second;
+            index_type const to = m_vertices[3 * t + 1];
+            typename std::vector<std::pair<index_type, index_type> >::const_iterator
+                it = std::lower_bound(m_created.begin(), m_created.end(),
+                                      std::make_pair(to, index_type(0)));
+            index_type const n = it->second;
+            m_opposites[3 * t + 1] = 3 * n + 2;
+            m_opposites[3 * n + 2] = 3 * t + 1;
+            if (! is_ghost(t))
+            {
+                m_last = t;
+            }
+        }
+    }
+
+    // Removes ghost and free triangles, numbering the others consecutively
+    void compact()
+    {
+        std::size_t const count = m_vertices.size() / 3;
+        std::vector<index_type> renumbered(count, invalid);
+
+        // Free triangles are marked ghost for the renumbering
+        for (std::size_t i = 0; i < m_free.size(); ++i)
+        {
+            m_vertices[3 * m_free[i]] = infinite;
+        }
+
+        index_type finite = 0;
+        for (index_type t = 0; t < count; ++t)
+        {
+            if (! is_ghost(t))
+            {
+                renumbered[t] = finite++;
+            }
+        }
+
+        for (index_type t = 0; t < count; ++t)
+        {
+            index_type const target = renumbered[t];
+            if (target == invalid)
+            {
+                continue;
+            }
+            for (index_type i = 0; i < 3; ++i)
+            {
+                index_type const o = m_opposites[3 * t + i];
+                index_type const neighbour = renumbered[o / 3];
+                m_vertices[3 * target + i] = m_vertices[3 * t + i];
+                m_opposites[3 * target + i] = neighbour == invalid
+                    ? invalid : 3 * neighbour + o % 3;
+            }
+        }
+
+        m_vertices.resize(3 * finite);
+        m_opposites.resize(3 * finite);
+    }
+
+    typename Triangulation::point_container_type const& m_points;
+    typename Triangulation::index_container_type& m_vertices;
+    typename Triangulation::index_container_type& m_opposites;
+
+    std::vector<std::size_t> m_marks;
+    std::size_t m_stamp;
+    index_type m_last;
+    std::size_t m_walk;
+
+    std::vector<index_type> m_free;
+    std::vector<index_type> m_cavity;
+    std::vector<index_type> m_stack;
+    std::vector<boundary_edge> m_boundary;
+    std::vector<std::pair<index_type, index_type> > m_created;
+};
+
+template <typename T, typename S, typename I>
+constexpr typename T::index_type incremental_builder<T, S, I>::invalid;
+
+template <typename T, typename S, typename I>
+constexpr typename T::index_type incremental_builder<T, S, I>::infinite;
+
+}} // namespace detail::delaunay_triangulation
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Computes the Delaunay triangulation of a multi_point
+\ingroup triangulation
+\details The triangulation is built incrementally in a biased randomized
+    insertion order, sorted along a Hilbert curve per round, which makes its
+    expected running time O(n log n) and nearly linear in practice. All
+    geometric decisions are made by the specified predicates, by default the
+    adaptive precision predicates side_robust and in_circle_robust, so the
+    result is consistent also for degenerate input. Duplicate points are
+    inserted only once. For less than three distinct or only collinear
+    points the output contains no triangles.
+\tparam MultiPoint \tparam_geometry
+\tparam Triangulation model::triangulation
+\param multi_point input points
+\param output the triangulation, its points are the input points in the
+    original order
+\param side_strategy side strategy, its apply must be static
+\param in_circle_strategy in_circle strategy, its apply must be static
+ */
+template
+<
+    typename MultiPoint,
+    typename Triangulation,
+    typename SideStrategy,
+    typename InCircleStrategy
+>
+inline void delaunay_triangulation(MultiPoint const& multi_point,
+                                   Triangulation& output,
+                                   SideStrategy const& ,
+                                   InCircleStrategy const& )
+{
+    concepts::check<MultiPoint const>();
+
+    typedef typename boost::range_iterator<MultiPoint const>::type iterator;
+    typedef typename Triangulation::point_type point_type;
+
+    output.clear();
+    output.points().reserve(boost::size(multi_point));
+    for (iterator it = boost::begin(multi_point);
+         it != boost::end(multi_point); ++it)
+    {
+        point_type p;
+        geometry::convert(*it, p);
+        output.points().push_back(p);
+    }
+
+    detail::delaunay_triangulation::incremental_builder
+        <
+            Triangulation, SideStrategy, InCircleStrategy
+        > builder(output);
+    builder.apply();
+}
+
+/*!
+\brief Computes the Delaunay triangulation of a multi_point
+\ingroup triangulation
+\tparam MultiPoint \tparam_geometry
+\tparam Triangulation model::triangulation
+\param multi_point input points
+\param output the triangulation
+ */
+template <typename MultiPoint, typename Triangulation>
+inline void delaunay_triangulation(MultiPoint const& multi_point,
+                                   Triangulation& output)
+{
+    delaunay_triangulation(multi_point, output,
+                           strategy::side::side_robust<>(),
+                           strategy::in_circle::in_circle_robust<>());
+}
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_DELAUNAY_TRIANGULATION_HPP
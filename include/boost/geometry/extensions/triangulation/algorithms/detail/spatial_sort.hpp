@@ -0,0 +1,151 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_DETAIL_SPATIAL_SORT_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_DETAIL_SPATIAL_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace spatial_sort
+{
+
+// Number of bits per coordinate of the grid the Hilbert curve is defined on
+static std::size_t const hilbert_order = 16;
+
+// Distance of cell (x, y) along the Hilbert curve filling the
+// 2^hilbert_order x 2^hilbert_order grid
+inline std::uint64_t hilbert_index(std::uint32_t x, std::uint32_t y)
+{
+    std::uint32_t const n = std::uint32_t(1) << hilbert_order;
+    std::uint64_t d = 0;
+    for (std::uint32_t s = n / 2; s > 0; s /= 2)
+    {
+        std::uint32_t const rx = (x & s) > 0 ? 1 : 0;
+        std::uint32_t const ry = (y & s) > 0 ? 1 : 0;
+        d += std::uint64_t(s) * s * ((3 * rx) ^ ry);
+        // Rotate the quadrant
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+template <typename Points>
+struct hilbert_keys
+{
+    explicit hilbert_keys(Points const& points)
+        : m_points(points)
+    {
+        if (points.empty())
+        {
+            return;
+        }
+        m_min_x = m_max_x = get<0>(points[0]);
+        m_min_y = m_max_y = get<1>(points[0]);
+        for (std::size_t i = 1; i < points.size(); ++i)
+        {
+            double const x = get<0>(points[i]);
+            double const y = get<1>(points[i]);
+            m_min_x = (std::min)(m_min_x, x);
+            m_max_x = (std::max)(m_max_x, x);
+            m_min_y = (std::min)(m_min_y, y);
+            m_max_y = (std::max)(m_max_y, y);
+        }
+        double const cells = double((std::uint32_t(1) << hilbert_order) - 1);
+        m_scale_x = m_max_x > m_min_x ? cells / (m_max_x - m_min_x) : 0.0;
+        m_scale_y = m_max_y > m_min_y ? cells / (m_max_y - m_min_y) : 0.0;
+    }
+
+    std::uint64_t operator()(std::size_t i) const
+    {
+        std::uint32_t const x = std::uint32_t(
+            (get<0>(m_points[i]) - m_min_x) * m_scale_x);
+        std::uint32_t const y = std::uint32_t(
+            (get<1>(m_points[i]) - m_min_y) * m_scale_y);
+        return hilbert_index(x, y);
+    }
+
+private:
+    Points const& m_points;
+    double m_min_x = 0, m_max_x = 0, m_min_y = 0, m_max_y = 0;
+    double m_scale_x = 0, m_scale_y = 0;
+};
+
+template <typename Index, typename Keys>
+inline void sort_by_keys(std::vector<Index>& order, std::size_t first,
+                         std::size_t last, Keys const& keys)
+{
+    std::vector<std::pair<std::uint64_t, Index> > keyed;
+    keyed.reserve(last - first);
+    for (std::size_t i = first; i < last; ++i)
+    {
+        keyed.push_back(std::make_pair(keys(order[i]), order[i]));
+    }
+    std::sort(keyed.begin(), keyed.end());
+    for (std::size_t i = first; i < last; ++i)
+    {
+        order[i] = keyed[i - first].second;
+    }
+}
+
+/*!
+\brief Returns an insertion order of the points: a biased randomized
+    insertion order (BRIO), with each round sorted along a Hilbert curve.
+\details The points are shuffled and divided into rounds of doubling size.
+    Randomization keeps the expected cost of incremental constructions low
+    while the spatial order within a round keeps consecutive points close,
+    so walks to locate them are short.
+ */
+template <typename Index, typename Points>
+inline void brio_order(Points const& points, std::vector<Index>& order)
+{
+    static std::size_t const min_round_size = 64;
+
+    std::size_t const count = points.size();
+    order.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        order[i] = static_cast<Index>(i);
+    }
+
+    // Fixed seed, the triangulation should be reproducible
+    std::mt19937 generator(5489u);
+    std::shuffle(order.begin(), order.end(), generator);
+
+    hilbert_keys<Points> const keys(points);
+    std::size_t last = count;
+    while (last > 0)
+    {
+        std::size_t const first = last > min_round_size ? last / 2 : 0;
+        sort_by_keys(order, first, last, keys);
+        last = first;
+    }
+}
+
+}} // namespace detail::spatial_sort
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_DETAIL_SPATIAL_SORT_HPP
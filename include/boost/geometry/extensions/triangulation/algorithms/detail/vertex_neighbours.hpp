@@ -0,0 +1,82 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_DETAIL_VERTEX_NEIGHBOURS_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_DETAIL_VERTEX_NEIGHBOURS_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace triangulation
+{
+
+// Assigns one outgoing half-edge to every vertex, invalid_index for points
+// which are not part of the triangulation. For vertices on the boundary it
+// is the outgoing boundary half-edge, the first one in counterclockwise
+// order around the vertex.
+template <typename Triangulation>
+inline void incident_half_edges(Triangulation const& tri,
+    std::vector<typename Triangulation::index_type>& incident)
+{
+    typedef typename Triangulation::index_type index_type;
+
+    incident.assign(tri.points().size(), Triangulation::invalid_index);
+    for (index_type e = 0; e < tri.half_edges_count(); ++e)
+    {
+        index_type const v = tri.vertex(e);
+        if (incident[v] == Triangulation::invalid_index
+            || tri.opposite(e) == Triangulation::invalid_index)
+        {
+            incident[v] = e;
+        }
+    }
+}
+
+// Calls visitor(neighbour) for all vertices connected to v by an edge, in
+// counterclockwise order. Stops early if the visitor returns false.
+template <typename Triangulation, typename Visitor>
+inline void for_each_neighbour(Triangulation const& tri,
+    std::vector<typename Triangulation::index_type> const& incident,
+    typename Triangulation::index_type v,
+    Visitor& visitor)
+{
+    typedef typename Triangulation::index_type index_type;
+
+    index_type const first = incident[v];
+    if (first == Triangulation::invalid_index)
+    {
+        return;
+    }
+
+    index_type e = first;
+    do
+    {
+        if (! visitor(tri.vertex(Triangulation::next(e))))
+        {
+            return;
+        }
+        index_type const incoming = Triangulation::prev(e);
+        index_type const o = tri.opposite(incoming);
+        if (o == Triangulation::invalid_index)
+        {
+            // Last neighbour of a boundary vertex
+            visitor(tri.vertex(incoming));
+            return;
+        }
+        e = o;
+    } while (e != first);
+}
+
+}} // namespace detail::triangulation
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_DETAIL_VERTEX_NEIGHBOURS_HPP
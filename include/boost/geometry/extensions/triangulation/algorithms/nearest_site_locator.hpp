@@ -0,0 +1,289 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_NEAREST_SITE_LOCATOR_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_NEAREST_SITE_LOCATOR_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/extensions/triangulation/algorithms/delaunay_triangulation.hpp>
+#include <boost/geometry/extensions/triangulation/algorithms/detail/vertex_neighbours.hpp>
+#include <boost/geometry/extensions/triangulation/geometries/triangulation.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace nearest_site
+{
+
+template <typename P1, typename P2>
+inline double squared_distance(P1 const& p1, P2 const& p2)
+{
+    double const dx = double(get<0>(p1)) - double(get<0>(p2));
+    double const dy = double(get<1>(p1)) - double(get<1>(p2));
+    return dx * dx + dy * dy;
+}
+
+template <typename Points, typename Point, typename Index>
+struct closer_neighbour
+{
+    closer_neighbour(Points const& points, Point const& p,
+                     Index current, double distance)
+        : m_points(points)
+        , m_point(p)
+        , best(current)
+        , best_distance(distance)
+    {}
+
+    bool operator()(Index neighbour)
+    {
+        double const d = squared_distance(m_points[neighbour], m_point);
+        if (d < best_distance)
+        {
+            best = neighbour;
+            best_distance = d;
+        }
+        return true;
+    }
+
+    Points const& m_points;
+    Point const& m_point;
+    Index best;
+    double best_distance;
+};
+
+}} // namespace detail::nearest_site
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Nearest site queries on a static set of points, by walking the
+    Delaunay triangulation
+\ingroup triangulation
+\details In a Delaunay triangulation every vertex which is not the nearest
+    to a query point has a neighbour closer to it. So the nearest site is
+    found by a greedy walk over the edges. The walk starts at a site stored
+    in a coarse grid over the sites, which makes the expected number of
+    steps constant for reasonably distributed sites. A site known to be
+    close (for example the result of the previous query of a spatially
+    coherent sequence) can be passed as a hint instead.
+    If all sites are collinear, queries fall back to a linear scan.
+\tparam Point point type of the sites
+\tparam Index unsigned integral type of site indices
+ */
+template <typename Point, typename Index = std::size_t>
+class nearest_site_locator
+{
+public:
+    typedef model::triangulation<Point, Index> triangulation_type;
+    typedef Index index_type;
+
+    static constexpr index_type invalid_index = triangulation_type::invalid_index;
+
+    /*!
+    \brief Constructs the locator for the points of a multi_point, the
+        Delaunay triangulation is computed
+    */
+    template <typename MultiPoint>
+    explicit nearest_site_locator(MultiPoint const& sites)
+    {
+        concepts::check<MultiPoint const>();
+        delaunay_triangulation(sites, m_triangulation);
+        init();
+    }
+
+    //! \brief Constructs the locator for an existing Delaunay triangulation
+    explicit nearest_site_locator(triangulation_type const& triangulation)
+        : m_triangulation(triangulation)
+    {
+        init();
+    }
+
+    /*!
+    \brief Returns the index of the site nearest to p, invalid_index if there
+        are no sites. Of duplicate sites only one is returned.
+    */
+    template <typename P>
+    index_type nearest(P const& p) const
+    {
+        return nearest(p, invalid_index);
+    }
+
+    /*!
+    \brief Returns the index of the site nearest to p, starting at hint. If
+        hint is not the index of a site, e.g. invalid_index, the walk starts
+        as without hint.
+    */
+    template <typename P>
+    index_type nearest(P const& p, index_type hint) const
+    {
+        if (m_triangulation.empty())
+        {
+            return linear_nearest(p);
+        }
+
+        // invalid_index is the largest index, so it is out of range as well
+        index_type v = hint < m_incident.size()
+                    && m_incident[hint] != triangulation_type::invalid_index
+                     ? hint
+                     : m_grid[cell(p)];
+
+        double distance = detail::nearest_site::squared_distance(
+                m_triangulation.point(v), p);
+        for (;;)
+        {
+            detail::nearest_site::closer_neighbour
+                <
+                    typename triangulation_type::point_container_type,
+                    P, index_type
+                > visitor(m_triangulation.points(), p, v, distance);
+            detail::triangulation::for_each_neighbour(m_triangulation,
+                m_incident, v, visitor);
+            if (visitor.best == v)
+            {
+                return v;
+            }
+            v = visitor.best;
+            distance = visitor.best_distance;
+        }
+    }
+
+    triangulation_type const& triangulation() const
+    {
+        return m_triangulation;
+    }
+
+private:
+    void init()
+    {
+        detail::triangulation::incident_half_edges(m_triangulation, m_incident);
+        if (m_triangulation.empty())
+        {
+            return;
+        }
+
+        std::size_t used = 0;
+        bool first = true;
+        for (std::size_t v = 0; v < m_incident.size(); ++v)
+        {
+            if (m_incident[v] == triangulation_type::invalid_index)
+            {
+                continue;
+            }
+            double const x = get<0>(m_triangulation.point(v));
+            double const y = get<1>(m_triangulation.point(v));
+            if (first)
+            {
+                m_min_x = m_max_x = x;
+                m_min_y = m_max_y = y;
+                first = false;
+            }
+            m_min_x = (std::min)(m_min_x, x);
+            m_max_x = (std::max)(m_max_x, x);
+            m_min_y = (std::min)(m_min_y, y);
+            m_max_y = (std::max)(m_max_y, y);
+            ++used;
+        }
+
+        // About four sites per cell
+        m_cells = (std::max)(std::size_t(1),
+                             std::size_t(std::sqrt(double(used) / 4.0)));
+        m_scale_x = m_max_x > m_min_x ? m_cells / (m_max_x - m_min_x) : 0.0;
+        m_scale_y = m_max_y > m_min_y ? m_cells / (m_max_y - m_min_y) : 0.0;
+
+        m_grid.assign(m_cells * m_cells, invalid_index);
+        std::vector<std::size_t> queue;
+        for (std::size_t v = 0; v < m_incident.size(); ++v)
+        {
+            if (m_incident[v] != triangulation_type::invalid_index)
+            {
+                std::size_t const c = cell(m_triangulation.point(v));
+                if (m_grid[c] == invalid_index)
+                {
+                    m_grid[c] = static_cast<index_type>(v);
+                    queue.push_back(c);
+                }
+            }
+        }
+
+        // Empty cells get the site of a nearby filled cell
+        for (std::size_t i = 0; i < queue.size(); ++i)
+        {
+            std::size_t const c = queue[i];
+            std::size_t const cx = c % m_cells;
+            std::size_t const cy = c / m_cells;
+            std::size_t const neighbours[] = {
+                cx > 0 ? c - 1 : c,
+                cx + 1 < m_cells ? c + 1 : c,
+                cy > 0 ? c - m_cells : c,
+                cy + 1 < m_cells ? c + m_cells : c };
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                if (m_grid[neighbours[k]] == invalid_index)
+                {
+                    m_grid[neighbours[k]] = m_grid[c];
+                    queue.push_back(neighbours[k]);
+                }
+            }
+        }
+    }
+
+    template <typename P>
+    std::size_t cell(P const& p) const
+    {
+        return cell_coordinate(get<0>(p), m_min_x, m_scale_x)
+             + m_cells * cell_coordinate(get<1>(p), m_min_y, m_scale_y);
+    }
+
+    std::size_t cell_coordinate(double value, double min_value,
+                                double scale) const
+    {
+        double const c = (value - min_value) * scale;
+        return c <= 0 ? 0
+             : c >= double(m_cells - 1) ? m_cells - 1
+             : std::size_t(c);
+    }
+
+    template <typename P>
+    index_type linear_nearest(P const& p) const
+    {
+        index_type result = invalid_index;
+        double best = 0;
+        for (std::size_t v = 0; v < m_triangulation.points().size(); ++v)
+        {
+            double const d = detail::nearest_site::squared_distance(
+                    m_triangulation.point(v), p);
+            if (result == invalid_index || d < best)
+            {
+                result = static_cast<index_type>(v);
+                best = d;
+            }
+        }
+        return result;
+    }
+
+    triangulation_type m_triangulation;
+    std::vector<index_type> m_incident;
+
+    std::vector<index_type> m_grid;
+    std::size_t m_cells = 0;
+    double m_min_x = 0, m_max_x = 0, m_min_y = 0, m_max_y = 0;
+    double m_scale_x = 0, m_scale_y = 0;
+};
+
+template <typename Point, typename Index>
+constexpr Index nearest_site_locator<Point, Index>::invalid_index;
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_NEAREST_SITE_LOCATOR_HPP
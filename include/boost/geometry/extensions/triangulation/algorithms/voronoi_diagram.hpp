@@ -0,0 +1,295 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_VORONOI_DIAGRAM_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_VORONOI_DIAGRAM_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/policies/compare.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/extensions/triangulation/algorithms/delaunay_triangulation.hpp>
+#include <boost/geometry/extensions/triangulation/algorithms/detail/vertex_neighbours.hpp>
+#include <boost/geometry/extensions/triangulation/geometries/triangulation.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace voronoi_diagram
+{
+
+struct xy
+{
+    double x, y;
+};
+
+// Convex polygon, open and counterclockwise, clipped by bisectors. The
+// cell of a site is the clip box intersected with the half-planes closer
+// to the site than to each Delaunay neighbour. Neighbours which are not
+// Voronoi neighbours do not cut the cell, so all neighbours can be used.
+class cell_clipper
+{
+public:
+    template <typename Box>
+    void reset(Box const& box)
+    {
+        double const min_x = get<min_corner, 0>(box);
+        double const min_y = get<min_corner, 1>(box);
+        double const max_x = get<max_corner, 0>(box);
+        double const max_y = get<max_corner, 1>(box);
+        xy const corners[] = { {min_x, min_y}, {max_x, min_y},
+                               {max_x, max_y}, {min_x, max_y} };
+        m_cell.assign(corners, corners + 4);
+    }
+
+    // Keeps the part of the cell closer to site than to other
+    void clip(xy const& site, xy const& other)
+    {
+        if (m_cell.empty())
+        {
+            return;
+        }
+
+        double const dx = other.x - site.x;
+        double const dy = other.y - site.y;
+        double const mx = (other.x + site.x) / 2.0;
+        double const my = (other.y + site.y) / 2.0;
+
+        m_clipped.clear();
+        std::size_t const n = m_cell.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            xy const& p = m_cell[i];
+            xy const& q = m_cell[(i + 1) % n];
+            double const fp = (p.x - mx) * dx + (p.y - my) * dy;
+            double const fq = (q.x - mx) * dx + (q.y - my) * dy;
+            if (fp <= 0)
+            {
+                m_clipped.push_back(p);
+            }
+            if ((fp < 0 && fq > 0) || (fp > 0 && fq < 0))
+            {
+                double const t = fp / (fp - fq);
+                xy const ip = { p.x + t * (q.x - p.x), p.y + t * (q.y - p.y) };
+                m_clipped.push_back(ip);
+            }
+        }
+        m_cell.swap(m_clipped);
+    }
+
+    template <typename Polygon>
+    void assign_to(Polygon& polygon) const
+    {
+        typedef typename point_type<Polygon>::type point_type;
+        typedef typename ring_type<Polygon>::type ring_type;
+
+        ring_type& ring = exterior_ring(polygon);
+        range::clear(ring);
+        if (m_cell.size() < 3)
+        {
+            return;
+        }
+
+        std::size_t const n = m_cell.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            std::size_t const index
+                = geometry::point_order<Polygon>::value == counterclockwise
+                ? i : (n - i) % n;
+            point_type p;
+            set<0>(p, m_cell[index].x);
+            set<1>(p, m_cell[index].y);
+            range::push_back(ring, p);
+        }
+        if (geometry::closure<Polygon>::value == closed)
+        {
+            point_type const first = range::front(ring);
+            range::push_back(ring, first);
+        }
+    }
+
+private:
+    std::vector<xy> m_cell;
+    std::vector<xy> m_clipped;
+};
+
+template <typename Point>
+inline xy to_xy(Point const& p)
+{
+    xy const result = { double(get<0>(p)), double(get<1>(p)) };
+    return result;
+}
+
+template <typename Points>
+struct clip_by_neighbour
+{
+    clip_by_neighbour(cell_clipper& clipper, Points const& points, xy const& site)
+        : m_clipper(clipper)
+        , m_points(points)
+        , m_site(site)
+    {}
+
+    template <typename Index>
+    bool operator()(Index neighbour)
+    {
+        m_clipper.clip(m_site, to_xy(m_points[neighbour]));
+        return true;
+    }
+
+    cell_clipper& m_clipper;
+    Points const& m_points;
+    xy m_site;
+};
+
+// Without triangles all distinct points are collinear, ordered
+// lexicographically each point has at most two neighbours
+template <typename Triangulation, typename Box, typename MultiPolygon>
+inline void collinear_cells(Triangulation const& tri, Box const& box,
+                            MultiPolygon& cells)
+{
+    typedef typename Triangulation::point_type point_type;
+
+    std::size_t const count = tri.points().size();
+    std::vector<point_type> sorted(tri.points().begin(), tri.points().end());
+    std::sort(sorted.begin(), sorted.end(), geometry::less<point_type>());
+    sorted.erase(std::unique(sorted.begin(), sorted.end(),
+                             geometry::equal_to<point_type>()), sorted.end());
+
+    std::vector<bool> assigned(sorted.size(), false);
+    cell_clipper clipper;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        point_type const& p = tri.points()[i];
+        std::size_t const s = std::lower_bound(sorted.begin(), sorted.end(), p,
+                geometry::less<point_type>()) - sorted.begin();
+        if (assigned[s])
+        {
+            // Duplicate
+            continue;
+        }
+        assigned[s] = true;
+
+        clipper.reset(box);
+        if (s > 0)
+        {
+            clipper.clip(to_xy(p), to_xy(sorted[s - 1]));
+        }
+        if (s + 1 < sorted.size())
+        {
+            clipper.clip(to_xy(p), to_xy(sorted[s + 1]));
+        }
+        clipper.assign_to(range::at(cells, i));
+    }
+}
+
+}} // namespace detail::voronoi_diagram
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Computes the Voronoi diagram of the points of a Delaunay triangulation,
+    clipped to a box
+\ingroup triangulation
+\details The output contains one polygon per point of the triangulation, in
+    the same order. The cell of point i is the part of the box closer to
+    point i than to any other point. Cells of duplicate points, and cells of
+    sites whose region does not intersect the box, are empty.
+\tparam Point point type of the triangulation
+\tparam Index index type of the triangulation
+\tparam Box \tparam_box
+\tparam MultiPolygon \tparam_geometry
+\param tri Delaunay triangulation, see delaunay_triangulation
+\param box clip box
+\param cells output, resized to the number of points
+ */
+template
+<
+    typename Point,
+    typename Index,
+    typename Box,
+    typename MultiPolygon
+>
+inline void voronoi_diagram(model::triangulation<Point, Index> const& tri,
+                            Box const& box,
+                            MultiPolygon& cells)
+{
+    concepts::check<Box const>();
+    concepts::check<MultiPolygon>();
+
+    typedef model::triangulation<Point, Index> Triangulation;
+    typedef typename Triangulation::index_type index_type;
+    typedef typename Triangulation::point_container_type points_type;
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+    range::clear(cells);
+    range::resize(cells, tri.points().size());
+
+    if (tri.empty())
+    {
+        detail::voronoi_diagram::collinear_cells(tri, box, cells);
+        return;
+    }
+
+    std::vector<index_type> incident;
+    detail::triangulation::incident_half_edges(tri, incident);
+
+    detail::voronoi_diagram::cell_clipper clipper;
+    for (std::size_t v = 0; v < incident.size(); ++v)
+    {
+        if (incident[v] == Triangulation::invalid_index)
+        {
+            continue;
+        }
+        clipper.reset(box);
+        detail::voronoi_diagram::clip_by_neighbour<points_type> visitor(
+            clipper, tri.points(), detail::voronoi_diagram::to_xy(tri.point(v)));
+        detail::triangulation::for_each_neighbour(tri, incident,
+            static_cast<index_type>(v), visitor);
+        polygon_type& cell = range::at(cells, v);
+        clipper.assign_to(cell);
+    }
+}
+
+/*!
+\brief Computes the Voronoi diagram of a multi_point, clipped to a box
+\ingroup triangulation
+\details See the overload taking a triangulation, the cells are in the order
+    of the input points.
+\tparam MultiPoint \tparam_geometry
+\tparam Box \tparam_box
+\tparam MultiPolygon \tparam_geometry
+\param multi_point sites
+\param box clip box
+\param cells output, resized to the number of points
+ */
+template <typename MultiPoint, typename Box, typename MultiPolygon>
+inline void voronoi_diagram(MultiPoint const& multi_point, Box const& box,
+                            MultiPolygon& cells)
+{
+    concepts::check<MultiPoint const>();
+
+    model::triangulation<typename point_type<MultiPoint>::type> tri;
+    delaunay_triangulation(multi_point, tri);
+    voronoi_diagram(tri, box, cells);
+}
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_ALGORITHMS_VORONOI_DIAGRAM_HPP
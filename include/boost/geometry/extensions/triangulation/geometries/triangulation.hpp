@@ -0,0 +1,132 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_GEOMETRIES_TRIANGULATION_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_GEOMETRIES_TRIANGULATION_HPP
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <boost/geometry/geometries/concepts/point_concept.hpp>
+
+namespace boost { namespace geometry
+{
+
+namespace model
+{
+
+/*!
+\brief Planar triangulation of a set of points, stored as half-edges
+\ingroup geometries
+\details The three half-edges of triangle t are 3t, 3t + 1 and 3t + 2, in
+    counterclockwise order. Per half-edge only its origin vertex and its
+    opposite half-edge (in the adjacent triangle) are stored, all other
+    relations follow from the indices. Half-edges on the boundary of the
+    triangulation have no opposite (invalid_index). Vertices are indices into
+    the point container, which may contain points which are not part of any
+    triangle (duplicates).
+\tparam Point point type
+\tparam Index unsigned integral type of vertex and half-edge indices, a 32 bit
+    type halves the memory usage for less than 2^32 / 6 points
+ */
+template <typename Point, typename Index = std::size_t>
+class triangulation
+{
+    BOOST_CONCEPT_ASSERT( (concepts::Point<Point>) );
+
+public:
+    typedef Point point_type;
+    typedef Index index_type;
+    typedef std::vector<Point> point_container_type;
+    typedef std::vector<Index> index_container_type;
+
+    static constexpr index_type invalid_index
+        = (std::numeric_limits<index_type>::max)();
+
+    inline std::size_t triangles_count() const
+    {
+        return m_vertices.size() / 3;
+    }
+
+    inline std::size_t half_edges_count() const
+    {
+        return m_vertices.size();
+    }
+
+    inline bool empty() const
+    {
+        return m_vertices.empty();
+    }
+
+    //! \brief Origin vertex of a half-edge
+    inline index_type vertex(index_type half_edge) const
+    {
+        return m_vertices[half_edge];
+    }
+
+    //! \brief Opposite half-edge or invalid_index for boundary half-edges
+    inline index_type opposite(index_type half_edge) const
+    {
+        return m_opposites[half_edge];
+    }
+
+    static inline index_type next(index_type half_edge)
+    {
+        return half_edge % 3 == 2 ? half_edge - 2 : half_edge + 1;
+    }
+
+    static inline index_type prev(index_type half_edge)
+    {
+        return half_edge % 3 == 0 ? half_edge + 2 : half_edge - 1;
+    }
+
+    static inline index_type triangle(index_type half_edge)
+    {
+        return half_edge / 3;
+    }
+
+    //! \brief Point of a vertex of triangle t, i in [0, 3)
+    inline Point const& triangle_point(std::size_t t, std::size_t i) const
+    {
+        return m_points[m_vertices[3 * t + i]];
+    }
+
+    inline Point const& point(index_type vertex) const
+    {
+        return m_points[vertex];
+    }
+
+    inline point_container_type const& points() const { return m_points; }
+    inline point_container_type& points() { return m_points; }
+
+    inline index_container_type const& vertices() const { return m_vertices; }
+    inline index_container_type& vertices() { return m_vertices; }
+
+    inline index_container_type const& opposites() const { return m_opposites; }
+    inline index_container_type& opposites() { return m_opposites; }
+
+    inline void clear()
+    {
+        m_points.clear();
+        m_vertices.clear();
+        m_opposites.clear();
+    }
+
+private:
+    point_container_type m_points;
+    index_container_type m_vertices;
+    index_container_type m_opposites;
+};
+
+template <typename Point, typename Index>
+constexpr Index triangulation<Point, Index>::invalid_index;
+
+} // namespace model
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_GEOMETRIES_TRIANGULATION_HPP
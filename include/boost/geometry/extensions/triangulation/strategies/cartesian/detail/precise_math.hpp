@@ -12,6 +12,7 @@
 #ifndef BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_STRATEGIES_CARTESIAN_DETAIL_PRECISE_MATH_HPP
 #define BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_STRATEGIES_CARTESIAN_DETAIL_PRECISE_MATH_HPP
 
+#include<algorithm>
 #include<numeric>
 #include<cmath>
 #include<limits>
@@ -588,6 +589,109 @@ RealNumber incircle(std::array<RealNumber, 2> const& p1,
     //}
 }
 
+// Number of tuples evaluated together by the batch predicates. The
+// floating-point stage of a block is written without branches and with
+// only RealNumber arrays, so that it can be vectorized by the compiler.
+// The error bounds are stored and compared in a second pass.
+constexpr std::size_t batch_block_size = 64;
+
+// Batch version of orient2d. The coordinates of tuple i are
+// (p1x[i], p1y[i]), (p2x[i], p2y[i]) and (p3x[i], p3y[i]). The A estimate is
+// computed for all tuples of a block at once; only for tuples for which its
+// sign is not certain, the adaptive stages of orient2d are evaluated.
+template
+<
+    typename RealNumber,
+    std::size_t Robustness = 3
+>
+inline void orient2d_batch(RealNumber const* p1x, RealNumber const* p1y,
+                           RealNumber const* p2x, RealNumber const* p2y,
+                           RealNumber const* p3x, RealNumber const* p3y,
+                           std::size_t count,
+                           RealNumber* det)
+{
+    RealNumber const A_relative_bound =
+          (1.5 + 4 * std::numeric_limits<RealNumber>::epsilon())
+        * std::numeric_limits<RealNumber>::epsilon();
+    for (std::size_t first = 0; first < count; first += batch_block_size) {
+        std::size_t const size = (std::min)(batch_block_size, count - first);
+        RealNumber bound[batch_block_size];
+        for (std::size_t i = first; i < first + size; ++i) {
+            RealNumber const t5 = (p1x[i] - p3x[i]) * (p2y[i] - p3y[i]);
+            RealNumber const t6 = (p1y[i] - p3y[i]) * (p2x[i] - p3x[i]);
+            RealNumber const d = t5 - t6;
+            RealNumber const magnitude = std::abs(t5) + std::abs(t6);
+            det[i] = d;
+            bound[i - first] = A_relative_bound * magnitude;
+        }
+        for (std::size_t i = 0; i < size && Robustness > 0; ++i) {
+            if (!(std::abs(det[first + i]) >= bound[i])) {
+                std::size_t const j = first + i;
+                det[j] = orient2d<RealNumber, Robustness>(
+                    {{ p1x[j], p1y[j] }}, {{ p2x[j], p2y[j] }},
+                    {{ p3x[j], p3y[j] }});
+            }
+        }
+    }
+}
+
+// Batch version of incircle, see orient2d_batch. The fourth point of tuple i
+// is (p4x[i], p4y[i]).
+template
+<
+    typename RealNumber,
+    std::size_t Robustness = 2
+>
+inline void incircle_batch(RealNumber const* p1x, RealNumber const* p1y,
+                           RealNumber const* p2x, RealNumber const* p2y,
+                           RealNumber const* p3x, RealNumber const* p3y,
+                           RealNumber const* p4x, RealNumber const* p4y,
+                           std::size_t count,
+                           RealNumber* det)
+{
+    RealNumber const A_relative_bound =
+          (5 + 24 * std::numeric_limits<RealNumber>::epsilon())
+        * std::numeric_limits<RealNumber>::epsilon();
+    for (std::size_t first = 0; first < count; first += batch_block_size) {
+        std::size_t const size = (std::min)(batch_block_size, count - first);
+        RealNumber bound[batch_block_size];
+        for (std::size_t i = first; i < first + size; ++i) {
+            RealNumber const A_11 = p1x[i] - p4x[i];
+            RealNumber const A_21 = p2x[i] - p4x[i];
+            RealNumber const A_31 = p3x[i] - p4x[i];
+            RealNumber const A_12 = p1y[i] - p4y[i];
+            RealNumber const A_22 = p2y[i] - p4y[i];
+            RealNumber const A_32 = p3y[i] - p4y[i];
+            RealNumber const A_21_x_A_32 = A_21 * A_32;
+            RealNumber const A_31_x_A_22 = A_31 * A_22;
+            RealNumber const A_31_x_A_12 = A_31 * A_12;
+            RealNumber const A_11_x_A_32 = A_11 * A_32;
+            RealNumber const A_11_x_A_22 = A_11 * A_22;
+            RealNumber const A_21_x_A_12 = A_21 * A_12;
+            RealNumber const A_13 = A_11 * A_11 + A_12 * A_12;
+            RealNumber const A_23 = A_21 * A_21 + A_22 * A_22;
+            RealNumber const A_33 = A_31 * A_31 + A_32 * A_32;
+            RealNumber const d = A_13 * (A_21_x_A_32 - A_31_x_A_22)
+                + A_23 * (A_31_x_A_12 - A_11_x_A_32)
+                + A_33 * (A_11_x_A_22 - A_21_x_A_12);
+            RealNumber const magnitude =
+                  (std::abs(A_21_x_A_32) + std::abs(A_31_x_A_22)) * A_13
+                + (std::abs(A_31_x_A_12) + std::abs(A_11_x_A_32)) * A_23
+                + (std::abs(A_11_x_A_22) + std::abs(A_21_x_A_12)) * A_33;
+            det[i] = d;
+            bound[i - first] = A_relative_bound * magnitude;
+        }
+        for (std::size_t i = 0; i < size && Robustness > 0; ++i) {
+            if (!(std::abs(det[first + i]) > bound[i])) {
+                std::size_t const j = first + i;
+                det[j] = incircle<RealNumber, Robustness>(
+                    {{ p1x[j], p1y[j] }}, {{ p2x[j], p2y[j] }},
+                    {{ p3x[j], p3y[j] }}, {{ p4x[j], p4y[j] }});
+            }
+        }
+    }
+}
+
 }} // namespace detail::precise_math
 
 }} // namespace boost::geometry
@@ -12,6 +12,12 @@
 #ifndef BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_STRATEGIES_CARTESIAN_IN_CIRCLE_ROBUST_HPP
 #define BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_STRATEGIES_CARTESIAN_IN_CIRCLE_ROBUST_HPP
 
+#include <algorithm>
+#include <cstddef>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
 #include<boost/geometry/extensions/triangulation/strategies/cartesian/detail/precise_math.hpp>
 
 namespace boost { namespace geometry
@@ -53,6 +59,114 @@ public:
                        : det < 0 ? -1 : 0;
     }
 
+    /*!
+    \brief Evaluates the predicate for many tuples, writing one result per
+        element of [first1, last1) to out.
+    \details The floating-point filter is evaluated for blocks of tuples at
+        once, only for tuples which fail its error bound the adaptive stages
+        are computed.
+    */
+    template
+    <
+        typename Iterator1,
+        typename Iterator2,
+        typename Iterator3,
+        typename Iterator4,
+        typename OutputIterator
+    >
+    static inline OutputIterator apply_batch(Iterator1 first1, Iterator1 last1,
+                                             Iterator2 first2, Iterator3 first3,
+                                             Iterator4 first4,
+                                             OutputIterator out)
+    {
+        std::size_t const block = batch_size;
+        CalculationType c[8][block];
+        CalculationType det[block];
+        while (first1 != last1)
+        {
+            std::size_t n = 0;
+            for (; n < block && first1 != last1;
+                 ++n, ++first1, ++first2, ++first3, ++first4)
+            {
+                c[0][n] = get<0>(*first1);
+                c[1][n] = get<1>(*first1);
+                c[2][n] = get<0>(*first2);
+                c[3][n] = get<1>(*first2);
+                c[4][n] = get<0>(*first3);
+                c[5][n] = get<1>(*first3);
+                c[6][n] = get<0>(*first4);
+                c[7][n] = get<1>(*first4);
+            }
+            out = write_batch(c, n, det, out);
+        }
+        return out;
+    }
+
+    /*!
+    \brief Evaluates the predicate for the circle through p1, p2, p3 and each
+        point of a range, see apply_batch for tuples
+    */
+    template
+    <
+        typename P1,
+        typename P2,
+        typename P3,
+        typename Range,
+        typename OutputIterator
+    >
+    static inline OutputIterator apply_batch(P1 const& p1, P2 const& p2,
+                                             P3 const& p3,
+                                             Range const& points,
+                                             OutputIterator out)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+
+        std::size_t const block = batch_size;
+        CalculationType c[8][block];
+        CalculationType det[block];
+        std::fill(c[0], c[0] + block, CalculationType(get<0>(p1)));
+        std::fill(c[1], c[1] + block, CalculationType(get<1>(p1)));
+        std::fill(c[2], c[2] + block, CalculationType(get<0>(p2)));
+        std::fill(c[3], c[3] + block, CalculationType(get<1>(p2)));
+        std::fill(c[4], c[4] + block, CalculationType(get<0>(p3)));
+        std::fill(c[5], c[5] + block, CalculationType(get<1>(p3)));
+
+        iterator it = boost::begin(points);
+        iterator const end = boost::end(points);
+        while (it != end)
+        {
+            std::size_t n = 0;
+            for (; n < block && it != end; ++n, ++it)
+            {
+                c[6][n] = get<0>(*it);
+                c[7][n] = get<1>(*it);
+            }
+            out = write_batch(c, n, det, out);
+        }
+        return out;
+    }
+
+private:
+    static constexpr std::size_t batch_size
+        = ::boost::geometry::detail::precise_math::batch_block_size;
+
+    template <typename OutputIterator>
+    static inline OutputIterator write_batch(
+        CalculationType const (&c)[8][batch_size],
+        std::size_t n, CalculationType* det, OutputIterator out)
+    {
+        boost::geometry::detail::precise_math::incircle_batch
+            <
+                CalculationType,
+                Robustness
+            >(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], n, det);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            *out++ = det[i] > 0 ? 1 : det[i] < 0 ? -1 : 0;
+        }
+        return out;
+    }
+
 };
 
 } // namespace in_circle
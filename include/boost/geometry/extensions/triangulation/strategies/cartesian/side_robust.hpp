@@ -12,6 +12,20 @@
 #ifndef BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_STRATEGIES_CARTESIAN_SIDE_ROBUST_HPP
 #define BOOST_GEOMETRY_EXTENSIONS_TRIANGULATION_STRATEGIES_CARTESIAN_SIDE_ROBUST_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/type_traits/integral_constant.hpp>
+
+#include <boost/geometry/strategies/cartesian/disjoint_segment_box.hpp>
+#include <boost/geometry/strategies/cartesian/envelope.hpp>
+#include <boost/geometry/strategies/cartesian/point_in_point.hpp>
+#include <boost/geometry/strategies/side.hpp>
 #include <boost/geometry/util/select_most_precise.hpp>
 #include <boost/geometry/util/select_calculation_type.hpp>
 #include <boost/geometry/extensions/triangulation/strategies/cartesian/detail/precise_math.hpp>
@@ -29,6 +43,8 @@ namespace strategy { namespace side
 \tparam CalculationType \tparam_calculation (numeric_limits<ct>::epsilon() and numeric_limits<ct>::digits must be supported for calculation type ct)
 \tparam Robustness std::size_t value from 0 (fastest) to 3 (default, guarantees correct results).
 \details This predicate determines at which side of a segment a point lies using an algorithm that is adapted from orient2d as described in "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric Predicates" by Jonathan Richard Shewchuk ( https://dl.acm.org/citation.cfm?doid=237218.237337 ). More information and copies of the paper can also be found at https://www.cs.cmu.edu/~quake/robust.html . It is designed to be adaptive in the sense that it should be fast for inputs that lead to correct results with plain float operations but robust for inputs that require higher precision arithmetics.
+    Used as side strategy of strategy::intersection::cartesian_segments, set
+    operations and relate do not rescale the input to integer coordinates.
  */
 template
 <
@@ -38,6 +54,28 @@ template
 struct side_robust
 {
 public:
+    typedef cartesian_tag cs_tag;
+
+    typedef strategy::envelope::cartesian<CalculationType> envelope_strategy_type;
+
+    static inline envelope_strategy_type get_envelope_strategy()
+    {
+        return envelope_strategy_type();
+    }
+
+    typedef strategy::disjoint::segment_box disjoint_strategy_type;
+
+    static inline disjoint_strategy_type get_disjoint_strategy()
+    {
+        return disjoint_strategy_type();
+    }
+
+    typedef strategy::within::cartesian_point_point equals_point_point_strategy_type;
+    static inline equals_point_point_strategy_type get_equals_point_point_strategy()
+    {
+        return equals_point_point_strategy_type();
+    }
+
     //! \brief Computes double the signed area of the CCW triangle p1, p2, p
     template
     <
@@ -85,8 +123,141 @@ public:
     }
 #endif
 
+    /*!
+    \brief Computes the side of p3 relative to segment p1, p2 for many tuples,
+        writing one result per element of [first1, last1) to out.
+    \details The floating-point filter is evaluated for blocks of tuples at
+        once, only for tuples which fail its error bound the adaptive stages
+        are computed.
+    */
+    template
+    <
+        typename Iterator1,
+        typename Iterator2,
+        typename Iterator3,
+        typename OutputIterator
+    >
+    static inline OutputIterator apply_batch(Iterator1 first1, Iterator1 last1,
+                                             Iterator2 first2, Iterator3 first3,
+                                             OutputIterator out)
+    {
+        typedef typename promoted_batch_type
+            <
+                typename std::iterator_traits<Iterator1>::value_type,
+                typename std::iterator_traits<Iterator2>::value_type,
+                typename std::iterator_traits<Iterator3>::value_type
+            >::type promoted_type;
+
+        std::size_t const block = batch_size;
+        promoted_type c[6][block];
+        promoted_type det[block];
+        while (first1 != last1)
+        {
+            std::size_t n = 0;
+            for (; n < block && first1 != last1; ++n, ++first1, ++first2, ++first3)
+            {
+                c[0][n] = get<0>(*first1);
+                c[1][n] = get<1>(*first1);
+                c[2][n] = get<0>(*first2);
+                c[3][n] = get<1>(*first2);
+                c[4][n] = get<0>(*first3);
+                c[5][n] = get<1>(*first3);
+            }
+            out = write_batch(c, n, det, out);
+        }
+        return out;
+    }
+
+    /*!
+    \brief Computes the side of each point of a range relative to segment
+        p1, p2, see apply_batch for tuples
+    */
+    template
+    <
+        typename P1,
+        typename P2,
+        typename Range,
+        typename OutputIterator
+    >
+    static inline OutputIterator apply_batch(P1 const& p1, P2 const& p2,
+                                             Range const& points,
+                                             OutputIterator out)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+        typedef typename promoted_batch_type
+            <
+                P1, P2, typename boost::range_value<Range>::type
+            >::type promoted_type;
+
+        std::size_t const block = batch_size;
+        promoted_type c[6][block];
+        promoted_type det[block];
+        std::fill(c[0], c[0] + block, promoted_type(get<0>(p1)));
+        std::fill(c[1], c[1] + block, promoted_type(get<1>(p1)));
+        std::fill(c[2], c[2] + block, promoted_type(get<0>(p2)));
+        std::fill(c[3], c[3] + block, promoted_type(get<1>(p2)));
+
+        iterator it = boost::begin(points);
+        iterator const end = boost::end(points);
+        while (it != end)
+        {
+            std::size_t n = 0;
+            for (; n < block && it != end; ++n, ++it)
+            {
+                c[4][n] = get<0>(*it);
+                c[5][n] = get<1>(*it);
+            }
+            out = write_batch(c, n, det, out);
+        }
+        return out;
+    }
+
+private:
+    static constexpr std::size_t batch_size
+        = ::boost::geometry::detail::precise_math::batch_block_size;
+
+    template <typename P1, typename P2, typename P>
+    struct promoted_batch_type
+    {
+        typedef typename select_most_precise
+            <
+                typename select_calculation_type_alt
+                    <
+                        CalculationType, P1, P2, P
+                    >::type,
+                double
+            >::type type;
+    };
+
+    template <typename PromotedType, typename OutputIterator>
+    static inline OutputIterator write_batch(
+        PromotedType const (&c)[6][batch_size],
+        std::size_t n, PromotedType* det, OutputIterator out)
+    {
+        ::boost::geometry::detail::precise_math::orient2d_batch
+            <PromotedType, Robustness>(c[0], c[1], c[2], c[3], c[4], c[5], n, det);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            *out++ = det[i] > 0 ? 1 : det[i] < 0 ? -1 : 0;
+        }
+        return out;
+    }
+
 };
 
+#ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
+namespace services
+{
+
+// Only the highest robustness guarantees exact results
+template <typename CalculationType>
+struct is_robust<side_robust<CalculationType, 3> >
+    : boost::true_type
+{};
+
+} // namespace services
+#endif // DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
+
 }} // namespace strategy::side
 
 }} // namespace boost::geometry
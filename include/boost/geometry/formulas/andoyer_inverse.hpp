@@ -14,6 +14,8 @@
 #define BOOST_GEOMETRY_FORMULAS_ANDOYER_INVERSE_HPP
 
 
+#include <cstddef>
+
 #include <boost/math/constants/constants.hpp>
 
 #include <boost/geometry/core/radius.hpp>
@@ -21,6 +23,7 @@
 #include <boost/geometry/util/condition.hpp>
 #include <boost/geometry/util/math.hpp>
 
+#include <boost/geometry/formulas/batch.hpp>
 #include <boost/geometry/formulas/differential_quantities.hpp>
 #include <boost/geometry/formulas/flattening.hpp>
 #include <boost/geometry/formulas/result_inverse.hpp>
@@ -98,6 +101,9 @@ public:
         CT const d = acos(cos_d); // [0, pi]
         CT const sin_d = sin(d);  // [-1, 1]
 
+        // NOTE: batch_inverse<andoyer_inverse> below has to be consistent
+        //       with the calculation of distance
+
         if ( BOOST_GEOMETRY_CONDITION(EnableDistance) )
         {
             CT const K = math::sqr(sin_lat1-sin_lat2);
@@ -287,6 +293,74 @@ private:
     }
 };
 
+/*!
+\brief Andoyer's inverse formula calculating only distances, for arrays of
+    pairs of points
+\details The special cases are handled with selects instead of branches.
+    The results are the same as the results of andoyer_inverse.
+*/
+template <typename CT>
+struct batch_inverse<andoyer_inverse<CT, true, false, false, false, false> >
+{
+    typedef typename andoyer_inverse
+        <
+            CT, true, false, false, false, false
+        >::result_type result_type;
+
+    template <typename Spheroid>
+    static inline void apply(CT const* lon1, CT const* lat1,
+                             CT const* lon2, CT const* lat2,
+                             std::size_t count,
+                             Spheroid const& spheroid,
+                             result_type* results)
+    {
+        CT const c0 = CT(0);
+        CT const c1 = CT(1);
+        CT const f = formula::flattening<CT>(spheroid);
+        CT const a = CT(get_radius<0>(spheroid));
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            bool const calculated = ! (math::equals(lon1[i], lon2[i])
+                                    && math::equals(lat1[i], lat2[i]));
+
+            CT const dlon = lon2[i] - lon1[i];
+            CT const cos_dlon = cos(dlon);
+            CT const sin_lat1 = sin(lat1[i]);
+            CT const cos_lat1 = cos(lat1[i]);
+            CT const sin_lat2 = sin(lat2[i]);
+            CT const cos_lat2 = cos(lat2[i]);
+
+            CT cos_d = sin_lat1*sin_lat2 + cos_lat1*cos_lat2*cos_dlon;
+            cos_d = cos_d < -c1 ? -c1
+                  : cos_d > c1 ? c1
+                  : cos_d;
+
+            CT const d = acos(cos_d); // [0, pi]
+            CT const sin_d = sin(d);  // [-1, 1]
+
+            CT const K = math::sqr(sin_lat1-sin_lat2);
+            CT const L = math::sqr(sin_lat1+sin_lat2);
+            CT const three_sin_d = CT(3) * sin_d;
+
+            CT const one_minus_cos_d = c1 - cos_d;
+            CT const one_plus_cos_d = c1 + cos_d;
+
+            CT const H = math::equals(one_minus_cos_d, c0) ?
+                            c0 :
+                            (d + three_sin_d) / one_minus_cos_d;
+            CT const G = math::equals(one_plus_cos_d, c0) ?
+                            c0 :
+                            (d - three_sin_d) / one_plus_cos_d;
+
+            CT const dd = -(f/CT(4))*(H*K+G*L);
+
+            results[i] = result_type();
+            results[i].distance = calculated ? a * (d + dd) : c0;
+        }
+    }
+};
+
 }}} // namespace boost::geometry::formula
 
 
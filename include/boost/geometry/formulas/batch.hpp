@@ -0,0 +1,84 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_FORMULAS_BATCH_HPP
+#define BOOST_GEOMETRY_FORMULAS_BATCH_HPP
+
+
+#include <cstddef>
+
+
+namespace boost { namespace geometry { namespace formula
+{
+
+// Number of pairs processed together by the batch kernels, the arrays
+// of intermediate values of a block are kept on the stack
+static const std::size_t batch_block_size = 64;
+
+
+/*!
+\brief Solves the inverse problem of geodesics for arrays of pairs of points
+\details By default the Inverse formula is applied to each pair. Formulas
+    specialize it with kernels processing blocks of pairs in loops without
+    function calls or early returns so the compiler can vectorize them.
+    The results are the same as the results of Inverse::apply() unless
+    the compiler contracts floating point operations (FMA) differently.
+    Coordinates are in radians.
+\tparam Inverse the inverse formula, e.g. formula::vincenty_inverse
+*/
+template <typename Inverse>
+struct batch_inverse
+{
+    typedef typename Inverse::result_type result_type;
+
+    template <typename T, typename Spheroid>
+    static inline void apply(T const* lon1, T const* lat1,
+                             T const* lon2, T const* lat2,
+                             std::size_t count,
+                             Spheroid const& spheroid,
+                             result_type* results)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            results[i] = Inverse::apply(lon1[i], lat1[i], lon2[i], lat2[i],
+                                        spheroid);
+        }
+    }
+};
+
+
+/*!
+\brief Solves the direct problem of geodesics for arrays of points,
+    distances and azimuths
+\details The Direct formula is applied to each point. Coordinates and
+    azimuths are in radians.
+\tparam Direct the direct formula, e.g. formula::vincenty_direct
+*/
+template <typename Direct>
+struct batch_direct
+{
+    typedef typename Direct::result_type result_type;
+
+    template <typename T, typename Dist, typename Azi, typename Spheroid>
+    static inline void apply(T const* lon1, T const* lat1,
+                             Dist const* distance, Azi const* azimuth,
+                             std::size_t count,
+                             Spheroid const& spheroid,
+                             result_type* results)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            results[i] = Direct::apply(lon1[i], lat1[i], distance[i], azimuth[i],
+                                       spheroid);
+        }
+    }
+};
+
+
+}}} // namespace boost::geometry::formula
+
+
+#endif // BOOST_GEOMETRY_FORMULAS_BATCH_HPP
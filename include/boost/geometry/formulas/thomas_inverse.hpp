@@ -13,6 +13,8 @@
 #define BOOST_GEOMETRY_FORMULAS_THOMAS_INVERSE_HPP
 
 
+#include <cstddef>
+
 #include <boost/math/constants/constants.hpp>
 
 #include <boost/geometry/core/radius.hpp>
@@ -20,6 +22,7 @@
 #include <boost/geometry/util/condition.hpp>
 #include <boost/geometry/util/math.hpp>
 
+#include <boost/geometry/formulas/batch.hpp>
 #include <boost/geometry/formulas/differential_quantities.hpp>
 #include <boost/geometry/formulas/flattening.hpp>
 #include <boost/geometry/formulas/result_inverse.hpp>
@@ -71,6 +74,9 @@ public:
             return result;
         }
 
+        // NOTE: batch_inverse<thomas_inverse> below has to be consistent
+        //       with the calculation of distance
+
         CT const c0 = 0;
         CT const c1 = 1;
         CT const c2 = 2;
@@ -214,6 +220,102 @@ public:
     }
 };
 
+/*!
+\brief Thomas' inverse formula calculating only distances, for arrays of
+    pairs of points
+\details The special cases are handled with selects instead of branches.
+    The results are the same as the results of thomas_inverse.
+*/
+template <typename CT>
+struct batch_inverse<thomas_inverse<CT, true, false, false, false, false> >
+{
+    typedef typename thomas_inverse
+        <
+            CT, true, false, false, false, false
+        >::result_type result_type;
+
+    template <typename Spheroid>
+    static inline void apply(CT const* lon1, CT const* lat1,
+                             CT const* lon2, CT const* lat2,
+                             std::size_t count,
+                             Spheroid const& spheroid,
+                             result_type* results)
+    {
+        CT const c0 = 0;
+        CT const c1 = 1;
+        CT const c2 = 2;
+        CT const c4 = 4;
+
+        CT const pi_half = math::pi<CT>() / c2;
+        CT const f = formula::flattening<CT>(spheroid);
+        CT const one_minus_f = c1 - f;
+        CT const f_sqr = math::sqr(f);
+        CT const f_sqr_per_64 = f_sqr / CT(64);
+        CT const a = get_radius<0>(spheroid);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            CT const theta1 = math::equals(lat1[i], pi_half) ? lat1[i] :
+                              math::equals(lat1[i], -pi_half) ? lat1[i] :
+                              atan(one_minus_f * tan(lat1[i]));
+            CT const theta2 = math::equals(lat2[i], pi_half) ? lat2[i] :
+                              math::equals(lat2[i], -pi_half) ? lat2[i] :
+                              atan(one_minus_f * tan(lat2[i]));
+
+            CT const theta_m = (theta1 + theta2) / c2;
+            CT const d_theta_m = (theta2 - theta1) / c2;
+            CT const d_lambda = lon2[i] - lon1[i];
+            CT const d_lambda_m = d_lambda / c2;
+
+            CT const sin_theta_m = sin(theta_m);
+            CT const cos_theta_m = cos(theta_m);
+            CT const sin_d_theta_m = sin(d_theta_m);
+            CT const cos_d_theta_m = cos(d_theta_m);
+            CT const sin2_theta_m = math::sqr(sin_theta_m);
+            CT const cos2_theta_m = math::sqr(cos_theta_m);
+            CT const sin2_d_theta_m = math::sqr(sin_d_theta_m);
+            CT const cos2_d_theta_m = math::sqr(cos_d_theta_m);
+            CT const sin_d_lambda_m = sin(d_lambda_m);
+            CT const sin2_d_lambda_m = math::sqr(sin_d_lambda_m);
+
+            CT const H = cos2_theta_m - sin2_d_theta_m;
+            CT const L = sin2_d_theta_m + H * sin2_d_lambda_m;
+            CT const cos_d = c1 - c2 * L;
+            CT const d = acos(cos_d);
+            CT const sin_d = sin(d);
+
+            CT const one_minus_L = c1 - L;
+
+            bool const calculated
+                = ! (math::equals(lon1[i], lon2[i]) && math::equals(lat1[i], lat2[i]))
+                && ! math::equals(sin_d, c0)
+                && ! math::equals(L, c0)
+                && ! math::equals(one_minus_L, c0);
+
+            CT const U = c2 * sin2_theta_m * cos2_d_theta_m / one_minus_L;
+            CT const V = c2 * sin2_d_theta_m * cos2_theta_m / L;
+            CT const X = U + V;
+            CT const Y = U - V;
+            CT const T = d / sin_d;
+            CT const D = c4 * math::sqr(T);
+            CT const E = c2 * cos_d;
+            CT const A = D * E;
+            CT const B = c2 * D;
+            CT const C = T - (A - E) / c2;
+
+            CT const n1 = X * (A + C*X);
+            CT const n2 = Y * (B + E*Y);
+            CT const n3 = D*X*Y;
+
+            CT const delta1d = f * (T*X-Y) / c4;
+            CT const delta2d = f_sqr_per_64 * (n1 - n2 + n3);
+
+            results[i] = result_type();
+            results[i].distance = calculated ? a * sin_d * (T - delta1d + delta2d) : c0;
+        }
+    }
+};
+
 }}} // namespace boost::geometry::formula
 
 
@@ -16,6 +16,9 @@
 #define BOOST_GEOMETRY_FORMULAS_VINCENTY_INVERSE_HPP
 
 
+#include <algorithm>
+#include <cstddef>
+
 #include <boost/math/constants/constants.hpp>
 
 #include <boost/geometry/core/radius.hpp>
@@ -23,6 +26,7 @@
 #include <boost/geometry/util/condition.hpp>
 #include <boost/geometry/util/math.hpp>
 
+#include <boost/geometry/formulas/batch.hpp>
 #include <boost/geometry/formulas/differential_quantities.hpp>
 #include <boost/geometry/formulas/flattening.hpp>
 #include <boost/geometry/formulas/result_inverse.hpp>
@@ -45,7 +49,6 @@ namespace boost { namespace geometry { namespace formula
     - http://www.movable-type.co.uk/scripts/LatLongVincenty.html
     - http://exogen.case.edu/projects/geopy/source/geopy.distance.html
     - http://futureboy.homeip.net/fsp/colorize.fsp?fileName=navigation.frink
-
 */
 template <
     typename CT,
@@ -135,6 +138,9 @@ public:
         CT cos2_2sigma_m;
         CT sigma;
 
+        // NOTE: batch_inverse<vincenty_inverse> below has to be consistent
+        //       with this formula
+
         int counter = 0; // robustness
 
         do
@@ -215,6 +221,240 @@ public:
     }
 };
 
+/*!
+\brief Vincenty's inverse formula for arrays of pairs of points
+\details The iterations of the pairs of a block are done together. A pair
+    stops iterating (its lane is masked) when it would stop in the scalar
+    formula and the remaining pairs continue until all of them stopped,
+    so the results are the same as the results of vincenty_inverse.
+*/
+template
+<
+    typename CT,
+    bool EnableDistance,
+    bool EnableAzimuth,
+    bool EnableReverseAzimuth,
+    bool EnableReducedLength,
+    bool EnableGeodesicScale
+>
+struct batch_inverse
+    <
+        vincenty_inverse
+            <
+                CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+                EnableReducedLength, EnableGeodesicScale
+            >
+    >
+{
+    typedef vincenty_inverse
+        <
+            CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+            EnableReducedLength, EnableGeodesicScale
+        > inverse_type;
+
+    typedef typename inverse_type::result_type result_type;
+
+    template <typename Spheroid>
+    static inline void apply(CT const* lon1, CT const* lat1,
+                             CT const* lon2, CT const* lat2,
+                             std::size_t count,
+                             Spheroid const& spheroid,
+                             result_type* results)
+    {
+        for (std::size_t first = 0; first < count; first += batch_block_size)
+        {
+            std::size_t const n = (std::min)(batch_block_size, count - first);
+            apply_block(lon1 + first, lat1 + first, lon2 + first, lat2 + first,
+                        n, spheroid, results + first);
+        }
+    }
+
+private:
+    template <typename Spheroid>
+    static inline void apply_block(CT const* lon1, CT const* lat1,
+                                   CT const* lon2, CT const* lat2,
+                                   std::size_t n,
+                                   Spheroid const& spheroid,
+                                   result_type* results)
+    {
+        static std::size_t const block_size = batch_block_size;
+
+        CT const c0 = 0;
+        CT const c1 = 1;
+        CT const c2 = 2;
+        CT const c3 = 3;
+        CT const c4 = 4;
+        CT const c16 = 16;
+        CT const c_e_12 = CT(1e-12);
+
+        CT const pi = geometry::math::pi<CT>();
+        CT const two_pi = c2 * pi;
+
+        CT const radius_a = CT(get_radius<0>(spheroid));
+        CT const radius_b = CT(get_radius<2>(spheroid));
+        CT const f = formula::flattening<CT>(spheroid);
+        CT const one_min_f = c1 - f;
+
+        // equal points are not calculated, see vincenty_inverse::apply()
+        bool calculated[block_size];
+        // lanes which did not stop iterating
+        bool active[block_size];
+
+        CT L[block_size];
+        CT lambda[block_size];
+        CT cos_U1[block_size];
+        CT cos_U2[block_size];
+        CT sin_U1[block_size];
+        CT sin_U2[block_size];
+
+        // the lanes of equal points are not updated but read later
+        CT sin_lambda[block_size] = {};
+        CT cos_lambda[block_size] = {};
+        CT sin_sigma[block_size] = {};
+        CT cos2_alpha[block_size] = {};
+        CT cos_2sigma_m[block_size] = {};
+        CT cos2_2sigma_m[block_size] = {};
+        CT sigma[block_size] = {};
+
+        std::size_t active_count = 0;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            calculated[i] = ! (math::equals(lat1[i], lat2[i])
+                            && math::equals(lon1[i], lon2[i]));
+            active[i] = calculated[i];
+            active_count += calculated[i] ? 1 : 0;
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            CT l = lon2[i] - lon1[i];
+            lambda[i] = l;
+            l = l < -pi ? l + two_pi : l;
+            l = l > pi ? l - two_pi : l;
+            L[i] = l;
+
+            CT const tan_U1 = one_min_f * tan(lat1[i]);
+            CT const tan_U2 = one_min_f * tan(lat2[i]);
+            CT const temp_den_U1 = math::sqrt(c1 + math::sqr(tan_U1));
+            CT const temp_den_U2 = math::sqrt(c1 + math::sqr(tan_U2));
+            cos_U1[i] = c1 / temp_den_U1;
+            cos_U2[i] = c1 / temp_den_U2;
+            sin_U1[i] = tan_U1 * cos_U1[i];
+            sin_U2[i] = tan_U2 * cos_U2[i];
+        }
+
+        // All lanes are calculated in each step, the values of the lanes
+        // which stopped iterating are not updated anymore
+        for (int counter = 1; active_count > 0; ++counter)
+        {
+            active_count = 0;
+            for (std::size_t i = 0; i < n; i++)
+            {
+                CT const previous_lambda = lambda[i];
+                CT const sl = sin(previous_lambda);
+                CT const cl = cos(previous_lambda);
+                CT const ss = math::sqrt(math::sqr(cos_U2[i] * sl) + math::sqr(cos_U1[i] * sin_U2[i] - sin_U1[i] * cos_U2[i] * cl)); // (14)
+                CT const cos_sigma = sin_U1[i] * sin_U2[i] + cos_U1[i] * cos_U2[i] * cl; // (15)
+                CT const sa = cos_U1[i] * cos_U2[i] * sl / ss; // (17)
+                CT const c2a = c1 - math::sqr(sa);
+                CT const c2sm = math::equals(c2a, c0) ? c0 : cos_sigma - c2 * sin_U1[i] * sin_U2[i] / c2a; // (18)
+                CT const c22sm = math::sqr(c2sm);
+
+                CT const C = f/c16 * c2a * (c4 + f * (c4 - c3 * c2a)); // (10)
+                CT const s = atan2(ss, cos_sigma); // (16)
+                CT const l = L[i] + (c1 - C) * f * sa *
+                    (s + C * ss * (c2sm + C * cos_sigma * (-c1 + c2 * c22sm))); // (11)
+
+                bool const a = active[i];
+                sin_lambda[i] = a ? sl : sin_lambda[i];
+                cos_lambda[i] = a ? cl : cos_lambda[i];
+                sin_sigma[i] = a ? ss : sin_sigma[i];
+                cos2_alpha[i] = a ? c2a : cos2_alpha[i];
+                cos_2sigma_m[i] = a ? c2sm : cos_2sigma_m[i];
+                cos2_2sigma_m[i] = a ? c22sm : cos2_2sigma_m[i];
+                sigma[i] = a ? s : sigma[i];
+                lambda[i] = a ? l : lambda[i];
+
+                active[i] = a
+                         && geometry::math::abs(previous_lambda - l) > c_e_12
+                         && geometry::math::abs(l) < pi
+                         && counter < BOOST_GEOMETRY_DETAIL_VINCENTY_MAX_STEPS;
+                active_count += active[i] ? 1 : 0;
+            }
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            results[i] = result_type();
+        }
+
+        if ( BOOST_GEOMETRY_CONDITION(EnableDistance) )
+        {
+            CT const c6 = 6;
+            CT const c47 = 47;
+            CT const c74 = 74;
+            CT const c128 = 128;
+            CT const c256 = 256;
+            CT const c175 = 175;
+            CT const c320 = 320;
+            CT const c768 = 768;
+            CT const c1024 = 1024;
+            CT const c4096 = 4096;
+            CT const c16384 = 16384;
+
+            CT const sqr_u_factor = math::sqr(radius_a / radius_b) - c1;
+
+            for (std::size_t i = 0; i < n; i++)
+            {
+                CT const sqr_u = cos2_alpha[i] * sqr_u_factor; // above (1)
+
+                CT const A = c1 + sqr_u/c16384 * (c4096 + sqr_u * (-c768 + sqr_u * (c320 - c175 * sqr_u))); // (3)
+                CT const B = sqr_u/c1024 * (c256 + sqr_u * ( -c128 + sqr_u * (c74 - c47 * sqr_u))); // (4)
+                CT const cos_sigma = cos(sigma[i]);
+                CT const sin2_sigma = math::sqr(sin_sigma[i]);
+                CT const delta_sigma = B * sin_sigma[i] * (cos_2sigma_m[i] + (B/c4) * (cos_sigma* (-c1 + c2 * cos2_2sigma_m[i])
+                    - (B/c6) * cos_2sigma_m[i] * (-c3 + c4 * sin2_sigma) * (-c3 + c4 * cos2_2sigma_m[i]))); // (6)
+
+                CT const distance = radius_b * A * (sigma[i] - delta_sigma); // (19)
+                results[i].distance = calculated[i] ? distance : c0;
+            }
+        }
+
+        if ( BOOST_GEOMETRY_CONDITION(inverse_type::CalcFwdAzimuth) )
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                CT const azimuth = atan2(cos_U2[i] * sin_lambda[i], cos_U1[i] * sin_U2[i] - sin_U1[i] * cos_U2[i] * cos_lambda[i]); // (20)
+                results[i].azimuth = calculated[i] ? azimuth : c0;
+            }
+        }
+
+        if ( BOOST_GEOMETRY_CONDITION(inverse_type::CalcRevAzimuth) )
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                CT const reverse_azimuth = atan2(cos_U1[i] * sin_lambda[i], -sin_U1[i] * cos_U2[i] + cos_U1[i] * sin_U2[i] * cos_lambda[i]); // (21)
+                results[i].reverse_azimuth = calculated[i] ? reverse_azimuth : c0;
+            }
+        }
+
+        if ( BOOST_GEOMETRY_CONDITION(inverse_type::CalcQuantities) )
+        {
+            typedef differential_quantities<CT, EnableReducedLength, EnableGeodesicScale, 2> quantities;
+            for (std::size_t i = 0; i < n; i++)
+            {
+                if (calculated[i])
+                {
+                    quantities::apply(lon1[i], lat1[i], lon2[i], lat2[i],
+                                      results[i].azimuth, results[i].reverse_azimuth,
+                                      radius_b, f,
+                                      results[i].reduced_length, results[i].geodesic_scale);
+                }
+            }
+        }
+    }
+};
+
 }}} // namespace boost::geometry::formula
 
 
@@ -0,0 +1,130 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_DETAIL_MAPPED_FILE_HPP
+#define BOOST_GEOMETRY_IO_DETAIL_MAPPED_FILE_HPP
+
+
+#include <cstddef>
+#include <string>
+
+#include <boost/config.hpp>
+#include <boost/core/noncopyable.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#include <vector>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Read-only mapping of a whole file. The pages are loaded by the OS when
+// they are touched and they are shared by all processes mapping the same
+// file. Where mmap() is not available the file is read into memory.
+class mapped_file
+    : boost::noncopyable
+{
+public:
+    typedef char const* const_iterator;
+
+    explicit mapped_file(std::string const& filename)
+        : m_data(NULL)
+        , m_size(0)
+        , m_is_open(false)
+    {
+#ifdef BOOST_HAS_UNISTD_H
+        int const fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == 0)
+        {
+            m_is_open = true;
+            if (st.st_size > 0)
+            {
+                void * const ptr = ::mmap(NULL, std::size_t(st.st_size),
+                                          PROT_READ, MAP_SHARED, fd, 0);
+                if (ptr != MAP_FAILED)
+                {
+                    m_data = static_cast<char const*>(ptr);
+                    m_size = std::size_t(st.st_size);
+                }
+                else
+                {
+                    m_is_open = false;
+                }
+            }
+        }
+
+        // The mapping is kept after the descriptor is closed
+        ::close(fd);
+#else
+        std::ifstream is(filename.c_str(), std::ios::binary);
+        if (! is.is_open())
+        {
+            return;
+        }
+
+        m_is_open = true;
+        m_buffer.assign(std::istreambuf_iterator<char>(is),
+                        std::istreambuf_iterator<char>());
+        if (! m_buffer.empty())
+        {
+            m_data = &m_buffer[0];
+            m_size = m_buffer.size();
+        }
+#endif
+    }
+
+    ~mapped_file()
+    {
+#ifdef BOOST_HAS_UNISTD_H
+        if (m_data != NULL)
+        {
+            ::munmap(const_cast<char *>(m_data), m_size);
+        }
+#endif
+    }
+
+    bool is_open() const { return m_is_open; }
+    char const* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+
+private:
+    char const* m_data;
+    std::size_t m_size;
+    bool m_is_open;
+#ifndef BOOST_HAS_UNISTD_H
+    std::vector<char> m_buffer;
+#endif
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_DETAIL_MAPPED_FILE_HPP
@@ -14,6 +14,11 @@
 #ifndef BOOST_GEOMETRY_IO_HPP
 #define BOOST_GEOMETRY_IO_HPP
 
+#include <string>
+
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/io/wkb/read.hpp>
 #include <boost/geometry/io/wkt/read.hpp>
 #include <boost/geometry/io/wkt/write.hpp>
 
@@ -21,7 +26,7 @@ namespace boost { namespace geometry
 {
 
 struct format_wkt {};
-struct format_wkb {}; // TODO
+struct format_wkb {};
 struct format_dsv {}; // TODO
 
 #ifndef DOXYGEN_NO_DISPATCH
@@ -41,6 +46,18 @@ struct read<format_wkt, Geometry>
     }
 };
 
+template <typename Geometry>
+struct read<format_wkb, Geometry>
+{
+    static inline void apply(Geometry& geometry, std::string const& wkb)
+    {
+        if (! geometry::read_wkb(wkb.begin(), wkb.end(), geometry))
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+    }
+};
+
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
@@ -18,8 +18,15 @@
 #ifndef BOOST_GEOMETRY_IO_SVG_MAPPER_HPP
 #define BOOST_GEOMETRY_IO_SVG_MAPPER_HPP
 
+#include <cmath>
+#include <cstddef>
 #include <cstdio>
+#include <cstdlib>
 
+#include <algorithm>
+#include <limits>
+#include <ostream>
+#include <string>
 #include <vector>
 
 #include <boost/config.hpp>
@@ -33,6 +40,9 @@
 #include <boost/algorithm/string/classification.hpp>
 
 
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/core/tag_cast.hpp>
 
@@ -40,7 +50,9 @@
 #include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/algorithms/is_empty.hpp>
 #include <boost/geometry/algorithms/transform.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
 #include <boost/geometry/strategies/transform/map_transformer.hpp>
+#include <boost/geometry/views/box_view.hpp>
 #include <boost/geometry/views/segment_view.hpp>
 
 #include <boost/geometry/io/svg/write.hpp>
@@ -53,6 +65,287 @@ namespace boost { namespace geometry
 {
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace svg
+{
+
+// Writes features in integer SVG pixels. Of a run of vertices within one
+// pixel of the last written pixel only the last one is written, and pixels
+// continuing a straight line on the pixel grid replace its end, so the
+// output is bounded by the pixels touched. A feature is formatted into a
+// buffer, which is kept between features, and only written if it overlaps
+// the map.
+class pixel_writer
+{
+    // Rings with less pixels, without the closing one, are not written
+    static const std::size_t min_ring_size = 3;
+
+public:
+    inline pixel_writer(double width, double height)
+        : m_width(width)
+        , m_height(height)
+        , m_count(0)
+        , m_last_start(0)
+    {}
+
+    template <typename Point, typename TransformStrategy>
+    inline void point(std::ostream& stream, Point const& point,
+                      std::string const& style, double size,
+                      TransformStrategy const& strategy)
+    {
+        double const radius = size < 0 ? 5 : size;
+
+        begin();
+        long x = 0, y = 0;
+        to_pixel(point, strategy, x, y);
+        m_buffer += "<circle cx=\"";
+        append(x);
+        m_buffer += "\" cy=\"";
+        append(y);
+        m_buffer += "\" r=\"";
+        append(long(radius + 0.5));
+        m_buffer += "\" style=\"";
+        m_buffer += style;
+        m_buffer += "\"/>";
+        flush(stream, radius);
+    }
+
+    template <typename Range, typename TransformStrategy>
+    inline void range(std::ostream& stream, Range const& range, bool closed,
+                      std::string const& style, TransformStrategy const& strategy)
+    {
+        begin();
+        m_buffer += closed ? "<polygon points=\"" : "<polyline points=\"";
+        if (add_points(range, strategy, false, closed)
+                < (closed ? min_ring_size : 2))
+        {
+            return;
+        }
+        m_buffer += "\" style=\"";
+        m_buffer += style;
+        m_buffer += closed ? "\"/>" : ";fill:none\"/>";
+        flush(stream, 0);
+    }
+
+    // Rings collapsing to less than min_ring_size pixels are skipped, and
+    // with the exterior ring the whole polygon
+    template <typename Polygon, typename TransformStrategy>
+    inline void polygon(std::ostream& stream, Polygon const& polygon,
+                        std::string const& style, TransformStrategy const& strategy)
+    {
+        begin();
+        m_buffer += "<g fill-rule=\"evenodd\"><path d=\"";
+        if (add_points(exterior_ring(polygon), strategy, true, true)
+                < min_ring_size)
+        {
+            return;
+        }
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            add_points(*it, strategy, true, true);
+        }
+
+        m_buffer += "\" style=\"";
+        m_buffer += style;
+        m_buffer += "\"/></g>";
+        flush(stream, 0);
+    }
+
+private:
+    inline void begin()
+    {
+        m_buffer.clear();
+        m_min_x = m_min_y = (std::numeric_limits<long>::max)();
+        m_max_x = m_max_y = (std::numeric_limits<long>::min)();
+    }
+
+    // Coordinates far outside of the map are limited to avoid overflow
+    template <typename Point, typename TransformStrategy>
+    inline void to_pixel(Point const& point, TransformStrategy const& strategy,
+                         long& x, long& y)
+    {
+        static double const limit = 1.0e9;
+
+        model::point<double, 2, cs::cartesian> p;
+        strategy.apply(point, p);
+        x = long(std::floor((std::min)((std::max)(geometry::get<0>(p), -limit), limit) + 0.5));
+        y = long(std::floor((std::min)((std::max)(geometry::get<1>(p), -limit), limit) + 0.5));
+
+        m_min_x = (std::min)(m_min_x, x);
+        m_min_y = (std::min)(m_min_y, y);
+        m_max_x = (std::max)(m_max_x, x);
+        m_max_y = (std::max)(m_max_y, y);
+    }
+
+    struct pixel
+    {
+        long x, y;
+
+        inline bool operator==(pixel const& other) const
+        {
+            return x == other.x && y == other.y;
+        }
+
+        // Returns true if other is in the 3x3 pixels around this pixel
+        inline bool touches(pixel const& other) const
+        {
+            return std::labs(x - other.x) <= 1 && std::labs(y - other.y) <= 1;
+        }
+    };
+
+    // Appends the pixels as points list or as path, returns their number.
+    // The closing pixel of closed ranges is not appended, paths are closed
+    // with "z" and removed if they have less than min_ring_size pixels.
+    template <typename Range, typename TransformStrategy>
+    inline std::size_t add_points(Range const& range,
+                                  TransformStrategy const& strategy,
+                                  bool path, bool closed)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator_type;
+
+        std::size_t const start = m_buffer.size();
+        m_count = 0;
+
+        // The last vertex of the current run around the last written pixel
+        pixel pending = pixel();
+        bool has_pending = false;
+        for (iterator_type it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            pixel p;
+            to_pixel(*it, strategy, p.x, p.y);
+            if (m_count > 0 && m_last.touches(p))
+            {
+                pending = p;
+                has_pending = ! (p == m_last);
+                continue;
+            }
+            if (has_pending)
+            {
+                add_pixel(pending, path);
+                has_pending = false;
+                if (m_last.touches(p))
+                {
+                    pending = p;
+                    has_pending = ! (p == m_last);
+                    continue;
+                }
+            }
+            add_pixel(p, path);
+        }
+        if (has_pending)
+        {
+            add_pixel(pending, path);
+        }
+
+        if (closed && m_count > 1 && m_last == m_first)
+        {
+            m_buffer.resize(m_last_start);
+            m_count--;
+        }
+
+        if (path)
+        {
+            if (m_count < min_ring_size)
+            {
+                m_buffer.resize(start);
+                return 0;
+            }
+            m_buffer += " z";
+        }
+        return m_count;
+    }
+
+    // Appends a pixel, or replaces the last one if it is between the one
+    // before and this one on a straight line
+    inline void add_pixel(pixel const& p, bool path)
+    {
+        if (m_count >= 2)
+        {
+            long const dx1 = m_last.x - m_previous.x;
+            long const dy1 = m_last.y - m_previous.y;
+            long const dx2 = p.x - m_last.x;
+            long const dy2 = p.y - m_last.y;
+            if (dx1 * dy2 == dy1 * dx2 && dx1 * dx2 + dy1 * dy2 > 0)
+            {
+                m_buffer.resize(m_last_start);
+                m_count--;
+                m_last = m_previous;
+            }
+        }
+
+        m_last_start = m_buffer.size();
+        if (path && m_count == 0)
+        {
+            m_buffer += *m_buffer.rbegin() == '"' ? "M " : " M ";
+        }
+        else if (path && m_count == 1)
+        {
+            m_buffer += " L ";
+        }
+        else if (m_count > 0)
+        {
+            m_buffer += ' ';
+        }
+        append(p.x);
+        m_buffer += ',';
+        append(p.y);
+
+        if (m_count == 0)
+        {
+            m_first = p;
+        }
+        m_previous = m_last;
+        m_last = p;
+        m_count++;
+    }
+
+    inline void append(long value)
+    {
+        char digits[24];
+        char* it = digits + sizeof(digits);
+        unsigned long magnitude = value < 0 ? 0ul - (unsigned long)(value)
+                                            : (unsigned long)(value);
+        do
+        {
+            *--it = char('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude > 0);
+        if (value < 0)
+        {
+            *--it = '-';
+        }
+        m_buffer.append(it, digits + sizeof(digits));
+    }
+
+    inline void flush(std::ostream& stream, double margin)
+    {
+        if (m_max_x + margin >= 0 && m_min_x - margin <= m_width
+            && m_max_y + margin >= 0 && m_min_y - margin <= m_height)
+        {
+            m_buffer += '\n';
+            stream.write(m_buffer.data(), std::streamsize(m_buffer.size()));
+        }
+    }
+
+    double m_width;
+    double m_height;
+    std::string m_buffer;
+    long m_min_x, m_min_y, m_max_x, m_max_y;
+
+    // State of the range being added
+    std::size_t m_count;
+    std::size_t m_last_start;
+    pixel m_first, m_previous, m_last;
+};
+
+}} // namespace detail::svg
+#endif // DOXYGEN_NO_DETAIL
+
+
 #ifndef DOXYGEN_NO_DISPATCH
 namespace dispatch
 {
@@ -247,6 +540,193 @@ struct devarianted_svg_map<SvgPoint, variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
 };
 
 
+template <typename GeometryTag, typename Geometry>
+struct svg_map_pixels
+{
+    BOOST_MPL_ASSERT_MSG
+        (
+            false, NOT_OR_NOT_YET_IMPLEMENTED_FOR_THIS_GEOMETRY_TYPE
+            , (Geometry)
+        );
+};
+
+template <typename Point>
+struct svg_map_pixels<point_tag, Point>
+{
+    template <typename TransformStrategy>
+    static inline void apply(std::ostream& stream,
+                    std::string const& style, double size,
+                    Point const& point, TransformStrategy const& strategy,
+                    detail::svg::pixel_writer& writer)
+    {
+        writer.point(stream, point, style, size, strategy);
+    }
+};
+
+template <typename Segment>
+struct svg_map_pixels<segment_tag, Segment>
+{
+    template <typename TransformStrategy>
+    static inline void apply(std::ostream& stream,
+                    std::string const& style, double,
+                    Segment const& segment, TransformStrategy const& strategy,
+                    detail::svg::pixel_writer& writer)
+    {
+        segment_view<Segment> const view(segment);
+        writer.range(stream, view, false, style, strategy);
+    }
+};
+
+template <typename Box>
+struct svg_map_pixels<box_tag, Box>
+{
+    template <typename TransformStrategy>
+    static inline void apply(std::ostream& stream,
+                    std::string const& style, double,
+                    Box const& box, TransformStrategy const& strategy,
+                    detail::svg::pixel_writer& writer)
+    {
+        box_view<Box> const view(box);
+        writer.range(stream, view, true, style, strategy);
+    }
+};
+
+template <typename Range, bool Closed>
+struct svg_map_pixels_range
+{
+    template <typename TransformStrategy>
+    static inline void apply(std::ostream& stream,
+                    std::string const& style, double,
+                    Range const& range, TransformStrategy const& strategy,
+                    detail::svg::pixel_writer& writer)
+    {
+        writer.range(stream, range, Closed, style, strategy);
+    }
+};
+
+template <typename Linestring>
+struct svg_map_pixels<linestring_tag, Linestring>
+    : svg_map_pixels_range<Linestring, false>
+{};
+
+template <typename Ring>
+struct svg_map_pixels<ring_tag, Ring>
+    : svg_map_pixels_range<Ring, true>
+{};
+
+template <typename Polygon>
+struct svg_map_pixels<polygon_tag, Polygon>
+{
+    template <typename TransformStrategy>
+    static inline void apply(std::ostream& stream,
+                    std::string const& style, double,
+                    Polygon const& polygon, TransformStrategy const& strategy,
+                    detail::svg::pixel_writer& writer)
+    {
+        writer.polygon(stream, polygon, style, strategy);
+    }
+};
+
+// Each element is culled separately
+template <typename Multi>
+struct svg_map_pixels<multi_tag, Multi>
+{
+    typedef typename single_tag_of
+      <
+          typename geometry::tag<Multi>::type
+      >::type stag;
+
+    template <typename TransformStrategy>
+    static inline void apply(std::ostream& stream,
+                    std::string const& style, double size,
+                    Multi const& multi, TransformStrategy const& strategy,
+                    detail::svg::pixel_writer& writer)
+    {
+        for (typename boost::range_iterator<Multi const>::type it
+            = boost::begin(multi);
+            it != boost::end(multi);
+            ++it)
+        {
+            svg_map_pixels
+                <
+                    stag,
+                    typename boost::range_value<Multi>::type
+                >::apply(stream, style, size, *it, strategy, writer);
+        }
+    }
+};
+
+
+template <typename Geometry>
+struct devarianted_svg_map_pixels
+{
+    template <typename TransformStrategy>
+    static inline void apply(std::ostream& stream,
+                             std::string const& style,
+                             double size,
+                             Geometry const& geometry,
+                             TransformStrategy const& strategy,
+                             detail::svg::pixel_writer& writer)
+    {
+        svg_map_pixels
+            <
+                typename tag_cast
+                    <
+                        typename tag<Geometry>::type,
+                        multi_tag
+                    >::type,
+                typename boost::remove_const<Geometry>::type
+            >::apply(stream, style, size, geometry, strategy, writer);
+    }
+};
+
+template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
+struct devarianted_svg_map_pixels<variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
+{
+    template <typename TransformStrategy>
+    struct visitor: static_visitor<void>
+    {
+        std::ostream& m_os;
+        std::string const& m_style;
+        double m_size;
+        TransformStrategy const& m_strategy;
+        detail::svg::pixel_writer& m_writer;
+
+        visitor(std::ostream& os,
+                std::string const& style,
+                double size,
+                TransformStrategy const& strategy,
+                detail::svg::pixel_writer& writer)
+            : m_os(os)
+            , m_style(style)
+            , m_size(size)
+            , m_strategy(strategy)
+            , m_writer(writer)
+        {}
+
+        template <typename Geometry>
+        inline void operator()(Geometry const& geometry) const
+        {
+            devarianted_svg_map_pixels<Geometry>::apply(m_os, m_style, m_size,
+                                                        geometry, m_strategy, m_writer);
+        }
+    };
+
+    template <typename TransformStrategy>
+    static inline void apply(std::ostream& stream,
+                             std::string const& style,
+                             double size,
+                             variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry,
+                             TransformStrategy const& strategy,
+                             detail::svg::pixel_writer& writer)
+    {
+        boost::apply_visitor(visitor<TransformStrategy>(stream, style, size,
+                                                        strategy, writer),
+                             geometry);
+    }
+};
+
+
 } // namespace dispatch
 #endif
 
@@ -302,6 +782,8 @@ class svg_mapper : boost::noncopyable
     std::ostream& m_stream;
     SvgCoordinateType m_width, m_height;
     std::string m_width_height; // for <svg> tag only, defaults to 2x 100%
+    bool m_streaming;
+    detail::svg::pixel_writer m_pixel_writer;
 
     void init_matrix()
     {
@@ -345,6 +827,8 @@ public :
         , m_width(width)
         , m_height(height)
         , m_width_height(width_height)
+        , m_streaming(false)
+        , m_pixel_writer(double(width), double(height))
     {
         assign_inverse(m_bounding_box);
     }
@@ -366,7 +850,7 @@ public :
     template <typename Geometry>
     void add(Geometry const& geometry)
     {
-        if (! geometry::is_empty(geometry))
+        if (! m_streaming && ! geometry::is_empty(geometry))
         {
             expand(m_bounding_box,
                 return_envelope
@@ -389,7 +873,39 @@ public :
                 double size = -1.0)
     {
         init_matrix();
-        svg_map<svg_point_type>(m_stream, style, size, geometry, *m_matrix);
+        if (m_streaming)
+        {
+            dispatch::devarianted_svg_map_pixels<Geometry>::apply(m_stream,
+                    style, size, geometry, *m_matrix, m_pixel_writer);
+        }
+        else
+        {
+            svg_map<svg_point_type>(m_stream, style, size, geometry, *m_matrix);
+        }
+    }
+
+    /*!
+    \brief Switches to streaming mode, mapping the specified box onto the
+        SVG map. Should be called before anything is mapped.
+    \details In streaming mode geometries are written in whole SVG pixels
+        while they are mapped. Of vertices within one pixel of the last
+        written pixel only the last one is written, straight runs of pixels
+        are written as one segment, rings of less than three pixels are
+        skipped, and geometries (or elements of multi geometries) outside
+        the SVG map are not written. So the size of the
+        SVG follows the number of pixels instead of the number of vertices.
+        Geometries passed to add are ignored in streaming mode.
+    \tparam Box \tparam_box
+    \param viewport Box, in map units, which is mapped onto the SVG map
+    */
+    template <typename Box>
+    void streaming(Box const& viewport)
+    {
+        BOOST_GEOMETRY_ASSERT(! m_matrix);
+
+        assign_inverse(m_bounding_box);
+        expand(m_bounding_box, viewport);
+        m_streaming = true;
     }
 
     /*!
@@ -0,0 +1,95 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_ENDIAN_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_ENDIAN_HPP
+
+#include <climits>
+#include <cstddef>
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/predef/other/endian.h>
+
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+
+#if CHAR_BIT != 8
+#error Platforms with CHAR_BIT != 8 are not supported
+#endif
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+inline byte_order_type::enum_t native_byte_order()
+{
+#if BOOST_ENDIAN_BIG_BYTE
+    return byte_order_type::xdr;
+#else
+    return byte_order_type::ndr;
+#endif
+}
+
+// Values are copied byte by byte, in reversed order if the byte order of
+// the data is not the byte order of the platform. For pointers the loops
+// are compiled to single loads and stores (or byte swaps).
+template <typename T, bool Reverse>
+struct value_bytes
+{
+    template <typename Iterator>
+    static inline T load(Iterator it)
+    {
+        boost::uint8_t bytes[sizeof(T)];
+        for (std::size_t i = 0; i < sizeof(T); i++)
+        {
+            bytes[Reverse ? sizeof(T) - 1 - i : i] = static_cast<boost::uint8_t>(it[i]);
+        }
+        T value;
+        std::memcpy(&value, bytes, sizeof(T));
+        return value;
+    }
+
+    template <typename OutputIterator>
+    static inline void store(T const& value, OutputIterator& iter)
+    {
+        boost::uint8_t bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        for (std::size_t i = 0; i < sizeof(T); i++)
+        {
+            *iter = bytes[Reverse ? sizeof(T) - 1 - i : i];
+            ++iter;
+        }
+    }
+};
+
+template <typename T, typename Iterator>
+inline T load_value(Iterator it, bool reverse)
+{
+    return reverse ? value_bytes<T, true>::load(it)
+                   : value_bytes<T, false>::load(it);
+}
+
+template <typename T, typename OutputIterator>
+inline void store_value(T const& value, OutputIterator& iter, bool reverse)
+{
+    if (reverse)
+    {
+        value_bytes<T, true>::store(value, iter);
+    }
+    else
+    {
+        value_bytes<T, false>::store(value, iter);
+    }
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_ENDIAN_HPP
@@ -0,0 +1,176 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+namespace boost { namespace geometry
+{
+
+// The well-known binary representation for OGC geometry (WKBGeometry),
+// provides a portable representation of a geometry value as a contiguous
+// stream of bytes. It permits geometry values to be exchanged between
+// a client application and an SQL database in binary form.
+//
+// Basic Type definitions
+// byte : 1 byte
+// uint32 : 32 bit unsigned integer (4 bytes)
+// double : double precision number (8 bytes)
+//
+// enum wkbByteOrder
+// {
+//   wkbXDR = 0, // Big Endian
+//   wkbNDR = 1  // Little Endian
+// };
+//
+// enum wkbGeometryType
+// {
+//   wkbPoint = 1,
+//   wkbLineString = 2,
+//   wkbPolygon = 3,
+//   wkbMultiPoint = 4,
+//   wkbMultiLineString = 5,
+//   wkbMultiPolygon = 6,
+//   wkbGeometryCollection = 7
+// };
+//
+// ISO WKB adds 1000 to the type of geometries with Z coordinates, 2000 if
+// they have M values and 3000 if they have both. PostGIS EWKB sets flags
+// in the highest bits of the type instead, and a flag indicating that an
+// SRID follows the type.
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+struct byte_order_type
+{
+    enum enum_t
+    {
+        xdr     = 0, // wkbXDR, bit-endian
+        ndr     = 1, // wkbNDR, little-endian
+        unknown = 2  // not defined by OGC
+    };
+};
+
+struct geometry_type_ogc
+{
+    enum enum_t
+    {
+        point      = 1,
+        linestring = 2,
+        polygon    = 3,
+        multipoint = 4,
+        multilinestring = 5,
+        multipolygon = 6,
+        collection = 7
+    };
+};
+
+struct ewkb_flags
+{
+    static const boost::uint32_t z = 0x80000000;
+    static const boost::uint32_t m = 0x40000000;
+    static const boost::uint32_t srid = 0x20000000;
+    static const boost::uint32_t all = 0xF0000000;
+};
+
+// Header of a WKB geometry, ISO or EWKB
+struct geometry_header
+{
+    byte_order_type::enum_t byte_order;
+    boost::uint32_t type; // geometry_type_ogc
+    bool has_z;
+    bool has_m;
+    bool has_srid;
+    boost::uint32_t srid;
+
+    std::size_t coordinate_count() const
+    {
+        return 2 + (has_z ? 1 : 0) + (has_m ? 1 : 0);
+    }
+};
+
+
+template <typename Tag>
+struct geometry_type_code
+{
+    static const boost::uint32_t value = 0; // not representable
+};
+
+template <>
+struct geometry_type_code<point_tag>
+{
+    static const boost::uint32_t value = geometry_type_ogc::point;
+};
+
+template <>
+struct geometry_type_code<linestring_tag>
+{
+    static const boost::uint32_t value = geometry_type_ogc::linestring;
+};
+
+template <>
+struct geometry_type_code<polygon_tag>
+{
+    static const boost::uint32_t value = geometry_type_ogc::polygon;
+};
+
+template <>
+struct geometry_type_code<multi_point_tag>
+{
+    static const boost::uint32_t value = geometry_type_ogc::multipoint;
+};
+
+template <>
+struct geometry_type_code<multi_linestring_tag>
+{
+    static const boost::uint32_t value = geometry_type_ogc::multilinestring;
+};
+
+template <>
+struct geometry_type_code<multi_polygon_tag>
+{
+    static const boost::uint32_t value = geometry_type_ogc::multipolygon;
+};
+
+
+// OGC type and number of coordinates of the points of a geometry
+template <typename Geometry>
+struct geometry_type
+{
+    static const boost::uint32_t code
+        = geometry_type_code<typename tag<Geometry>::type>::value;
+    static const std::size_t coordinate_count = dimension<Geometry>::value;
+
+    // The writer writes a third coordinate as Z and a fourth one as M, so
+    // only XY, XYZ and XYZM are read. XYM is rejected because its M values
+    // would otherwise end up as Z.
+    static bool check(geometry_header const& header)
+    {
+        return code != 0
+            && header.type == code
+            && header.has_z == (coordinate_count >= 3)
+            && header.has_m == (coordinate_count >= 4)
+            && header.coordinate_count() == coordinate_count;
+    }
+};
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
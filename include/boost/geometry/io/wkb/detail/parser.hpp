@@ -0,0 +1,349 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
+// Copyright (c) 2015 Mats Taraldsvik.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_PARSER_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_PARSER_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/util/range.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Minimal size of a geometry: byte order and type
+static const std::size_t header_size = 5;
+
+template <typename Iterator>
+inline std::size_t remaining(Iterator it, Iterator end)
+{
+    return std::size_t(end - it);
+}
+
+template <typename Iterator>
+inline bool parse_header(Iterator& it, Iterator end, geometry_header& header)
+{
+    if (remaining(it, end) < header_size)
+    {
+        return false;
+    }
+
+    boost::uint8_t const order = static_cast<boost::uint8_t>(*it);
+    if (order >= byte_order_type::unknown)
+    {
+        return false;
+    }
+    header.byte_order = byte_order_type::enum_t(order);
+    bool const reverse = header.byte_order != native_byte_order();
+
+    boost::uint32_t type = load_value<boost::uint32_t>(it + 1, reverse);
+    it += header_size;
+
+    header.has_z = (type & ewkb_flags::z) != 0;
+    header.has_m = (type & ewkb_flags::m) != 0;
+    header.has_srid = (type & ewkb_flags::srid) != 0;
+    type &= ~ewkb_flags::all;
+
+    boost::uint32_t const iso_dimension = type / 1000;
+    if (iso_dimension > 3)
+    {
+        return false;
+    }
+    header.has_z = header.has_z || iso_dimension == 1 || iso_dimension == 3;
+    header.has_m = header.has_m || iso_dimension == 2 || iso_dimension == 3;
+    header.type = type % 1000;
+
+    header.srid = 0;
+    if (header.has_srid)
+    {
+        if (remaining(it, end) < 4)
+        {
+            return false;
+        }
+        header.srid = load_value<boost::uint32_t>(it, reverse);
+        it += 4;
+    }
+
+    return true;
+}
+
+// Reads the number of elements, false if there are less than
+// min_element_size * count bytes left
+template <typename Iterator>
+inline bool parse_count(Iterator& it, Iterator end,
+                        geometry_header const& header,
+                        std::size_t min_element_size,
+                        boost::uint32_t& count)
+{
+    if (remaining(it, end) < 4)
+    {
+        return false;
+    }
+    count = load_value<boost::uint32_t>(it, header.byte_order != native_byte_order());
+    it += 4;
+    return boost::uint64_t(count) * min_element_size
+        <= boost::uint64_t(remaining(it, end));
+}
+
+
+// Coordinates are stored as doubles, they are converted to the
+// coordinate type of the point
+template
+<
+    typename Point,
+    bool Reverse,
+    std::size_t I = 0,
+    std::size_t N = dimension<Point>::value
+>
+struct coordinates_parser
+{
+    template <typename Iterator>
+    static inline void apply(Iterator it, Point& point)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        set<I>(point, static_cast<coordinate_type>(
+                value_bytes<double, Reverse>::load(it + I * sizeof(double))));
+        coordinates_parser<Point, Reverse, I + 1, N>::apply(it, point);
+    }
+};
+
+template <typename Point, bool Reverse, std::size_t N>
+struct coordinates_parser<Point, Reverse, N, N>
+{
+    template <typename Iterator>
+    static inline void apply(Iterator, Point&)
+    {}
+};
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct body_parser
+{};
+
+template <typename Point>
+struct body_parser<Point, point_tag>
+{
+    static const std::size_t min_size = dimension<Point>::value * sizeof(double);
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Point& point,
+                             geometry_header const& header)
+    {
+        if (remaining(it, end) < min_size)
+        {
+            return false;
+        }
+        if (header.byte_order == native_byte_order())
+        {
+            coordinates_parser<Point, false>::apply(it, point);
+        }
+        else
+        {
+            coordinates_parser<Point, true>::apply(it, point);
+        }
+        it += min_size;
+        return true;
+    }
+};
+
+// Points of a linestring or a ring, the range is resized once and the
+// coordinates are decoded in one loop, without checks of the byte order
+template <typename Range>
+struct points_parser
+{
+    typedef typename point_type<Range>::type point_type;
+
+    static const std::size_t point_size = dimension<point_type>::value * sizeof(double);
+    static const std::size_t min_size = 4;
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Range& range,
+                             geometry_header const& header)
+    {
+        boost::uint32_t count = 0;
+        if (! parse_count(it, end, header, point_size, count))
+        {
+            return false;
+        }
+
+        range::resize(range, count);
+        if (header.byte_order == native_byte_order())
+        {
+            decode<false>(it, range);
+        }
+        else
+        {
+            decode<true>(it, range);
+        }
+        return true;
+    }
+
+private:
+    template <bool Reverse, typename Iterator>
+    static inline void decode(Iterator& it, Range& range)
+    {
+        typedef typename boost::range_iterator<Range>::type iterator_type;
+        for (iterator_type pit = boost::begin(range); pit != boost::end(range); ++pit)
+        {
+            coordinates_parser<point_type, Reverse>::apply(it, *pit);
+            it += point_size;
+        }
+    }
+};
+
+template <typename Linestring>
+struct body_parser<Linestring, linestring_tag>
+    : points_parser<Linestring>
+{};
+
+template <typename Polygon>
+struct body_parser<Polygon, polygon_tag>
+{
+    static const std::size_t min_size = 4;
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Polygon& polygon,
+                             geometry_header const& header)
+    {
+        typedef typename ring_type<Polygon>::type ring_type;
+        typedef typename boost::remove_reference
+            <
+                typename traits::interior_mutable_type<Polygon>::type
+            >::type interior_type;
+
+        boost::uint32_t count = 0;
+        if (! parse_count(it, end, header, points_parser<ring_type>::min_size, count))
+        {
+            return false;
+        }
+
+        interior_type& interiors = interior_rings(polygon);
+        if (count == 0)
+        {
+            range::clear(exterior_ring(polygon));
+            range::clear(interiors);
+            return true;
+        }
+
+        if (! points_parser<ring_type>::parse(it, end, exterior_ring(polygon), header))
+        {
+            return false;
+        }
+
+        range::resize(interiors, count - 1);
+        typedef typename boost::range_iterator<interior_type>::type iterator_type;
+        for (iterator_type rit = boost::begin(interiors); rit != boost::end(interiors); ++rit)
+        {
+            if (! points_parser<ring_type>::parse(it, end, *rit, header))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Elements of multi geometries have their own headers, the byte order
+// can be different for each of them
+template <typename MultiGeometry>
+struct multi_parser
+{
+    typedef typename boost::range_value<MultiGeometry>::type element_type;
+
+    static const std::size_t min_size = 4;
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, MultiGeometry& multi,
+                             geometry_header const& header)
+    {
+        boost::uint32_t count = 0;
+        if (! parse_count(it, end, header, header_size, count))
+        {
+            return false;
+        }
+
+        range::resize(multi, count);
+        typedef typename boost::range_iterator<MultiGeometry>::type iterator_type;
+        for (iterator_type eit = boost::begin(multi); eit != boost::end(multi); ++eit)
+        {
+            geometry_header element_header;
+            if (! parse_header(it, end, element_header)
+                || ! geometry_type<element_type>::check(element_header)
+                || ! body_parser<element_type>::parse(it, end, *eit, element_header))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <typename MultiPoint>
+struct body_parser<MultiPoint, multi_point_tag>
+    : multi_parser<MultiPoint>
+{};
+
+template <typename MultiLinestring>
+struct body_parser<MultiLinestring, multi_linestring_tag>
+    : multi_parser<MultiLinestring>
+{};
+
+template <typename MultiPolygon>
+struct body_parser<MultiPolygon, multi_polygon_tag>
+    : multi_parser<MultiPolygon>
+{};
+
+
+// Parses the header and the geometry, the storage of the geometry
+// (e.g. of its rings) is reused
+template <typename Geometry>
+struct geometry_parser
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+                             boost::uint32_t& srid)
+    {
+        geometry_header header;
+        if (! parse_header(it, end, header)
+            || ! geometry_type<Geometry>::check(header))
+        {
+            return false;
+        }
+        srid = header.srid;
+        return body_parser<Geometry>::parse(it, end, geometry, header);
+    }
+};
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_PARSER_HPP
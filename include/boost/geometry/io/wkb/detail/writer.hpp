@@ -0,0 +1,269 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
+// Copyright (c) 2015 Mats Taraldsvik.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_WRITER_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_WRITER_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// How geometries are written: byte order, ISO WKB or EWKB with an
+// optional SRID written in the header of the outermost geometry
+struct writer_options
+{
+    writer_options(byte_order_type::enum_t order, bool ewkb, boost::uint32_t srid)
+        : byte_order(order)
+        , reverse(order != native_byte_order())
+        , ewkb(ewkb)
+        , srid(srid)
+    {}
+
+    byte_order_type::enum_t byte_order;
+    bool reverse;
+    bool ewkb;
+    boost::uint32_t srid;
+};
+
+template <typename OutputIterator>
+inline void write_header(boost::uint32_t code, std::size_t coordinate_count,
+                         bool outermost, OutputIterator& iter,
+                         writer_options const& options)
+{
+    *iter = static_cast<boost::uint8_t>(options.byte_order);
+    ++iter;
+
+    boost::uint32_t type = code;
+    bool const has_srid = options.ewkb && outermost && options.srid != 0;
+    if (options.ewkb)
+    {
+        type |= coordinate_count >= 3 ? ewkb_flags::z : 0;
+        type |= coordinate_count >= 4 ? ewkb_flags::m : 0;
+        type |= has_srid ? ewkb_flags::srid : 0;
+    }
+    else
+    {
+        type += coordinate_count == 3 ? 1000
+              : coordinate_count == 4 ? 3000
+              : 0;
+    }
+    store_value(type, iter, options.reverse);
+
+    if (has_srid)
+    {
+        store_value(options.srid, iter, options.reverse);
+    }
+}
+
+template <typename OutputIterator>
+inline void write_count(std::size_t count, OutputIterator& iter,
+                        writer_options const& options)
+{
+    store_value(boost::uint32_t(count), iter, options.reverse);
+}
+
+
+// NOTE: coordinates of any type are converted to double
+template
+<
+    typename Point,
+    bool Reverse,
+    std::size_t I = 0,
+    std::size_t N = dimension<Point>::value
+>
+struct coordinates_writer
+{
+    template <typename OutputIterator>
+    static inline void apply(Point const& point, OutputIterator& iter)
+    {
+        value_bytes<double, Reverse>::store(double(geometry::get<I>(point)), iter);
+        coordinates_writer<Point, Reverse, I + 1, N>::apply(point, iter);
+    }
+};
+
+template <typename Point, bool Reverse, std::size_t N>
+struct coordinates_writer<Point, Reverse, N, N>
+{
+    template <typename OutputIterator>
+    static inline void apply(Point const&, OutputIterator&)
+    {}
+};
+
+template <typename Point, typename OutputIterator>
+inline void write_point(Point const& point, OutputIterator& iter,
+                        writer_options const& options)
+{
+    if (options.reverse)
+    {
+        coordinates_writer<Point, true>::apply(point, iter);
+    }
+    else
+    {
+        coordinates_writer<Point, false>::apply(point, iter);
+    }
+}
+
+template <typename Range, bool Reverse, typename OutputIterator>
+inline void write_points(Range const& range, OutputIterator& iter)
+{
+    typedef typename point_type<Range>::type point_type;
+    typedef typename boost::range_iterator<Range const>::type iterator_type;
+    for (iterator_type it = boost::begin(range); it != boost::end(range); ++it)
+    {
+        coordinates_writer<point_type, Reverse>::apply(*it, iter);
+    }
+}
+
+template <typename Range, typename OutputIterator>
+inline void write_points(Range const& range, OutputIterator& iter,
+                         writer_options const& options)
+{
+    write_count(boost::size(range), iter, options);
+    if (options.reverse)
+    {
+        write_points<Range, true>(range, iter);
+    }
+    else
+    {
+        write_points<Range, false>(range, iter);
+    }
+}
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct body_writer
+{};
+
+template <typename Point>
+struct body_writer<Point, point_tag>
+{
+    template <typename OutputIterator>
+    static inline void write(Point const& point, OutputIterator& iter,
+                             writer_options const& options)
+    {
+        write_point(point, iter, options);
+    }
+};
+
+template <typename Linestring>
+struct body_writer<Linestring, linestring_tag>
+{
+    template <typename OutputIterator>
+    static inline void write(Linestring const& linestring, OutputIterator& iter,
+                             writer_options const& options)
+    {
+        write_points(linestring, iter, options);
+    }
+};
+
+template <typename Polygon>
+struct body_writer<Polygon, polygon_tag>
+{
+    template <typename OutputIterator>
+    static inline void write(Polygon const& polygon, OutputIterator& iter,
+                             writer_options const& options)
+    {
+        typedef typename interior_type<Polygon const>::type interior_type;
+        typedef typename boost::range_iterator<interior_type const>::type iterator_type;
+
+        typename interior_return_type<Polygon const>::type
+            interiors = interior_rings(polygon);
+
+        write_count(1 + boost::size(interiors), iter, options);
+        write_points(exterior_ring(polygon), iter, options);
+        for (iterator_type it = boost::begin(interiors); it != boost::end(interiors); ++it)
+        {
+            write_points(*it, iter, options);
+        }
+    }
+};
+
+template <typename Geometry>
+struct geometry_writer
+{
+    template <typename OutputIterator>
+    static inline bool write(Geometry const& geometry, OutputIterator& iter,
+                             writer_options const& options, bool outermost = true)
+    {
+        if (geometry_type<Geometry>::coordinate_count < 2
+            || geometry_type<Geometry>::coordinate_count > 4)
+        {
+            return false;
+        }
+
+        write_header(geometry_type<Geometry>::code,
+                     geometry_type<Geometry>::coordinate_count,
+                     outermost, iter, options);
+        body_writer<Geometry>::write(geometry, iter, options);
+        return true;
+    }
+};
+
+// Elements of multi geometries are written with their headers
+template <typename MultiGeometry>
+struct multi_writer
+{
+    typedef typename boost::range_value<MultiGeometry>::type element_type;
+
+    template <typename OutputIterator>
+    static inline void write(MultiGeometry const& multi, OutputIterator& iter,
+                             writer_options const& options)
+    {
+        typedef typename boost::range_iterator<MultiGeometry const>::type iterator_type;
+
+        write_count(boost::size(multi), iter, options);
+        for (iterator_type it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            geometry_writer<element_type>::write(*it, iter, options, false);
+        }
+    }
+};
+
+template <typename MultiPoint>
+struct body_writer<MultiPoint, multi_point_tag>
+    : multi_writer<MultiPoint>
+{};
+
+template <typename MultiLinestring>
+struct body_writer<MultiLinestring, multi_linestring_tag>
+    : multi_writer<MultiLinestring>
+{};
+
+template <typename MultiPolygon>
+struct body_writer<MultiPolygon, multi_polygon_tag>
+    : multi_writer<MultiPolygon>
+{};
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_WRITER_HPP
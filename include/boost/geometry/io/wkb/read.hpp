@@ -0,0 +1,290 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_READ_HPP
+#define BOOST_GEOMETRY_IO_WKB_READ_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/next.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/variant/get.hpp>
+#include <boost/variant/variant_fwd.hpp>
+
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/io/wkb/detail/parser.hpp>
+#include <boost/geometry/util/range.hpp>
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Read WKB Exception
+\ingroup core
+\details The read_wkb_exception is thrown when there is an error in wkb parsing
+ */
+class read_wkb_exception : public geometry::exception
+{
+public:
+
+    inline read_wkb_exception() {}
+
+    virtual char const* what() const throw()
+    {
+        return "Boost.Geometry Read WKB exception";
+    }
+};
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Parses the alternative of the variant having the type and the number
+// of coordinates of the header
+template
+<
+    typename Variant,
+    typename First = typename boost::mpl::begin<typename Variant::types>::type,
+    typename Last = typename boost::mpl::end<typename Variant::types>::type
+>
+struct variant_parser
+{
+    typedef typename boost::mpl::deref<First>::type geometry_type;
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Variant& variant,
+                             geometry_header const& header)
+    {
+        if (! wkb::geometry_type<geometry_type>::check(header))
+        {
+            return variant_parser
+                <
+                    Variant, typename boost::mpl::next<First>::type, Last
+                >::parse(it, end, variant, header);
+        }
+
+        geometry_type* geometry = boost::get<geometry_type>(&variant);
+        if (geometry == NULL)
+        {
+            variant = geometry_type();
+            geometry = boost::get<geometry_type>(&variant);
+        }
+        return body_parser<geometry_type>::parse(it, end, *geometry, header);
+    }
+};
+
+template <typename Variant, typename Last>
+struct variant_parser<Variant, Last, Last>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator&, Iterator, Variant&, geometry_header const&)
+    {
+        return false;
+    }
+};
+
+// Elements of geometry collections are appended to a range of variants,
+// nested collections are flattened
+template <typename Collection>
+struct collection_parser
+{
+    typedef typename boost::range_value<Collection>::type variant_type;
+
+    static const int max_depth = 32;
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Collection& collection,
+                             geometry_header const& header, int depth)
+    {
+        if (header.type != geometry_type_ogc::collection)
+        {
+            variant_type variant;
+            if (! variant_parser<variant_type>::parse(it, end, variant, header))
+            {
+                return false;
+            }
+            range::push_back(collection, variant);
+            return true;
+        }
+
+        boost::uint32_t count = 0;
+        if (depth > max_depth
+            || ! parse_count(it, end, header, header_size, count))
+        {
+            return false;
+        }
+
+        for (boost::uint32_t i = 0; i < count; i++)
+        {
+            geometry_header element_header;
+            if (! parse_header(it, end, element_header)
+                || ! parse(it, end, collection, element_header, depth + 1))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <typename Iterator>
+inline void check_iterator()
+{
+    // Stream of bytes can only be parsed using random access iterator.
+    BOOST_STATIC_ASSERT((
+        boost::is_convertible
+        <
+            typename std::iterator_traits<Iterator>::iterator_category,
+            const std::random_access_iterator_tag&
+        >::value));
+
+    // Very basic pre-conditions check on stream of bytes passed in
+    BOOST_STATIC_ASSERT((
+        boost::is_integral<typename std::iterator_traits<Iterator>::value_type>::value
+    ));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) ==
+        sizeof(typename std::iterator_traits<Iterator>::value_type)
+    ));
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace resolve_variant
+{
+
+template <typename Geometry>
+struct read_wkb
+{
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator end, Geometry& geometry,
+                             boost::uint32_t& srid)
+    {
+        concepts::check<Geometry>();
+        return detail::wkb::geometry_parser<Geometry>::parse(it, end, geometry, srid);
+    }
+};
+
+template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
+struct read_wkb<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
+{
+    typedef boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> variant_type;
+
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator end, variant_type& variant,
+                             boost::uint32_t& srid)
+    {
+        detail::wkb::geometry_header header;
+        if (! detail::wkb::parse_header(it, end, header))
+        {
+            return false;
+        }
+        srid = header.srid;
+        return detail::wkb::variant_parser<variant_type>::parse(it, end, variant, header);
+    }
+};
+
+} // namespace resolve_variant
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Parses Well-Known Binary (WKB) or PostGIS Extended WKB (EWKB)
+    into a geometry
+\details Both byte orders are supported, each geometry can have its own
+    byte order. The number of coordinates (Z and M values given as ISO
+    type codes or as EWKB flags) has to match the dimension of the
+    geometry. Coordinates of ranges are decoded directly into the
+    resized ranges, so the storage of the geometry is reused.
+    The geometry can be a boost::variant, then the alternative of the
+    type of the WKB is assigned.
+\ingroup wkb
+\param begin first byte, the iterator has to be a random access iterator
+\param end end of the bytes
+\param geometry \param_geometry output geometry
+\param srid set to the SRID of EWKB or to 0 if there is none
+\return false if the WKB is invalid or does not correspond to the geometry
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry,
+                     boost::uint32_t& srid)
+{
+    detail::wkb::check_iterator<Iterator>();
+
+    srid = 0;
+    return resolve_variant::read_wkb<Geometry>::apply(begin, end, geometry, srid);
+}
+
+/*!
+\brief Parses Well-Known Binary (WKB) or PostGIS Extended WKB (EWKB)
+    into a geometry
+\ingroup wkb
+\param begin first byte, the iterator has to be a random access iterator
+\param end end of the bytes
+\param geometry \param_geometry output geometry
+\return false if the WKB is invalid or does not correspond to the geometry
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry)
+{
+    boost::uint32_t srid = 0;
+    return read_wkb(begin, end, geometry, srid);
+}
+
+template <typename ByteType, typename Geometry>
+inline bool read_wkb(ByteType const* bytes, std::size_t length, Geometry& geometry)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    ByteType const* begin = bytes;
+    ByteType const* const end = bytes + length;
+
+    return read_wkb(begin, end, geometry);
+}
+
+/*!
+\brief Parses a WKB geometry collection into a range of variants
+\details The geometries are appended to the collection, nested collections
+    are flattened. Any other WKB geometry is appended as one element.
+\ingroup wkb
+\param begin first byte, the iterator has to be a random access iterator
+\param end end of the bytes
+\param collection range of boost::variant of geometries
+\return false if the WKB is invalid or contains a geometry which is not
+    an alternative of the variant
+*/
+template <typename Iterator, typename Collection>
+inline bool read_wkb_collection(Iterator begin, Iterator end,
+                                Collection& collection)
+{
+    detail::wkb::check_iterator<Iterator>();
+
+    detail::wkb::geometry_header header;
+    return detail::wkb::parse_header(begin, end, header)
+        && detail::wkb::collection_parser<Collection>::parse(begin, end,
+                                                             collection,
+                                                             header, 0);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_READ_HPP
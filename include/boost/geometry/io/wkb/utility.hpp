@@ -0,0 +1,99 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_UTILITY_HPP
+#define BOOST_GEOMETRY_IO_WKB_UTILITY_HPP
+
+#include <iterator>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Value of a hexadecimal digit, -1 for other characters
+inline int hex_digit_value(char c)
+{
+    return c >= '0' && c <= '9' ? c - '0'
+         : c >= 'a' && c <= 'f' ? c - 'a' + 10
+         : c >= 'A' && c <= 'F' ? c - 'A' + 10
+         : -1;
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+/*!
+\brief Converts hexadecimal WKB, e.g. as returned by PostGIS, to bytes
+\ingroup wkb
+\return false if the string is not a sequence of hexadecimal bytes
+*/
+template <typename OutputIterator>
+bool hex2wkb(std::string const& hex, OutputIterator bytes)
+{
+    // Bytes can be only written to output iterator.
+    BOOST_STATIC_ASSERT((boost::is_convertible<
+        typename std::iterator_traits<OutputIterator>::iterator_category,
+        const std::output_iterator_tag&>::value));
+
+    if (0 != hex.size() % 2)
+    {
+        return false;
+    }
+
+    for (std::string::size_type i = 0; i < hex.size(); i += 2)
+    {
+        int const high = detail::wkb::hex_digit_value(hex[i]);
+        int const low = detail::wkb::hex_digit_value(hex[i + 1]);
+        if (high < 0 || low < 0)
+        {
+            return false;
+        }
+        *bytes = static_cast<boost::uint8_t>(high * 16 + low);
+        ++bytes;
+    }
+
+    return true;
+}
+
+/*!
+\brief Converts bytes of WKB to hexadecimal WKB, with uppercase digits
+\ingroup wkb
+*/
+template <typename Iterator>
+bool wkb2hex(Iterator begin, Iterator end, std::string& hex)
+{
+    // Stream of bytes can only be passed using random access iterator.
+    BOOST_STATIC_ASSERT((boost::is_convertible<
+        typename std::iterator_traits<Iterator>::iterator_category,
+        const std::random_access_iterator_tag&>::value));
+
+    char const hexalpha[] = "0123456789ABCDEF";
+
+    hex.clear();
+    hex.reserve(2 * std::size_t(end - begin));
+    for (Iterator it = begin; it != end; ++it)
+    {
+        boost::uint8_t const byte = static_cast<boost::uint8_t>(*it);
+        hex += hexalpha[(byte >> 4) & 0xf];
+        hex += hexalpha[byte & 0xf];
+    }
+
+    return begin != end;
+}
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_UTILITY_HPP
@@ -0,0 +1,166 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WRITE_HPP
+#define BOOST_GEOMETRY_IO_WKB_WRITE_HPP
+
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/variant_fwd.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/io/wkb/detail/writer.hpp>
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Byte order of written WKB
+\ingroup wkb
+*/
+struct wkb_byte_order
+{
+    enum enum_t
+    {
+        big_endian    = 0, // wkbXDR
+        little_endian = 1, // wkbNDR
+        native        = 2  // byte order of the platform
+    };
+};
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+template <typename OutputIterator>
+inline void check_output_iterator()
+{
+    // The WKB is written to an OutputIterator.
+    BOOST_STATIC_ASSERT((
+        boost::is_convertible
+        <
+            typename std::iterator_traits<OutputIterator>::iterator_category,
+            const std::output_iterator_tag&
+        >::value));
+}
+
+inline byte_order_type::enum_t to_byte_order(wkb_byte_order::enum_t order)
+{
+    return order == wkb_byte_order::big_endian ? byte_order_type::xdr
+         : order == wkb_byte_order::little_endian ? byte_order_type::ndr
+         : native_byte_order();
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace resolve_variant
+{
+
+template <typename Geometry>
+struct write_wkb
+{
+    template <typename OutputIterator>
+    static inline bool apply(Geometry const& geometry, OutputIterator& iter,
+                             detail::wkb::writer_options const& options)
+    {
+        concepts::check<Geometry const>();
+        return detail::wkb::geometry_writer<Geometry>::write(geometry, iter, options);
+    }
+};
+
+template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
+struct write_wkb<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
+{
+    template <typename OutputIterator>
+    struct visitor : static_visitor<bool>
+    {
+        visitor(OutputIterator& iter, detail::wkb::writer_options const& options)
+            : m_iter(iter)
+            , m_options(options)
+        {}
+
+        template <typename Geometry>
+        bool operator()(Geometry const& geometry) const
+        {
+            return write_wkb<Geometry>::apply(geometry, m_iter, m_options);
+        }
+
+        OutputIterator& m_iter;
+        detail::wkb::writer_options const& m_options;
+    };
+
+    template <typename OutputIterator>
+    static inline bool apply(boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry,
+                             OutputIterator& iter,
+                             detail::wkb::writer_options const& options)
+    {
+        return boost::apply_visitor(visitor<OutputIterator>(iter, options), geometry);
+    }
+};
+
+} // namespace resolve_variant
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Writes a geometry as ISO Well-Known Binary (WKB)
+\details Geometries with 3 coordinates are written as Z geometries and
+    geometries with 4 coordinates as ZM geometries. The geometry can be
+    a boost::variant.
+\ingroup wkb
+\param geometry \param_geometry
+\param iter output iterator the bytes are written to
+\param byte_order byte order of the WKB, by default the native one
+\return false if the geometry cannot be represented in WKB
+*/
+template <typename Geometry, typename OutputIterator>
+inline bool write_wkb(Geometry const& geometry, OutputIterator iter,
+                      wkb_byte_order::enum_t byte_order = wkb_byte_order::native)
+{
+    detail::wkb::check_output_iterator<OutputIterator>();
+
+    detail::wkb::writer_options const options(
+        detail::wkb::to_byte_order(byte_order), false, 0);
+    return resolve_variant::write_wkb<Geometry>::apply(geometry, iter, options);
+}
+
+/*!
+\brief Writes a geometry as PostGIS Extended Well-Known Binary (EWKB)
+\details The Z and M values are indicated with flags of the type. If the
+    SRID is not 0 it is written in the header of the geometry.
+\ingroup wkb
+\param geometry \param_geometry
+\param iter output iterator the bytes are written to
+\param srid SRID of the geometry, 0 if it should not be written
+\param byte_order byte order of the EWKB, by default the native one
+\return false if the geometry cannot be represented in EWKB
+*/
+template <typename Geometry, typename OutputIterator>
+inline bool write_ewkb(Geometry const& geometry, OutputIterator iter,
+                       boost::uint32_t srid = 0,
+                       wkb_byte_order::enum_t byte_order = wkb_byte_order::native)
+{
+    detail::wkb::check_output_iterator<OutputIterator>();
+
+    detail::wkb::writer_options const options(
+        detail::wkb::to_byte_order(byte_order), true, srid);
+    return resolve_variant::write_wkb<Geometry>::apply(geometry, iter, options);
+}
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_WRITE_HPP
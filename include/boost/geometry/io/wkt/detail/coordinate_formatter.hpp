@@ -0,0 +1,612 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_FORMATTER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_FORMATTER_HPP
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+// The shortest decimal representation of float and double which is read
+// back as the same value is generated with Grisu2 (F. Loitsch, "Printing
+// Floating-Point Numbers Quickly and Accurately with Integers", 2010).
+// The result always round-trips, without tables of the size Ryu needs.
+// The rare values for which Grisu2 is not the shortest are detected as in
+// Grisu3, their digits are generated by the standard library.
+
+// Floating point number f * 2^e with a 64-bit significand
+struct diy_fp
+{
+    boost::uint64_t f;
+    int e;
+
+    inline diy_fp(boost::uint64_t f_, int e_)
+        : f(f_), e(e_)
+    {}
+
+    static inline diy_fp sub(diy_fp const& x, diy_fp const& y)
+    {
+        return diy_fp(x.f - y.f, x.e);
+    }
+
+    // Upper 64 bits of the product, rounded
+    static inline diy_fp mul(diy_fp const& x, diy_fp const& y)
+    {
+        boost::uint64_t const mask = 0xFFFFFFFFu;
+
+        boost::uint64_t const x_lo = x.f & mask;
+        boost::uint64_t const x_hi = x.f >> 32;
+        boost::uint64_t const y_lo = y.f & mask;
+        boost::uint64_t const y_hi = y.f >> 32;
+
+        boost::uint64_t const p0 = x_lo * y_lo;
+        boost::uint64_t const p1 = x_lo * y_hi;
+        boost::uint64_t const p2 = x_hi * y_lo;
+        boost::uint64_t const p3 = x_hi * y_hi;
+
+        boost::uint64_t q = (p0 >> 32) + (p1 & mask) + (p2 & mask);
+        q += boost::uint64_t(1) << 31;
+
+        return diy_fp(p3 + (p1 >> 32) + (p2 >> 32) + (q >> 32), x.e + y.e + 64);
+    }
+
+    static inline diy_fp normalize(diy_fp x)
+    {
+        while ((x.f >> 63) == 0)
+        {
+            x.f <<= 1;
+            x.e--;
+        }
+        return x;
+    }
+
+    static inline diy_fp normalize_to(diy_fp const& x, int e)
+    {
+        return diy_fp(x.f << (x.e - e), e);
+    }
+};
+
+// Bits of the IEEE representation of float and double
+template <typename T>
+struct ieee_traits
+{
+    static const bool enabled = false;
+};
+
+template <>
+struct ieee_traits<float>
+{
+    static const bool enabled = std::numeric_limits<float>::is_iec559;
+    typedef boost::uint32_t bits_type;
+};
+
+template <>
+struct ieee_traits<double>
+{
+    static const bool enabled = std::numeric_limits<double>::is_iec559;
+    typedef boost::uint64_t bits_type;
+};
+
+// The value v and the boundaries m- and m+ of the interval of the numbers
+// rounding to v, m- and m+ normalized to the same exponent
+struct boundaries
+{
+    template <typename T>
+    inline explicit boundaries(T value)
+        : v(0, 0), minus(0, 0), plus(0, 0)
+    {
+        typedef typename ieee_traits<T>::bits_type bits_type;
+
+        int const precision = std::numeric_limits<T>::digits;
+        int const bias = std::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+        boost::uint64_t const hidden_bit = boost::uint64_t(1) << (precision - 1);
+
+        bits_type bits;
+        std::memcpy(&bits, &value, sizeof(T));
+
+        boost::uint64_t const e = boost::uint64_t(bits) >> (precision - 1);
+        boost::uint64_t const f = boost::uint64_t(bits) & (hidden_bit - 1);
+
+        v = e == 0
+          ? diy_fp(f, 1 - bias)
+          : diy_fp(f + hidden_bit, int(e) - bias);
+
+        // The lower boundary is closer if v is a power of two
+        bool const lower_is_closer = f == 0 && e > 1;
+        plus = diy_fp::normalize(diy_fp(2 * v.f + 1, v.e - 1));
+        minus = diy_fp::normalize_to(lower_is_closer
+                                     ? diy_fp(4 * v.f - 1, v.e - 2)
+                                     : diy_fp(2 * v.f - 1, v.e - 1),
+                                     plus.e);
+        v = diy_fp::normalize(v);
+    }
+
+    diy_fp v;
+    diy_fp minus;
+    diy_fp plus;
+};
+
+struct cached_power
+{
+    boost::uint64_t f;
+    int e;
+    int k;
+};
+
+// Normalized 10^k for k = -300, -292, ..., 340
+inline cached_power const& get_cached_power(int e)
+{
+    static cached_power const powers[] =
+    {
+        { UINT64_C(0xAB70FE17C79AC6CA), -1060, -300 },
+        { UINT64_C(0xFF77B1FCBEBCDC4F), -1034, -292 },
+        { UINT64_C(0xBE5691EF416BD60C), -1007, -284 },
+        { UINT64_C(0x8DD01FAD907FFC3C),  -980, -276 },
+        { UINT64_C(0xD3515C2831559A83),  -954, -268 },
+        { UINT64_C(0x9D71AC8FADA6C9B5),  -927, -260 },
+        { UINT64_C(0xEA9C227723EE8BCB),  -901, -252 },
+        { UINT64_C(0xAECC49914078536D),  -874, -244 },
+        { UINT64_C(0x823C12795DB6CE57),  -847, -236 },
+        { UINT64_C(0xC21094364DFB5637),  -821, -228 },
+        { UINT64_C(0x9096EA6F3848984F),  -794, -220 },
+        { UINT64_C(0xD77485CB25823AC7),  -768, -212 },
+        { UINT64_C(0xA086CFCD97BF97F4),  -741, -204 },
+        { UINT64_C(0xEF340A98172AACE5),  -715, -196 },
+        { UINT64_C(0xB23867FB2A35B28E),  -688, -188 },
+        { UINT64_C(0x84C8D4DFD2C63F3B),  -661, -180 },
+        { UINT64_C(0xC5DD44271AD3CDBA),  -635, -172 },
+        { UINT64_C(0x936B9FCEBB25C996),  -608, -164 },
+        { UINT64_C(0xDBAC6C247D62A584),  -582, -156 },
+        { UINT64_C(0xA3AB66580D5FDAF6),  -555, -148 },
+        { UINT64_C(0xF3E2F893DEC3F126),  -529, -140 },
+        { UINT64_C(0xB5B5ADA8AAFF80B8),  -502, -132 },
+        { UINT64_C(0x87625F056C7C4A8B),  -475, -124 },
+        { UINT64_C(0xC9BCFF6034C13053),  -449, -116 },
+        { UINT64_C(0x964E858C91BA2655),  -422, -108 },
+        { UINT64_C(0xDFF9772470297EBD),  -396, -100 },
+        { UINT64_C(0xA6DFBD9FB8E5B88F),  -369,  -92 },
+        { UINT64_C(0xF8A95FCF88747D94),  -343,  -84 },
+        { UINT64_C(0xB94470938FA89BCF),  -316,  -76 },
+        { UINT64_C(0x8A08F0F8BF0F156B),  -289,  -68 },
+        { UINT64_C(0xCDB02555653131B6),  -263,  -60 },
+        { UINT64_C(0x993FE2C6D07B7FAC),  -236,  -52 },
+        { UINT64_C(0xE45C10C42A2B3B06),  -210,  -44 },
+        { UINT64_C(0xAA242499697392D3),  -183,  -36 },
+        { UINT64_C(0xFD87B5F28300CA0E),  -157,  -28 },
+        { UINT64_C(0xBCE5086492111AEB),  -130,  -20 },
+        { UINT64_C(0x8CBCCC096F5088CC),  -103,  -12 },
+        { UINT64_C(0xD1B71758E219652C),   -77,   -4 },
+        { UINT64_C(0x9C40000000000000),   -50,    4 },
+        { UINT64_C(0xE8D4A51000000000),   -24,   12 },
+        { UINT64_C(0xAD78EBC5AC620000),     3,   20 },
+        { UINT64_C(0x813F3978F8940984),    30,   28 },
+        { UINT64_C(0xC097CE7BC90715B3),    56,   36 },
+        { UINT64_C(0x8F7E32CE7BEA5C70),    83,   44 },
+        { UINT64_C(0xD5D238A4ABE98068),   109,   52 },
+        { UINT64_C(0x9F4F2726179A2245),   136,   60 },
+        { UINT64_C(0xED63A231D4C4FB27),   162,   68 },
+        { UINT64_C(0xB0DE65388CC8ADA8),   189,   76 },
+        { UINT64_C(0x83C7088E1AAB65DB),   216,   84 },
+        { UINT64_C(0xC45D1DF942711D9A),   242,   92 },
+        { UINT64_C(0x924D692CA61BE758),   269,  100 },
+        { UINT64_C(0xDA01EE641A708DEA),   295,  108 },
+        { UINT64_C(0xA26DA3999AEF774A),   322,  116 },
+        { UINT64_C(0xF209787BB47D6B85),   348,  124 },
+        { UINT64_C(0xB454E4A179DD1877),   375,  132 },
+        { UINT64_C(0x865B86925B9BC5C2),   402,  140 },
+        { UINT64_C(0xC83553C5C8965D3D),   428,  148 },
+        { UINT64_C(0x952AB45CFA97A0B3),   455,  156 },
+        { UINT64_C(0xDE469FBD99A05FE3),   481,  164 },
+        { UINT64_C(0xA59BC234DB398C25),   508,  172 },
+        { UINT64_C(0xF6C69A72A3989F5C),   534,  180 },
+        { UINT64_C(0xB7DCBF5354E9BECE),   561,  188 },
+        { UINT64_C(0x88FCF317F22241E2),   588,  196 },
+        { UINT64_C(0xCC20CE9BD35C78A5),   614,  204 },
+        { UINT64_C(0x98165AF37B2153DF),   641,  212 },
+        { UINT64_C(0xE2A0B5DC971F303A),   667,  220 },
+        { UINT64_C(0xA8D9D1535CE3B396),   694,  228 },
+        { UINT64_C(0xFB9B7CD9A4A7443C),   720,  236 },
+        { UINT64_C(0xBB764C4CA7A44410),   747,  244 },
+        { UINT64_C(0x8BAB8EEFB6409C1A),   774,  252 },
+        { UINT64_C(0xD01FEF10A657842C),   800,  260 },
+        { UINT64_C(0x9B10A4E5E9913129),   827,  268 },
+        { UINT64_C(0xE7109BFBA19C0C9D),   853,  276 },
+        { UINT64_C(0xAC2820D9623BF429),   880,  284 },
+        { UINT64_C(0x80444B5E7AA7CF85),   907,  292 },
+        { UINT64_C(0xBF21E44003ACDD2D),   933,  300 },
+        { UINT64_C(0x8E679C2F5E44FF8F),   960,  308 },
+        { UINT64_C(0xD433179D9C8CB841),   986,  316 },
+        { UINT64_C(0x9E19DB92B4E31BA9),  1013,  324 },
+        { UINT64_C(0xEB96BF6EBADF77D9),  1039,  332 },
+        { UINT64_C(0xAF87023B9BF0EE6B),  1066,  340 }    };
+
+    // The scaled value has an exponent in [alpha, gamma]: the integral
+    // part of the digits fits into 32 bits
+    int const alpha = -60;
+    int const min_k = -300;
+    int const step = 8;
+
+    // ceil(log10(2^(alpha - e - 1)))
+    int const x = alpha - e - 1;
+    int const k = (x * 78913) / (1 << 18) + (x > 0 ? 1 : 0);
+    return powers[(k - min_k + step - 1) / step];
+}
+
+inline int largest_power_of_ten(boost::uint32_t n, boost::uint32_t& power)
+{
+    static boost::uint32_t const powers[] =
+    {
+        1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u,
+        100000000u, 1000000000u
+    };
+
+    int digits = 10;
+    while (digits > 1 && n < powers[digits - 1])
+    {
+        digits--;
+    }
+    power = powers[digits - 1];
+    return digits;
+}
+
+// Moves the last digit towards the value w while the result stays in the
+// interval of the numbers rounding to w. Returns true if the result is
+// at least margin away from the boundaries of the interval.
+inline bool round_last_digit(char* digits, int length,
+                             boost::uint64_t distance, boost::uint64_t delta,
+                             boost::uint64_t rest, boost::uint64_t ten_k,
+                             boost::uint64_t margin)
+{
+    while (rest < distance
+        && delta - rest >= ten_k
+        && (rest + ten_k < distance || distance - rest > rest + ten_k - distance))
+    {
+        digits[length - 1]--;
+        rest += ten_k;
+    }
+    return margin <= rest && rest <= delta - margin;
+}
+
+// Generates the digits of a number in [m_minus, m_plus] as close as
+// possible to w, digits * 10^exponent. Returns true if the number is at
+// least margin away from m_minus and m_plus.
+inline bool generate_digits(char* digits, int& length, int& exponent,
+                            diy_fp const& m_minus, diy_fp const& w,
+                            diy_fp const& m_plus, boost::uint64_t margin = 0)
+{
+    boost::uint64_t delta = diy_fp::sub(m_plus, m_minus).f;
+    boost::uint64_t distance = diy_fp::sub(m_plus, w).f;
+
+    diy_fp const one(boost::uint64_t(1) << -m_plus.e, m_plus.e);
+
+    boost::uint32_t p1 = boost::uint32_t(m_plus.f >> -one.e);
+    boost::uint64_t p2 = m_plus.f & (one.f - 1);
+
+    boost::uint32_t power = 0;
+    int n = largest_power_of_ten(p1, power);
+    while (n > 0)
+    {
+        boost::uint32_t const d = p1 / power;
+        p1 %= power;
+        digits[length++] = char('0' + d);
+        n--;
+
+        boost::uint64_t const rest = (boost::uint64_t(p1) << -one.e) + p2;
+        if (rest <= delta)
+        {
+            exponent += n;
+            return round_last_digit(digits, length, distance, delta, rest,
+                                    boost::uint64_t(power) << -one.e, margin);
+        }
+        power /= 10;
+    }
+
+    int m = 0;
+    for (;;)
+    {
+        p2 *= 10;
+        digits[length++] = char('0' + (p2 >> -one.e));
+        p2 &= one.f - 1;
+        m++;
+
+        delta *= 10;
+        distance *= 10;
+        margin *= 10;
+        if (p2 <= delta)
+        {
+            break;
+        }
+    }
+    exponent -= m;
+    return round_last_digit(digits, length, distance, delta, p2, one.f, margin);
+}
+
+// Digits of the shortest representation of a positive finite value which
+// is read back as the value, with at least min_length and less than
+// length digits, if there is one. It is the correctly rounded one.
+template <typename T>
+inline void shortest_digits(T value, char* digits, int& length, int& exponent,
+                            int min_length)
+{
+    for (int precision = min_length; precision < length; precision++)
+    {
+        std::ostringstream out;
+        out.imbue(std::locale::classic());
+        out << std::scientific;
+        out.precision(precision - 1);
+        out << value;
+        std::string const str = out.str();
+
+        std::istringstream in(str);
+        in.imbue(std::locale::classic());
+        T read = 0;
+        if (! (in >> read) || read != value)
+        {
+            continue;
+        }
+
+        // d.ddde+x -> ddd * 10^(x - precision + 1)
+        std::string::size_type const e = str.find('e');
+        length = 0;
+        for (std::string::size_type i = 0; i < e; i++)
+        {
+            if (str[i] != '.')
+            {
+                digits[length++] = str[i];
+            }
+        }
+        exponent = std::atoi(str.c_str() + e + 1) - precision + 1;
+        return;
+    }
+}
+
+// Shortest digits of a positive finite value, value = digits * 10^exponent
+template <typename T>
+inline void grisu2(T value, char* digits, int& length, int& exponent)
+{
+    boundaries const b(value);
+
+    cached_power const& cached = get_cached_power(b.plus.e);
+    diy_fp const c(cached.f, cached.e);
+
+    diy_fp const w = diy_fp::mul(b.v, c);
+    diy_fp const w_minus = diy_fp::mul(b.minus, c);
+    diy_fp const w_plus = diy_fp::mul(b.plus, c);
+
+    // The products are rounded. The interval of the numbers rounding to the
+    // value contains the safe interval and is contained by the unsafe one.
+    // The digits of the unsafe interval are the shortest ones if they are
+    // in the safe interval as well, which is the case for nearly all values.
+    diy_fp const unsafe_minus(w_minus.f - 1, w_minus.e);
+    diy_fp const unsafe_plus(w_plus.f + 1, w_plus.e);
+
+    length = 0;
+    exponent = -cached.k;
+    if (generate_digits(digits, length, exponent,
+                        unsafe_minus, w, unsafe_plus, 2))
+    {
+        return;
+    }
+
+    // Otherwise the digits of the safe interval are correct, and a shorter
+    // representation can only exist if the unsafe digits are shorter
+    int const unsafe_length = length;
+    length = 0;
+    exponent = -cached.k;
+    generate_digits(digits, length, exponent,
+                    diy_fp(w_minus.f + 1, w_minus.e), w,
+                    diy_fp(w_plus.f - 1, w_plus.e));
+    if (unsafe_length < length)
+    {
+        shortest_digits(value, digits, length, exponent, unsafe_length);
+    }
+}
+
+// Writes digits * 10^exponent, in fixed notation if the decimal point is
+// at most 21 digits behind or 6 digits before the first digit
+inline char* format_decimal(char* it, char const* digits, int length, int exponent)
+{
+    int const point = length + exponent;
+
+    if (length <= point && point <= 21)
+    {
+        // 1234e2 -> 123400
+        std::memcpy(it, digits, length);
+        std::memset(it + length, '0', point - length);
+        return it + point;
+    }
+    if (0 < point && point <= 21)
+    {
+        // 1234e-2 -> 12.34
+        std::memcpy(it, digits, point);
+        it[point] = '.';
+        std::memcpy(it + point + 1, digits + point, length - point);
+        return it + length + 1;
+    }
+    if (-6 < point && point <= 0)
+    {
+        // 1234e-6 -> 0.001234
+        *it++ = '0';
+        *it++ = '.';
+        std::memset(it, '0', -point);
+        std::memcpy(it - point, digits, length);
+        return it - point + length;
+    }
+
+    // 1234e-30 -> 1.234e-27
+    *it++ = digits[0];
+    if (length > 1)
+    {
+        *it++ = '.';
+        std::memcpy(it, digits + 1, length - 1);
+        it += length - 1;
+    }
+    *it++ = 'e';
+    int e = point - 1;
+    *it++ = e < 0 ? '-' : '+';
+    e = e < 0 ? -e : e;
+    if (e >= 100)
+    {
+        *it++ = char('0' + e / 100);
+        e %= 100;
+        *it++ = char('0' + e / 10);
+    }
+    else if (e >= 10)
+    {
+        *it++ = char('0' + e / 10);
+    }
+    *it++ = char('0' + e % 10);
+    return it;
+}
+
+
+/*!
+\brief Internal, appends the text of a coordinate to an output
+\details Float and double are written with the shortest representation
+    which is read back as the same value, integers are written directly,
+    both independent of locales and of stream settings. Other types are
+    streamed with the classic locale and enough precision.
+\note The output has a member function append(char const*, char const*)
+*/
+template
+<
+    typename T,
+    bool IsFloat = ieee_traits<T>::enabled,
+    bool IsIntegral = boost::is_integral<T>::value
+                   && ! boost::is_same<T, bool>::value
+>
+struct coordinate_formatter
+{
+    template <typename Output>
+    static inline void apply(T const& value, Output& output)
+    {
+        std::ostringstream out;
+        out.imbue(std::locale::classic());
+        if (std::numeric_limits<T>::is_specialized)
+        {
+            out.precision(std::numeric_limits<T>::digits10 + 3);
+        }
+        out << value;
+
+        std::string const str = out.str();
+        output.append(str.data(), str.data() + str.size());
+    }
+};
+
+template <typename T>
+struct coordinate_formatter<T, true, false>
+{
+    // Sign, 17 digits, point, exponent
+    static const int max_length = 32;
+
+    template <typename Output>
+    static inline void apply(T value, Output& output)
+    {
+        char buffer[max_length];
+        output.append(buffer, format(value, buffer));
+    }
+
+    static inline char* format(T value, char* it)
+    {
+        if (value != value)
+        {
+            return copy("nan", it);
+        }
+
+        if (value < 0 || (value == 0 && is_negative_zero(value)))
+        {
+            *it++ = '-';
+            value = -value;
+        }
+
+        if (value == 0)
+        {
+            *it++ = '0';
+            return it;
+        }
+        if (value > (std::numeric_limits<T>::max)())
+        {
+            return copy("inf", it);
+        }
+
+        char digits[max_length];
+        int length = 0;
+        int exponent = 0;
+        grisu2(value, digits, length, exponent);
+        return format_decimal(it, digits, length, exponent);
+    }
+
+private:
+    static inline bool is_negative_zero(T value)
+    {
+        typename ieee_traits<T>::bits_type bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        return bits != 0;
+    }
+
+    static inline char* copy(char const* str, char* it)
+    {
+        std::size_t const length = std::strlen(str);
+        std::memcpy(it, str, length);
+        return it + length;
+    }
+};
+
+template <typename T>
+struct coordinate_formatter<T, false, true>
+{
+    template <typename Output>
+    static inline void apply(T value, Output& output)
+    {
+        char buffer[24];
+        char* const end = buffer + sizeof(buffer);
+        char* it = end;
+
+        bool const negative = value < T(0);
+        // The negative minimum is representable as unsigned
+        boost::uint64_t n = negative
+                          ? boost::uint64_t(0) - boost::uint64_t(value)
+                          : boost::uint64_t(value);
+        do
+        {
+            *--it = char('0' + n % 10);
+            n /= 10;
+        }
+        while (n != 0);
+
+        if (negative)
+        {
+            *--it = '-';
+        }
+        output.append(it, end);
+    }
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_FORMATTER_HPP
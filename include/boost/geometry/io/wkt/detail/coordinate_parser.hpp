@@ -0,0 +1,262 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_PARSER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_PARSER_HPP
+
+#include <limits>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
+#include <boost/geometry/util/coordinate_cast.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+// Conversion of the numbers not handled by the fast paths below. It throws
+// boost::bad_lexical_cast for invalid numbers, like reading coordinates
+// always did
+template <typename T>
+inline T cast_coordinate(string_range const& token)
+{
+#if defined(BOOST_GEOMETRY_NO_LEXICAL_CAST)
+    return coordinate_cast<T>::apply(std::string(token.begin(), token.end()));
+#else
+    return boost::lexical_cast<T>(token.begin(), token.size());
+#endif
+}
+
+
+// Decimal number with at most 19 significant digits, split into an integer
+// mantissa and a power of ten
+struct decimal_number
+{
+    boost::uint64_t mantissa;
+    int exponent;
+    bool negative;
+
+    // Parses [+-]digits[.digits][(e|E)[+-]digits], false if the token
+    // is something else or has more significant digits
+    inline bool parse(string_range const& token)
+    {
+        static int const max_digits = 19;
+        static int const max_exponent = 100000;
+
+        char const* it = token.begin();
+        char const* const end = token.end();
+
+        mantissa = 0;
+        exponent = 0;
+        negative = false;
+
+        if (it != end && (*it == '-' || *it == '+'))
+        {
+            negative = *it == '-';
+            ++it;
+        }
+
+        int digits = 0;
+        bool has_digits = false;
+        for ( ; it != end && is_digit(*it); ++it)
+        {
+            has_digits = true;
+            if (! add_digit(*it, digits, max_digits))
+            {
+                return false;
+            }
+        }
+        if (it != end && *it == '.')
+        {
+            for (++it; it != end && is_digit(*it); ++it)
+            {
+                has_digits = true;
+                if (! add_digit(*it, digits, max_digits))
+                {
+                    return false;
+                }
+                exponent--;
+            }
+        }
+        if (! has_digits)
+        {
+            return false;
+        }
+
+        if (it != end && (*it == 'e' || *it == 'E'))
+        {
+            ++it;
+            bool negative_exponent = false;
+            if (it != end && (*it == '-' || *it == '+'))
+            {
+                negative_exponent = *it == '-';
+                ++it;
+            }
+            if (it == end)
+            {
+                return false;
+            }
+            int e = 0;
+            for ( ; it != end && is_digit(*it); ++it)
+            {
+                if (e < max_exponent)
+                {
+                    e = e * 10 + (*it - '0');
+                }
+            }
+            exponent += negative_exponent ? -e : e;
+        }
+
+        return it == end;
+    }
+
+private:
+    static inline bool is_digit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    inline bool add_digit(char c, int& digits, int max_digits)
+    {
+        if (mantissa == 0 && c == '0')
+        {
+            // leading zeros are not significant
+            return true;
+        }
+        if (++digits > max_digits)
+        {
+            return false;
+        }
+        mantissa = mantissa * 10 + boost::uint64_t(c - '0');
+        return true;
+    }
+};
+
+
+// Floating point types for which the result of one multiplication or
+// division of the mantissa by a power of ten is correctly rounded, if both
+// are exactly representable (Clinger's fast path)
+template <typename T>
+struct fast_path_float
+{
+    static const bool enabled = false;
+};
+
+template <>
+struct fast_path_float<float>
+{
+    static const bool enabled = true;
+    static const int max_exponent = 10;
+    static inline boost::uint64_t max_mantissa() { return boost::uint64_t(1) << 24; }
+};
+
+template <>
+struct fast_path_float<double>
+{
+    static const bool enabled = true;
+    static const int max_exponent = 22;
+    static inline boost::uint64_t max_mantissa() { return boost::uint64_t(1) << 53; }
+};
+
+inline double exact_power_of_ten(int exponent)
+{
+    static double const powers[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    return powers[exponent];
+}
+
+
+/*!
+\brief Internal, converts a token to a coordinate
+\details Decimal numbers are converted to float and double directly if the
+    result is exact, and integers to integral types, other numbers and
+    other types are converted as before, with lexical_cast or with
+    coordinate_cast.
+*/
+template
+<
+    typename T,
+    bool IsFloat = fast_path_float<T>::enabled,
+    bool IsIntegral = boost::is_integral<T>::value
+                   && ! boost::is_same<T, bool>::value
+>
+struct coordinate_parser
+{
+    static inline T apply(string_range const& token)
+    {
+        return coordinate_cast<T>::apply(std::string(token.begin(), token.end()));
+    }
+};
+
+template <typename T>
+struct coordinate_parser<T, true, false>
+{
+    static inline T apply(string_range const& token)
+    {
+        typedef fast_path_float<T> traits_type;
+
+        decimal_number number;
+        if (number.parse(token)
+            && number.mantissa <= traits_type::max_mantissa()
+            && number.exponent >= -traits_type::max_exponent
+            && number.exponent <= traits_type::max_exponent)
+        {
+            T result = T(number.mantissa);
+            if (number.exponent > 0)
+            {
+                result *= T(exact_power_of_ten(number.exponent));
+            }
+            else if (number.exponent < 0)
+            {
+                result /= T(exact_power_of_ten(-number.exponent));
+            }
+            return number.negative ? -result : result;
+        }
+
+        return cast_coordinate<T>(token);
+    }
+};
+
+template <typename T>
+struct coordinate_parser<T, false, true>
+{
+    static inline T apply(string_range const& token)
+    {
+        decimal_number number;
+        if (number.parse(token)
+            && number.exponent == 0
+            && (! number.negative || std::numeric_limits<T>::is_signed)
+            && number.mantissa <= boost::uint64_t((std::numeric_limits<T>::max)()))
+        {
+            T const result = T(number.mantissa);
+            return number.negative ? T(-result) : result;
+        }
+
+        return cast_coordinate<T>(token);
+    }
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_PARSER_HPP
@@ -0,0 +1,210 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+/*!
+\brief Internal, range of characters of a WKT string or of one of its
+    tokens. The characters are not copied.
+*/
+class string_range
+{
+public:
+    typedef char value_type;
+    typedef char const* iterator;
+    typedef char const* const_iterator;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    inline string_range()
+        : m_first(0), m_last(0)
+    {}
+
+    inline string_range(char const* first, char const* last)
+        : m_first(first), m_last(last)
+    {}
+
+    inline string_range(char const* str)
+        : m_first(str), m_last(str + std::strlen(str))
+    {}
+
+    inline string_range(std::string const& str)
+        : m_first(str.data()), m_last(str.data() + str.size())
+    {}
+
+    inline const_iterator begin() const { return m_first; }
+    inline const_iterator end() const { return m_last; }
+    inline size_type size() const { return size_type(m_last - m_first); }
+    inline bool empty() const { return m_first == m_last; }
+
+    // Used only to report errors
+    inline operator std::string() const
+    {
+        return std::string(m_first, m_last);
+    }
+
+    inline bool operator==(char const* str) const
+    {
+        char const* it = m_first;
+        for ( ; it != m_last; ++it, ++str)
+        {
+            if (*str != *it)
+            {
+                return false;
+            }
+        }
+        return *str == '\0';
+    }
+
+    inline bool operator!=(char const* str) const
+    {
+        return ! operator==(str);
+    }
+
+private:
+    char const* m_first;
+    char const* m_last;
+};
+
+
+/*!
+\brief Internal, splits WKT into tokens in one pass without allocations
+\details Whitespaces separate tokens and are dropped, ',', '(' and ')'
+    are tokens on their own. Tokens are ranges of characters of the input.
+*/
+class tokenizer
+{
+public:
+    class iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef string_range value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef string_range const* pointer;
+        typedef string_range const& reference;
+
+        inline iterator()
+            : m_last(0)
+        {}
+
+        inline iterator(char const* first, char const* last)
+            : m_token(first, first)
+            , m_last(last)
+        {
+            next();
+        }
+
+        inline reference operator*() const { return m_token; }
+        inline pointer operator->() const { return &m_token; }
+
+        inline iterator& operator++()
+        {
+            next();
+            return *this;
+        }
+
+        inline iterator operator++(int)
+        {
+            iterator result = *this;
+            next();
+            return result;
+        }
+
+        inline bool operator==(iterator const& other) const
+        {
+            return m_token.begin() == other.m_token.begin();
+        }
+
+        inline bool operator!=(iterator const& other) const
+        {
+            return m_token.begin() != other.m_token.begin();
+        }
+
+    private:
+        static inline bool is_space(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r'
+                || c == '\v' || c == '\f';
+        }
+
+        static inline bool is_delimiter(char c)
+        {
+            return c == ',' || c == '(' || c == ')';
+        }
+
+        inline void next()
+        {
+            char const* it = m_token.end();
+            while (it != m_last && is_space(*it))
+            {
+                ++it;
+            }
+
+            char const* const first = it;
+            if (it != m_last)
+            {
+                if (is_delimiter(*it))
+                {
+                    ++it;
+                }
+                else
+                {
+                    while (it != m_last && ! is_space(*it) && ! is_delimiter(*it))
+                    {
+                        ++it;
+                    }
+                }
+            }
+
+            m_token = string_range(first, it);
+        }
+
+        string_range m_token;
+        char const* m_last;
+    };
+
+    explicit inline tokenizer(string_range const& wkt)
+        : m_wkt(wkt)
+    {}
+
+    inline iterator begin() const
+    {
+        return iterator(m_wkt.begin(), m_wkt.end());
+    }
+
+    inline iterator end() const
+    {
+        return iterator(m_wkt.end(), m_wkt.end());
+    }
+
+private:
+    string_range m_wkt;
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
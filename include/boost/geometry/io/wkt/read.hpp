@@ -24,7 +24,6 @@
 #include <string>
 
 #include <boost/lexical_cast.hpp>
-#include <boost/tokenizer.hpp>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/mpl/if.hpp>
@@ -54,9 +53,11 @@
 
 #include <boost/geometry/geometries/concepts/check.hpp>
 
-#include <boost/geometry/util/coordinate_cast.hpp>
-
+#include <boost/geometry/io/wkt/detail/coordinate_parser.hpp>
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
+
+#include <boost/geometry/util/range.hpp>
 
 namespace boost { namespace geometry
 {
@@ -78,7 +79,7 @@ struct read_wkt_exception : public geometry::exception
         if (it != end)
         {
             source = " at '";
-            source += it->c_str();
+            source.append(it->begin(), it->end());
             source += "'";
         }
         complete = message + source + " in '" + wkt.substr(0, 100) + "'";
@@ -110,8 +111,6 @@ private :
 namespace detail { namespace wkt
 {
 
-typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
-
 template <typename Point,
           std::size_t Dimension = 0,
           std::size_t DimensionCount = geometry::dimension<Point>::value>
@@ -120,7 +119,7 @@ struct parsing_assigner
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
                              Point& point,
-                             std::string const& wkt)
+                             string_range const& wkt)
     {
         typedef typename coordinate_type<Point>::type coordinate_type;
 
@@ -131,13 +130,11 @@ struct parsing_assigner
         {
             // Initialize missing coordinates to default constructor (zero)
             // OR
-            // Use lexical_cast for conversion to double/int
-            // Note that it is much slower than atof. However, it is more standard
-            // and in parsing the change in performance falls probably away against
-            // the tokenizing
+            // Convert the token, numbers not handled directly are converted
+            // with lexical_cast
             set<Dimension>(point, finished
                     ? coordinate_type()
-                    : coordinate_cast<coordinate_type>::apply(*it));
+                    : coordinate_parser<coordinate_type>::apply(*it));
         }
         catch(boost::bad_lexical_cast const& blc)
         {
@@ -163,7 +160,7 @@ struct parsing_assigner<Point, DimensionCount, DimensionCount>
     static inline void apply(tokenizer::iterator&,
                              tokenizer::iterator const&,
                              Point&,
-                             std::string const&)
+                             string_range const&)
     {
     }
 };
@@ -173,7 +170,7 @@ struct parsing_assigner<Point, DimensionCount, DimensionCount>
 template <typename Iterator>
 inline void handle_open_parenthesis(Iterator& it,
                                     Iterator const& end,
-                                    std::string const& wkt)
+                                    string_range const& wkt)
 {
     if (it == end || *it != "(")
     {
@@ -186,7 +183,7 @@ inline void handle_open_parenthesis(Iterator& it,
 template <typename Iterator>
 inline void handle_close_parenthesis(Iterator& it,
                                      Iterator const& end,
-                                     std::string const& wkt)
+                                     string_range const& wkt)
 {
     if (it != end && *it == ")")
     {
@@ -201,7 +198,7 @@ inline void handle_close_parenthesis(Iterator& it,
 template <typename Iterator>
 inline void check_end(Iterator& it,
                       Iterator const& end,
-                      std::string const& wkt)
+                      string_range const& wkt)
 {
     if (it != end)
     {
@@ -222,7 +219,7 @@ struct container_inserter
     template <typename OutputIterator>
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             string_range const& wkt,
                              OutputIterator out)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -329,7 +326,7 @@ struct container_appender
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             string_range const& wkt,
                              Geometry out)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -366,7 +363,7 @@ struct point_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             string_range const& wkt,
                              P& point)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -381,7 +378,7 @@ struct linestring_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             string_range const& wkt,
                              Geometry& geometry)
     {
         container_appender<Geometry&>::apply(it, end, wkt, geometry);
@@ -394,7 +391,7 @@ struct ring_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             string_range const& wkt,
                              Ring& ring)
     {
         // A ring should look like polygon((x y,x y,x y...))
@@ -419,7 +416,7 @@ struct polygon_parser
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             string_range const& wkt,
                              Polygon& poly)
     {
 
@@ -437,15 +434,16 @@ struct polygon_parser
             }
             else
             {
-                typename ring_type<Polygon>::type ring;
-                appender::apply(it, end, wkt, ring);
-                traits::push_back
+                // Parse into the ring added to the polygon
+                typedef typename boost::remove_reference
                     <
-                        typename boost::remove_reference
-                        <
-                            typename traits::interior_mutable_type<Polygon>::type
-                        >::type
-                    >::apply(interior_rings(poly), ring);
+                        typename traits::interior_mutable_type<Polygon>::type
+                    >::type interior_type;
+
+                traits::push_back<interior_type>::apply(interior_rings(poly),
+                    typename ring_type<Polygon>::type());
+                appender::apply(it, end, wkt,
+                    range::back(interior_rings(poly)));
             }
 
             if (it != end && *it == ",")
@@ -522,7 +520,7 @@ inline void handle_empty_z_m(tokenizer::iterator& it,
 template <typename Geometry>
 inline bool initialize(tokenizer const& tokens,
                        std::string const& geometry_name,
-                       std::string const& wkt,
+                       string_range const& wkt,
                        tokenizer::iterator& it,
                        tokenizer::iterator& end)
 {
@@ -567,11 +565,11 @@ inline bool initialize(tokenizer const& tokens,
 template <typename Geometry, template<typename> class Parser, typename PrefixPolicy>
 struct geometry_parser
 {
-    static inline void apply(std::string const& wkt, Geometry& geometry)
+    static inline void apply(string_range const& wkt, Geometry& geometry)
     {
         geometry::clear(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
         if (initialize<Geometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
         {
@@ -585,11 +583,11 @@ struct geometry_parser
 template <typename MultiGeometry, template<typename> class Parser, typename PrefixPolicy>
 struct multi_parser
 {
-    static inline void apply(std::string const& wkt, MultiGeometry& geometry)
+    static inline void apply(string_range const& wkt, MultiGeometry& geometry)
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
         if (initialize<MultiGeometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
         {
@@ -622,7 +620,7 @@ struct noparenthesis_point_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             string_range const& wkt,
                              P& point)
     {
         parsing_assigner<P>::apply(it, end, point, wkt);
@@ -632,11 +630,11 @@ struct noparenthesis_point_parser
 template <typename MultiGeometry, typename PrefixPolicy>
 struct multi_point_parser
 {
-    static inline void apply(std::string const& wkt, MultiGeometry& geometry)
+    static inline void apply(string_range const& wkt, MultiGeometry& geometry)
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
 
         if (initialize<MultiGeometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
@@ -692,10 +690,10 @@ struct multi_point_parser
 template <typename Box>
 struct box_parser
 {
-    static inline void apply(std::string const& wkt, Box& box)
+    static inline void apply(string_range const& wkt, Box& box)
     {
         bool should_close = false;
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
         if (it != end && boost::iequals(*it, "POLYGON"))
@@ -762,9 +760,9 @@ struct box_parser
 template <typename Segment>
 struct segment_parser
 {
-    static inline void apply(std::string const& wkt, Segment& segment)
+    static inline void apply(string_range const& wkt, Segment& segment)
     {
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
         if (it != end &&
@@ -910,7 +908,31 @@ template <typename Geometry>
 inline void read_wkt(std::string const& wkt, Geometry& geometry)
 {
     geometry::concepts::check<Geometry>();
-    dispatch::read_wkt<typename tag<Geometry>::type, Geometry>::apply(wkt, geometry);
+    dispatch::read_wkt
+        <
+            typename tag<Geometry>::type, Geometry
+        >::apply(detail::wkt::string_range(wkt), geometry);
+}
+
+/*!
+\brief Parses OGC Well-Known Text (\ref WKT) into a geometry (any geometry)
+\details The characters are parsed where they are, e.g. in a memory mapped
+    file or in a larger buffer, without copying them into a string.
+\ingroup wkt
+\tparam Geometry \tparam_geometry
+\param first pointer to the first character of the \ref WKT
+\param last pointer past the last character of the \ref WKT
+\param geometry \param_geometry output geometry
+\ingroup wkt
+*/
+template <typename Geometry>
+inline void read_wkt(char const* first, char const* last, Geometry& geometry)
+{
+    geometry::concepts::check<Geometry>();
+    dispatch::read_wkt
+        <
+            typename tag<Geometry>::type, Geometry
+        >::apply(detail::wkt::string_range(first, last), geometry);
 }
 
 }} // namespace boost::geometry
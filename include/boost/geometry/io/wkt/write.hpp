@@ -21,11 +21,14 @@
 #ifndef BOOST_GEOMETRY_IO_WKT_WRITE_HPP
 #define BOOST_GEOMETRY_IO_WKT_WRITE_HPP
 
+#include <cstddef>
+#include <cstring>
 #include <ostream>
 #include <string>
 
 #include <boost/array.hpp>
 #include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 #include <boost/variant/apply_visitor.hpp>
 #include <boost/variant/static_visitor.hpp>
@@ -39,11 +42,13 @@
 #include <boost/geometry/core/exterior_ring.hpp>
 #include <boost/geometry/core/interior_rings.hpp>
 #include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
 
 #include <boost/geometry/geometries/concepts/check.hpp>
 #include <boost/geometry/geometries/ring.hpp>
 
+#include <boost/geometry/io/wkt/detail/coordinate_formatter.hpp>
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
 
 #include <boost/geometry/util/condition.hpp>
@@ -62,11 +67,92 @@ namespace boost { namespace geometry
 namespace detail { namespace wkt
 {
 
+// Appends characters to a container, e.g. std::string or std::vector<char>
+template <typename Container>
+struct container_sink
+{
+    explicit container_sink(Container& container)
+        : m_container(container)
+    {}
+
+    inline void append(char const* first, char const* last)
+    {
+        m_container.insert(m_container.end(), first, last);
+    }
+
+private:
+    Container& m_container;
+};
+
+// Writes characters into a buffer of a fixed size, the characters which
+// do not fit are counted only
+struct buffer_sink
+{
+    buffer_sink(char* buffer, std::size_t size)
+        : m_it(buffer)
+        , m_end(buffer + size)
+        , m_count(0)
+    {}
+
+    inline void append(char const* first, char const* last)
+    {
+        std::size_t const length = std::size_t(last - first);
+        std::size_t const room = std::size_t(m_end - m_it);
+        std::size_t const n = length < room ? length : room;
+        std::memcpy(m_it, first, n);
+        m_it += n;
+        m_count += length;
+    }
+
+    inline std::size_t count() const { return m_count; }
+
+private:
+    char* m_it;
+    char* m_end;
+    std::size_t m_count;
+};
+
+/*!
+\brief Internal, used instead of a std::ostream to write WKT into a sink,
+    coordinates are formatted without locales and without stream settings
+*/
+template <typename Sink>
+struct formatting_stream
+{
+    explicit formatting_stream(Sink& sink)
+        : m_sink(sink)
+    {}
+
+    inline formatting_stream& operator<<(char const* str)
+    {
+        m_sink.append(str, str + std::strlen(str));
+        return *this;
+    }
+
+    template <typename T>
+    inline formatting_stream& operator<<(T const& value)
+    {
+        coordinate_formatter<T>::apply(value, m_sink);
+        return *this;
+    }
+
+private:
+    Sink& m_sink;
+};
+
+template <typename Geometry>
+struct default_force_closure
+{
+    // Boost.Geometry, by default, closes polygons explictly, but not rings
+    static const bool value
+        = ! boost::is_same<typename tag<Geometry>::type, ring_tag>::value;
+};
+
 template <typename P, int I, int Count>
 struct stream_coordinate
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, P const& p)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, P const& p)
     {
         os << (I > 0 ? " " : "") << get<I>(p);
         stream_coordinate<P, I + 1, Count>::apply(os, p);
@@ -76,8 +162,8 @@ struct stream_coordinate
 template <typename P, int Count>
 struct stream_coordinate<P, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&, P const&)
+    template <typename OutputStream>
+    static inline void apply(OutputStream&, P const&)
     {}
 };
 
@@ -113,8 +199,8 @@ struct double_closing_parenthesis
 template <typename Point, typename Policy>
 struct wkt_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, Point const& p, bool)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, Point const& p, bool)
     {
         os << Policy::apply() << "(";
         stream_coordinate<Point, 0, dimension<Point>::type::value>::apply(os, p);
@@ -135,8 +221,8 @@ template
 >
 struct wkt_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Range const& range, bool force_closure = ForceClosurePossible)
     {
         typedef typename boost::range_iterator<Range const>::type iterator_type;
@@ -208,8 +294,8 @@ struct wkt_sequence
 template <typename Polygon, typename PrefixPolicy>
 struct wkt_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Polygon const& poly, bool force_closure)
     {
         typedef typename ring_type<Polygon const>::type ring;
@@ -235,8 +321,8 @@ struct wkt_poly
 template <typename Multi, typename StreamPolicy, typename PrefixPolicy>
 struct wkt_multi
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Multi const& geometry, bool force_closure)
     {
         os << PrefixPolicy::apply();
@@ -264,8 +350,8 @@ struct wkt_box
 {
     typedef typename point_type<Box>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Box const& box, bool force_closure)
     {
         // Convert to a clockwire ring, then stream.
@@ -289,8 +375,8 @@ struct wkt_box
             //assert_dimension<B, 2>();
         }
 
-        template <typename RingType, typename Char, typename Traits>
-        static inline void do_apply(std::basic_ostream<Char, Traits>& os,
+        template <typename RingType, typename OutputStream>
+        static inline void do_apply(OutputStream& os,
                     Box const& box)
         {
             RingType ring;
@@ -308,8 +394,8 @@ struct wkt_segment
 {
     typedef typename point_type<Segment>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Segment const& segment, bool)
     {
         // Convert to two points, then stream
@@ -509,14 +595,12 @@ Small example showing how to use the wkt class
 template <typename Geometry>
 class wkt_manipulator
 {
-    static const bool is_ring = boost::is_same<typename tag<Geometry>::type, ring_tag>::value;
-
 public:
 
-    // Boost.Geometry, by default, closes polygons explictly, but not rings
     // NOTE: this might change in the future!
     inline wkt_manipulator(Geometry const& g,
-                           bool force_closure = ! is_ring)
+                           bool force_closure
+                               = detail::wkt::default_force_closure<Geometry>::value)
         : m_geometry(g)
         , m_force_closure(force_closure)
     {}
@@ -551,6 +635,62 @@ inline wkt_manipulator<Geometry> wkt(Geometry const& geometry)
     return wkt_manipulator<Geometry>(geometry);
 }
 
+/*!
+\brief Writes a geometry as WKT into a container of characters
+\details The WKT is appended to the container, e.g. a std::string or a
+    std::vector<char>, which can be reused for many geometries.
+    Coordinates of type float and double are written with the shortest
+    representation which is read back as the same value, other numbers
+    are written exactly. The output does not depend on locales or on
+    stream settings.
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param buffer container of characters, the WKT is appended
+\ingroup wkt
+*/
+template <typename Geometry, typename Container>
+inline void write_wkt(Geometry const& geometry, Container& buffer)
+{
+    concepts::check<Geometry const>();
+
+    typedef detail::wkt::container_sink<Container> sink_type;
+    sink_type sink(buffer);
+    detail::wkt::formatting_stream<sink_type> os(sink);
+    dispatch::devarianted_wkt<Geometry>::apply(os, geometry,
+        detail::wkt::default_force_closure<Geometry>::value);
+}
+
+/*!
+\brief Writes a geometry as WKT into a character buffer
+\details Coordinates are written like by the function writing into a
+    container. At most size - 1 characters are written, followed by a
+    null character, like snprintf does.
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param buffer output buffer
+\param size size of the buffer
+\return the length of the WKT, the output was truncated if it is not
+    less than size
+\ingroup wkt
+*/
+template <typename Geometry>
+inline std::size_t write_wkt(Geometry const& geometry, char* buffer, std::size_t size)
+{
+    concepts::check<Geometry const>();
+
+    typedef detail::wkt::buffer_sink sink_type;
+    sink_type sink(buffer, size > 0 ? size - 1 : 0);
+    detail::wkt::formatting_stream<sink_type> os(sink);
+    dispatch::devarianted_wkt<Geometry>::apply(os, geometry,
+        detail::wkt::default_force_closure<Geometry>::value);
+
+    if (size > 0)
+    {
+        buffer[sink.count() < size ? sink.count() : size - 1] = '\0';
+    }
+    return sink.count();
+}
+
 #if defined(_MSC_VER)
 #pragma warning(pop)  
 #endif
@@ -11,6 +11,8 @@
 #ifndef BOOST_GEOMETRY_ITERATORS_DETAIL_POINT_ITERATOR_ITERATOR_TYPE_HPP
 #define BOOST_GEOMETRY_ITERATORS_DETAIL_POINT_ITERATOR_ITERATOR_TYPE_HPP
 
+#include <iterator>
+
 #include <boost/range.hpp>
 
 #include <boost/geometry/core/interior_type.hpp>
@@ -43,6 +45,18 @@ struct iterator_type
 {};
 
 
+// Reference type of the points of the inner ranges, it is not a reference
+// if the ranges create their points when they are accessed
+template <typename InnerRange>
+struct inner_reference_type
+{
+    typedef typename std::iterator_traits
+        <
+            typename iterator_type<InnerRange>::type
+        >::reference type;
+};
+
+
 
 
 template <typename Linestring>
@@ -64,6 +78,7 @@ class iterator_type<Polygon, polygon_tag>
 {
 private:
     typedef typename inner_range_type<Polygon>::type inner_range;
+    typedef typename inner_reference_type<inner_range>::type reference;
 
 public:
     typedef concatenate_iterator
@@ -78,9 +93,11 @@ public:
                     typename iterator_type<inner_range>::type,
                     typename value_type<Polygon>::type,
                     dispatch::points_begin<inner_range>,
-                    dispatch::points_end<inner_range>
+                    dispatch::points_end<inner_range>,
+                    reference
                 >,
-            typename value_type<Polygon>::type
+            typename value_type<Polygon>::type,
+            reference
         > type;
 };
 
@@ -105,7 +122,8 @@ public:
             typename iterator_type<inner_range>::type,
             typename value_type<MultiLinestring>::type,
             dispatch::points_begin<inner_range>,
-            dispatch::points_end<inner_range>
+            dispatch::points_end<inner_range>,
+            typename inner_reference_type<inner_range>::type
         > type;
 };
 
@@ -123,7 +141,8 @@ public:
             typename iterator_type<inner_range>::type,
             typename value_type<MultiPolygon>::type,
             dispatch::points_begin<inner_range>,
-            dispatch::points_end<inner_range>
+            dispatch::points_end<inner_range>,
+            typename inner_reference_type<inner_range>::type
         > type;
 };
 
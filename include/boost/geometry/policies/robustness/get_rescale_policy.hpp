@@ -22,6 +22,7 @@
 #include <cstddef>
 
 #include <boost/mpl/assert.hpp>
+#include <boost/mpl/if.hpp>
 #include <boost/type_traits/is_floating_point.hpp>
 #include <boost/type_traits/is_same.hpp>
 
@@ -42,6 +43,8 @@
 #include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
 #include <boost/geometry/policies/robustness/rescale_policy.hpp>
 
+#include <boost/geometry/strategies/intersection.hpp>
+
 #include <boost/geometry/util/promote_floating_point.hpp>
 
 namespace boost { namespace geometry
@@ -353,6 +356,39 @@ struct rescale_overlay_policy_type<Geometry1, Geometry2, CSTag, areal_tag, areal
 {};
 
 
+/*!
+\brief Metafunction defining the rescale policy used by overlay operations
+    on two geometries with a segments intersection strategy
+\details Equal to rescale_overlay_policy_type for the coordinate system of
+    the strategy, unless the strategy calculates sides exactly
+    (see strategy::intersection::services::is_robust). Then the input is
+    not rescaled, which saves a pass over both geometries.
+*/
+template
+<
+    typename Geometry1,
+    typename Geometry2,
+    typename Strategy
+>
+struct rescale_overlay_policy_type_for_strategy
+    : boost::mpl::if_c
+        <
+            strategy::intersection::services::is_robust<Strategy>::value,
+            detail::get_rescale_policy::rescale_policy_type
+                <
+                    typename geometry::point_type<Geometry1>::type,
+                    false
+                >,
+            rescale_overlay_policy_type
+                <
+                    Geometry1,
+                    Geometry2,
+                    typename Strategy::cs_tag
+                >
+        >::type
+{};
+
+
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace get_rescale_policy
 {
@@ -0,0 +1,316 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
+#define BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
+
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <boost/geometry/io/detail/mapped_file.hpp>
+#include <boost/geometry/srs/projections/grids.hpp>
+#include <boost/geometry/srs/projections/impl/pj_gridinfo.hpp>
+#include <boost/geometry/util/math.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <ios>
+#include <string>
+#include <vector>
+
+
+namespace boost { namespace geometry
+{
+
+namespace projections { namespace detail
+{
+
+// Input stream reading from a mapped grid file, it implements the subset
+// of std::istream used by pj_gridinfo_init() and pj_gridinfo_load().
+// Copies share the mapping.
+class pj_mapped_stream
+{
+public:
+    typedef boost::long_long_type pos_type;
+
+    pj_mapped_stream()
+        : m_pos(0)
+        , m_gcount(0)
+        , m_fail(true)
+    {}
+
+    void open(std::string const& filename)
+    {
+        m_file.reset(new geometry::detail::mapped_file(filename));
+        m_pos = 0;
+        m_gcount = 0;
+        m_fail = ! m_file->is_open();
+    }
+
+    bool is_open() const
+    {
+        return m_file && m_file->is_open();
+    }
+
+    bool fail() const
+    {
+        return m_fail;
+    }
+
+    std::streamsize gcount() const
+    {
+        return m_gcount;
+    }
+
+    pj_mapped_stream & read(char * s, std::streamsize n)
+    {
+        m_gcount = 0;
+        if (m_fail)
+        {
+            return *this;
+        }
+
+        std::size_t const available = m_pos < pos_type(size())
+                                    ? std::size_t(size() - std::size_t(m_pos))
+                                    : 0;
+        std::size_t const count = (std::min)(std::size_t(n), available);
+        std::copy(data() + m_pos, data() + m_pos + count, s);
+        m_pos += count;
+        m_gcount = std::streamsize(count);
+        if (count < std::size_t(n))
+        {
+            m_fail = true;
+        }
+        return *this;
+    }
+
+    pj_mapped_stream & seekg(pos_type pos)
+    {
+        return seekg(pos, std::ios::beg);
+    }
+
+    pj_mapped_stream & seekg(pos_type off, std::ios::seekdir dir)
+    {
+        if (m_fail)
+        {
+            return *this;
+        }
+
+        pos_type const base = dir == std::ios::beg ? 0
+                            : dir == std::ios::cur ? m_pos
+                            : pos_type(size());
+        if (base + off < 0)
+        {
+            m_fail = true;
+        }
+        else
+        {
+            m_pos = base + off;
+        }
+        return *this;
+    }
+
+    pos_type tellg() const
+    {
+        return m_fail ? pos_type(-1) : m_pos;
+    }
+
+    char const* data() const
+    {
+        return m_file ? m_file->data() : NULL;
+    }
+
+    std::size_t size() const
+    {
+        return m_file ? m_file->size() : 0;
+    }
+
+private:
+    boost::shared_ptr<geometry::detail::mapped_file> m_file;
+    pos_type m_pos;
+    std::streamsize m_gcount;
+    bool m_fail;
+};
+
+// Shift values of a horizontal grid decoded directly from the mapped file.
+// Only the cells used by the interpolation are decoded, the result is the
+// same as the one of the corresponding pj_gridinfo_load_*() function.
+class pj_mapped_cells
+{
+public:
+    pj_mapped_cells(pj_mapped_stream const& file, pj_gi_load const& gi)
+        : m_data(NULL)
+        , m_format(gi.format)
+        , m_must_swap(gi.must_swap)
+        , m_lim_lam(gi.ct.lim.lam)
+    {
+        std::size_t record_size = 0;
+        std::size_t offset = 0;
+        if (gi.format == pj_gi::ctable)
+        {
+            record_size = sizeof(pj_ctable::flp_t);
+            // the size of the proj4 original CTABLE
+            offset = 80
+                   + 2 * sizeof(pj_ctable::lp_t)
+                   + sizeof(pj_ctable::ilp_t)
+                   + sizeof(pj_ctable::flp_t*);
+        }
+        else if (gi.format == pj_gi::ctable2)
+        {
+            record_size = sizeof(pj_ctable::flp_t);
+            offset = 160;
+        }
+        else if (gi.format == pj_gi::ntv1)
+        {
+            record_size = 2 * sizeof(double);
+            offset = std::size_t(gi.grid_offset);
+        }
+        else if (gi.format == pj_gi::ntv2)
+        {
+            record_size = 4 * sizeof(float);
+            offset = std::size_t(gi.grid_offset);
+        }
+        else
+        {
+            // vertical or missing grid
+            return;
+        }
+
+        std::size_t const count = std::size_t(gi.ct.lim.lam)
+                                * std::size_t(gi.ct.lim.phi);
+        if (file.data() != NULL
+         && file.size() >= offset
+         && (file.size() - offset) / record_size >= count)
+        {
+            m_data = file.data() + offset;
+        }
+    }
+
+    bool empty() const
+    {
+        return m_data == NULL;
+    }
+
+    pj_ctable::flp_t operator[](boost::int32_t index) const
+    {
+        static const double s2r = math::d2r<double>() / 3600.0;
+
+        pj_ctable::flp_t result;
+
+        if (m_format == pj_gi::ntv2 || m_format == pj_gi::ntv1)
+        {
+            // rows are stored from east to west
+            boost::int32_t const row = index / m_lim_lam;
+            boost::int32_t const col = m_lim_lam - 1 - (index - row * m_lim_lam);
+            std::size_t const i = std::size_t(row) * std::size_t(m_lim_lam)
+                                + std::size_t(col);
+
+            if (m_format == pj_gi::ntv2)
+            {
+                // skip accuracy values
+                float values[2];
+                std::memcpy(values, m_data + i * 4 * sizeof(float), sizeof(values));
+                if (m_must_swap)
+                {
+                    swap_words(reinterpret_cast<char*>(values), 4, 2);
+                }
+                result.phi = (float) (values[0] * s2r);
+                result.lam = (float) (values[1] * s2r);
+            }
+            else
+            {
+                double values[2];
+                std::memcpy(values, m_data + i * 2 * sizeof(double), sizeof(values));
+                if (is_lsb())
+                {
+                    swap_words(reinterpret_cast<char*>(values), 8, 2);
+                }
+                result.phi = (float) (values[0] * s2r);
+                result.lam = (float) (values[1] * s2r);
+            }
+        }
+        else
+        {
+            std::memcpy(&result, m_data + std::size_t(index) * sizeof(result),
+                        sizeof(result));
+            if (m_format == pj_gi::ctable2 && ! is_lsb())
+            {
+                swap_words(reinterpret_cast<char*>(&result), 4, 2);
+            }
+        }
+
+        return result;
+    }
+
+private:
+    char const* m_data;
+    pj_gi_load::format_t m_format;
+    bool m_must_swap;
+    boost::int32_t m_lim_lam;
+};
+
+}} // namespace projections::detail
+
+namespace srs
+{
+
+/*!
+    \brief Stream policy mapping grid files into memory
+    \details Headers are parsed from the mapping instead of being read
+        with std::ifstream. Used with srs::mapped_grids.
+*/
+struct mapped_file_policy
+{
+    typedef projections::detail::pj_mapped_stream stream_type;
+
+    static inline void open(stream_type & is, std::string const& gridname)
+    {
+        is.open(gridname);
+    }
+};
+
+/*!
+    \brief Grids reading the shift values directly from memory-mapped files
+    \details Only the headers are parsed when a grid is added, the shift
+        values are decoded when a point is interpolated. Pages of the file
+        are loaded by the OS when they are touched and are shared by all
+        processes using the same grid files. Like srs::grids this storage
+        is not synchronized, each thread should use its own storage.
+*/
+class mapped_grids
+{
+public:
+    std::size_t size() const
+    {
+        return gridinfo.size();
+    }
+
+    bool empty() const
+    {
+        return gridinfo.empty();
+    }
+
+    typedef projections::detail::mapped_grids_tag tag;
+    typedef projections::detail::pj_mapped_stream file_type;
+    typedef projections::detail::pj_mapped_cells cells_type;
+
+    projections::detail::pj_gridinfo gridinfo;
+    // mapped files of the grids, parallel to gridinfo
+    std::vector<file_type> files;
+};
+
+typedef grids_storage<mapped_file_policy, mapped_grids> mapped_grids_storage;
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
@@ -14,6 +14,7 @@
 #define BOOST_GEOMETRY_SRS_PROJECTION_HPP
 
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/algorithms/convert.hpp>
@@ -487,6 +488,23 @@ public:
                     projections::detail::inverse_point_projection_policy
                 >::apply(xy, ll, base_t::proj());
     }
+
+    /// Forward projection of arrays, from longitudes and latitudes in radians
+    /// to Cartesian. Returns false if any point can not be projected, its
+    /// coordinates are then set to HUGE_VAL. The output may overwrite the input.
+    template <typename T>
+    inline bool forward(T const* lon, T const* lat, T* x, T* y, std::size_t count) const
+    {
+        return base_t::proj().forward(lon, lat, x, y, count);
+    }
+
+    /// Inverse projection of arrays, from Cartesian to longitudes and
+    /// latitudes in radians
+    template <typename T>
+    inline bool inverse(T const* x, T const* y, T* lon, T* lat, std::size_t count) const
+    {
+        return base_t::proj().inverse(x, y, lon, lat, count);
+    }
 };
 
 } // namespace projections
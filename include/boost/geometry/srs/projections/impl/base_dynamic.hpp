@@ -13,9 +13,11 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/srs/projections/exception.hpp>
+#include <boost/geometry/srs/projections/impl/pj_batch.hpp>
 #include <boost/geometry/srs/projections/impl/projects.hpp>
 
 namespace boost { namespace geometry { namespace projections
@@ -48,6 +50,12 @@ public :
     /// Inverse projection using x / y and lon / lat
     virtual void inv(P const& par, CT const& xy_x, CT const& xy_y, CT& lp_lon, CT& lp_lat) const = 0;
 
+    /// Forward projection of arrays, in place, marking points which can not be projected
+    virtual void fwd_n(P const& par, CT* x, CT* y, bool* valid, std::size_t count) const = 0;
+
+    /// Inverse projection of arrays, in place, marking points which can not be projected
+    virtual void inv_n(P const& par, CT* x, CT* y, bool* valid, std::size_t count) const = 0;
+
     /// Forward projection, from Latitude-Longitude to Cartesian
     template <typename LL, typename XY>
     inline bool forward(LL const& lp, XY& xy) const
@@ -82,6 +90,20 @@ public :
         }
     }
 
+    /// Forward projection of arrays of longitudes and latitudes in radians
+    template <typename T>
+    inline bool forward(T const* lon, T const* lat, T* x, T* y, std::size_t count) const
+    {
+        return pj_fwd_n(*this, m_par, lon, lat, x, y, count);
+    }
+
+    /// Inverse projection of arrays to longitudes and latitudes in radians
+    template <typename T>
+    inline bool inverse(T const* x, T const* y, T* lon, T* lat, std::size_t count) const
+    {
+        return pj_inv_n(*this, m_par, x, y, lon, lat, count);
+    }
+
     /// Returns name of projection
     std::string name() const { return m_par.id.name; }
 
@@ -126,6 +148,16 @@ public:
         BOOST_THROW_EXCEPTION(projection_not_invertible_exception(this->name()));
     }
 
+    virtual void fwd_n(P const& par, CT* x, CT* y, bool* valid, std::size_t count) const
+    {
+        batch_projection<Prj>::fwd_n(prj(), par, x, y, valid, count);
+    }
+
+    virtual void inv_n(P const& , CT* , CT* , bool* , std::size_t ) const
+    {
+        BOOST_THROW_EXCEPTION(projection_not_invertible_exception(this->name()));
+    }
+
 protected:
     Prj const& prj() const { return *this; }
 };
@@ -151,6 +183,11 @@ public:
     {
         this->prj().inv(par, xy_x, xy_y, lp_lon, lp_lat);
     }
+
+    virtual void inv_n(P const& par, CT* x, CT* y, bool* valid, std::size_t count) const
+    {
+        batch_projection<Prj>::inv_n(this->prj(), par, x, y, valid, count);
+    }
 };
 
 } // namespace detail
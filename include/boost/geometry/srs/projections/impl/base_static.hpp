@@ -19,11 +19,13 @@
 #endif // defined(_MSC_VER)
 
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/core/tags.hpp>
 
+#include <boost/geometry/srs/projections/impl/pj_batch.hpp>
 #include <boost/geometry/srs/projections/impl/pj_fwd.hpp>
 #include <boost/geometry/srs/projections/impl/pj_inv.hpp>
 
@@ -134,6 +136,27 @@ public:
             (Prj));
         return false;
     }
+
+    template <typename T>
+    inline bool forward(T const* lon, T const* lat, T* x, T* y, std::size_t count) const
+    {
+        return pj_fwd_n(*this, this->m_par, lon, lat, x, y, count);
+    }
+
+    template <typename T>
+    inline bool inverse(T const*, T const*, T*, T*, std::size_t) const
+    {
+        BOOST_MPL_ASSERT_MSG((false),
+            PROJECTION_IS_NOT_INVERTABLE,
+            (Prj));
+        return false;
+    }
+
+    template <typename T>
+    inline void fwd_n(P const& par, T* x, T* y, bool* valid, std::size_t count) const
+    {
+        batch_projection<Prj>::fwd_n(*this, par, x, y, valid, count);
+    }
 };
 
 // Forward/inverse
@@ -160,6 +183,18 @@ public:
             return false;
         }
     }
+
+    template <typename T>
+    inline bool inverse(T const* x, T const* y, T* lon, T* lat, std::size_t count) const
+    {
+        return pj_inv_n(*this, this->m_par, x, y, lon, lat, count);
+    }
+
+    template <typename T>
+    inline void inv_n(P const& par, T* x, T* y, bool* valid, std::size_t count) const
+    {
+        batch_projection<Prj>::inv_n(*this, par, x, y, valid, count);
+    }
 };
 
 } // namespace detail
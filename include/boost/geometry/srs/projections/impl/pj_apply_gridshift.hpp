@@ -58,10 +58,11 @@ namespace detail
 {
 
 // Originally implemented in nad_intr.c
-template <typename CalcT>
+// Cells are the shift values of ct, either ct.cvs or values decoded on access
+template <typename CalcT, typename Cells>
 inline void nad_intr(CalcT in_lon, CalcT in_lat,
                      CalcT & out_lon, CalcT & out_lat,
-                     pj_ctable const& ct)
+                     pj_ctable const& ct, Cells const& cvs)
 {
 	pj_ctable::lp_t frct;
 	pj_ctable::ilp_t indx;
@@ -100,11 +101,11 @@ inline void nad_intr(CalcT in_lon, CalcT in_lat,
 			return;
 	}
 	boost::int32_t index = indx.phi * ct.lim.lam + indx.lam;
-	pj_ctable::flp_t const& f00 = ct.cvs[index++];
-	pj_ctable::flp_t const& f10 = ct.cvs[index];
+	pj_ctable::flp_t const& f00 = cvs[index++];
+	pj_ctable::flp_t const& f10 = cvs[index];
 	index += ct.lim.lam;
-	pj_ctable::flp_t const& f11 = ct.cvs[index--];
-	pj_ctable::flp_t const& f01 = ct.cvs[index];
+	pj_ctable::flp_t const& f11 = cvs[index--];
+	pj_ctable::flp_t const& f01 = cvs[index];
     CalcT m00, m10, m01, m11;
 	m11 = m10 = frct.lam;
 	m00 = m01 = 1. - frct.lam;
@@ -119,11 +120,19 @@ inline void nad_intr(CalcT in_lon, CalcT in_lat,
 			  m01 * f01.phi + m11 * f11.phi;
 }
 
+template <typename CalcT>
+inline void nad_intr(CalcT in_lon, CalcT in_lat,
+                     CalcT & out_lon, CalcT & out_lat,
+                     pj_ctable const& ct)
+{
+    nad_intr(in_lon, in_lat, out_lon, out_lat, ct, ct.cvs);
+}
+
 // Originally implemented in nad_cvt.c
-template <bool Inverse, typename CalcT>
+template <bool Inverse, typename CalcT, typename Cells>
 inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
                     CalcT & out_lon, CalcT & out_lat,
-                    pj_gi const& gi)
+                    pj_gi const& gi, Cells const& cvs)
 {
     static const int max_iterations = 10;
     static const CalcT tol = 1e-12;
@@ -151,7 +160,7 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     tb.lam = adjlon (tb.lam - pi) + pi;
 
     pj_ctable::lp_t t;
-    nad_intr(tb.lam, tb.phi, t.lam, t.phi, ct);
+    nad_intr(tb.lam, tb.phi, t.lam, t.phi, ct, cvs);
     if (t.lam == HUGE_VAL)
     {
         out_lon = HUGE_VAL;
@@ -173,7 +182,7 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     pj_ctable::lp_t del, dif;
     do
     {
-        nad_intr(t.lam, t.phi, del.lam, del.phi, ct);
+        nad_intr(t.lam, t.phi, del.lam, del.phi, ct, cvs);
 
         // This case used to return failure, but I have
         // changed it to return the first order approximation
@@ -210,6 +219,14 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     out_lat = t.phi + ct.ll.phi;
 }
 
+template <bool Inverse, typename CalcT>
+inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
+                    CalcT & out_lon, CalcT & out_lat,
+                    pj_gi const& gi)
+{
+    nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, gi, gi.ct.cvs);
+}
+
 
 /************************************************************************/
 /*                             find_grid()                              */
@@ -265,11 +282,13 @@ inline pj_gi * find_grid(T const& lam,
     return gip;
 }
 
+// grid_index is set to the index of the top-level grid containing the result
 template <typename T>
 inline pj_gi * find_grid(T const& lam,
                          T const& phi,
                          pj_gridinfo & grids,
-                         std::vector<std::size_t> const& gridindexes)
+                         std::vector<std::size_t> const& gridindexes,
+                         std::size_t & grid_index)
 {
     pj_gi * gip = NULL;
 
@@ -285,6 +304,7 @@ inline pj_gi * find_grid(T const& lam,
             if (gi.format != pj_gi::gtx)
             {
                 gip = boost::addressof(gi);
+                grid_index = gridindexes[i];
                 break;
             }
         }
@@ -302,6 +322,16 @@ inline pj_gi * find_grid(T const& lam,
     return gip;
 }
 
+template <typename T>
+inline pj_gi * find_grid(T const& lam,
+                         T const& phi,
+                         pj_gridinfo & grids,
+                         std::vector<std::size_t> const& gridindexes)
+{
+    std::size_t grid_index = 0;
+    return find_grid(lam, phi, grids, gridindexes, grid_index);
+}
+
 
 template <typename StreamPolicy>
 inline bool load_grid(StreamPolicy const& stream_policy, pj_gi_load & gi)
@@ -323,6 +353,28 @@ inline bool load_grid(StreamPolicy const& stream_policy, pj_gi_load & gi)
 }
 
 
+// Shifts the point, the coordinates of which are passed in radians, with
+// the shift values of the grid. The point is not modified if the shift
+// cannot be calculated.
+template <bool Inverse, typename CalcT, typename Point, typename Cells>
+inline void shift_point(Point & point, CalcT const& in_lon, CalcT const& in_lat,
+                        pj_gi const& gi, Cells const& cvs)
+{
+    // TODO: use set_invalid_point() or similar mechanism
+    CalcT out_lon = HUGE_VAL;
+    CalcT out_lat = HUGE_VAL;
+
+    nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, gi, cvs);
+
+    // TODO: check differently
+    if ( out_lon != HUGE_VAL )
+    {
+        geometry::set_from_radian<0>(point, out_lon);
+        geometry::set_from_radian<1>(point, out_lat);
+    }
+}
+
+
 /************************************************************************/
 /*                        pj_apply_gridshift_3()                        */
 /*                                                                      */
@@ -364,18 +416,7 @@ inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
             // load the grid shift info if we don't have it.
             if (! gip->ct.cvs.empty() || load_grid(stream_policy, *gip))
             {
-                // TODO: use set_invalid_point() or similar mechanism
-                CalcT out_lon = HUGE_VAL;
-                CalcT out_lat = HUGE_VAL;
-
-                nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, *gip);
-            
-                // TODO: check differently
-                if ( out_lon != HUGE_VAL )
-                {
-                    geometry::set_from_radian<0>(point, out_lon);
-                    geometry::set_from_radian<1>(point, out_lat);
-                }
+                shift_point<Inverse>(point, in_lon, in_lat, *gip, gip->ct.cvs);
             }
         }
     }
@@ -432,18 +473,7 @@ inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
                 }
                 else if (! gip->ct.cvs.empty())
                 {
-                    // TODO: use set_invalid_point() or similar mechanism
-                    CalcT out_lon = HUGE_VAL;
-                    CalcT out_lat = HUGE_VAL;
-
-                    nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, *gip);
-
-                    // TODO: check differently
-                    if (out_lon != HUGE_VAL)
-                    {
-                        geometry::set_from_radian<0>(point, out_lon);
-                        geometry::set_from_radian<1>(point, out_lat);
-                    }
+                    shift_point<Inverse>(point, in_lon, in_lat, *gip, gip->ct.cvs);
                 }
                 else
                 {
@@ -481,6 +511,53 @@ inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
 }
 
 
+// Mapped files stream policy and mapped grids
+template <bool Inverse, typename CalcT, typename StreamPolicy, typename Range, typename MappedGrids>
+inline bool pj_apply_gridshift_3(StreamPolicy const& ,
+                                 Range & range,
+                                 MappedGrids & grids,
+                                 std::vector<std::size_t> const& gridindexes,
+                                 mapped_grids_tag)
+{
+    typedef typename boost::range_size<Range>::type size_type;
+    typedef typename MappedGrids::cells_type cells_type;
+
+    // If the grids are empty the indexes are as well
+    if (gridindexes.empty())
+    {
+        return false;
+    }
+
+    size_type point_count = boost::size(range);
+
+    for (size_type i = 0 ; i < point_count ; ++i)
+    {
+        typename boost::range_reference<Range>::type
+            point = range::at(range, i);
+
+        CalcT in_lon = geometry::get_as_radian<0>(point);
+        CalcT in_lat = geometry::get_as_radian<1>(point);
+
+        std::size_t grid_index = 0;
+        pj_gi * gip = find_grid(in_lon, in_lat, grids.gridinfo, gridindexes, grid_index);
+
+        if ( gip != NULL )
+        {
+            // shift values are decoded from the file mapping of the
+            // top-level grid, children are stored in the same file
+            cells_type const cells(grids.files[grid_index], *gip);
+
+            if (! cells.empty())
+            {
+                shift_point<Inverse>(point, in_lon, in_lat, *gip, cells);
+            }
+        }
+    }
+
+    return true;
+}
+
+
 /************************************************************************/
 /*                        pj_apply_gridshift_2()                        */
 /*                                                                      */
@@ -524,6 +601,61 @@ inline bool pj_apply_gridshift_2(Par const& , Range & , srs::detail::empty_proje
 }
 
 
+/************************************************************************/
+/*                          pj_gridlist_load()                          */
+/*                                                                      */
+/*      Loads the shift values of all grids of the gridlist and of      */
+/*      their subgrids. Standard grids are loaded lazily by             */
+/*      pj_apply_gridshift_3(), after this call they are only read      */
+/*      and can be used by several threads at once. Shared grids are    */
+/*      synchronized and mapped grids are never loaded.                 */
+/************************************************************************/
+
+template <typename StreamPolicy>
+inline void pj_gridinfo_load_all(StreamPolicy const& stream_policy, pj_gi & gi)
+{
+    // skip vertical and missing grids
+    if (gi.format != pj_gi::gtx && gi.format != pj_gi::missing)
+    {
+        load_grid(stream_policy, gi);
+    }
+
+    for (std::size_t i = 0 ; i < gi.children.size() ; ++i)
+    {
+        pj_gridinfo_load_all(stream_policy, gi.children[i]);
+    }
+}
+
+template <typename StreamPolicy, typename Grids>
+inline void pj_gridlist_load(StreamPolicy const& stream_policy,
+                             Grids & grids,
+                             std::vector<std::size_t> const& gridindexes,
+                             grids_tag)
+{
+    for (std::size_t i = 0 ; i < gridindexes.size() ; ++i)
+    {
+        pj_gridinfo_load_all(stream_policy, grids.gridinfo[gridindexes[i]]);
+    }
+}
+
+template <typename StreamPolicy, typename Grids, typename Tag>
+inline void pj_gridlist_load(StreamPolicy const& , Grids & ,
+                             std::vector<std::size_t> const& , Tag)
+{}
+
+template <typename ProjGrids>
+inline void pj_gridlist_load(ProjGrids const& proj_grids)
+{
+    pj_gridlist_load(proj_grids.grids_storage().stream_policy,
+                     proj_grids.grids_storage().hgrids,
+                     proj_grids.hindexes,
+                     typename ProjGrids::grids_storage_type::grids_type::tag());
+}
+
+inline void pj_gridlist_load(srs::detail::empty_projection_grids const& )
+{}
+
+
 } // namespace detail
 
 }}} // namespace boost::geometry::projections
@@ -0,0 +1,278 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_BATCH_HPP
+#define BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_BATCH_HPP
+
+#include <cstddef>
+#include <algorithm>
+
+#include <boost/geometry/util/math.hpp>
+
+#include <boost/geometry/srs/projections/exception.hpp>
+#include <boost/geometry/srs/projections/impl/adjlon.hpp>
+
+/* general forward and inverse projection of coordinate arrays */
+
+namespace boost { namespace geometry { namespace projections {
+
+namespace detail {
+
+// Number of points projected at once, the buffers of one block live on the
+// stack and stay in the cache between the steps
+static const std::size_t pj_batch_size = 256;
+
+// Projects arrays of coordinates, in place, point by point with the
+// projection's fwd. Points which can not be projected are marked as not
+// valid, points which are not valid are skipped.
+template <typename Prj, typename P, typename T>
+inline void fwd_n_by_point(Prj const& prj, P const& par,
+                           T* x, T* y, bool* valid, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (valid[i])
+        {
+            T const lon = x[i];
+            T const lat = y[i];
+            try
+            {
+                prj.fwd(par, lon, lat, x[i], y[i]);
+            }
+            catch (...)
+            {
+                valid[i] = false;
+            }
+        }
+    }
+}
+
+// Projects arrays of coordinates, in place, point by point with the
+// projection's inv
+template <typename Prj, typename P, typename T>
+inline void inv_n_by_point(Prj const& prj, P const& par,
+                           T* x, T* y, bool* valid, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (valid[i])
+        {
+            T const xy_x = x[i];
+            T const xy_y = y[i];
+            try
+            {
+                prj.inv(par, xy_x, xy_y, x[i], y[i]);
+            }
+            catch (...)
+            {
+                valid[i] = false;
+            }
+        }
+    }
+}
+
+/*!
+    \brief Projects arrays of coordinates, in place
+    \details The arrays contain (lon, lat) or (x, y), without the general
+        parameters applied (see pj_fwd_n and pj_inv_n). By default points are
+        projected one by one. Projections can specialize this template with
+        kernels written as plain loops without exceptions, which compilers
+        can vectorize (see BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F
+        and BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_FI).
+        A kernel selects the mode of the projection once for all points and
+        checks the points in a separate loop, or while they are calculated,
+        instead of branching per point, so that the loop calculating the
+        points can be vectorized. Invalid points are calculated too and
+        their results are discarded. The checks and the calculations of a
+        point are member functions of the projection, also called by its
+        fwd and inv, so both give the same results.
+*/
+template <typename Prj>
+struct batch_projection
+{
+    template <typename P, typename T>
+    static inline void fwd_n(Prj const& prj, P const& par,
+                             T* x, T* y, bool* valid, std::size_t count)
+    {
+        fwd_n_by_point(prj, par, x, y, valid, count);
+    }
+
+    template <typename P, typename T>
+    static inline void inv_n(Prj const& prj, P const& par,
+                             T* x, T* y, bool* valid, std::size_t count)
+    {
+        inv_n_by_point(prj, par, x, y, valid, count);
+    }
+};
+
+// Projections with a forward kernel, member function fwd_n
+#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F(PRJ) \
+template <typename T, typename P> \
+struct batch_projection<PRJ<T, P> > \
+{ \
+    static inline void fwd_n(PRJ<T, P> const& prj, P const& par, \
+                             T* x, T* y, bool* valid, std::size_t count) \
+    { \
+        prj.fwd_n(par, x, y, valid, count); \
+    } \
+    static inline void inv_n(PRJ<T, P> const& prj, P const& par, \
+                             T* x, T* y, bool* valid, std::size_t count) \
+    { \
+        inv_n_by_point(prj, par, x, y, valid, count); \
+    } \
+}; \
+
+// Projections with a forward and an inverse kernel, member functions fwd_n
+// and inv_n
+#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_FI(PRJ) \
+template <typename T, typename P> \
+struct batch_projection<PRJ<T, P> > \
+{ \
+    static inline void fwd_n(PRJ<T, P> const& prj, P const& par, \
+                             T* x, T* y, bool* valid, std::size_t count) \
+    { \
+        prj.fwd_n(par, x, y, valid, count); \
+    } \
+    static inline void inv_n(PRJ<T, P> const& prj, P const& par, \
+                             T* x, T* y, bool* valid, std::size_t count) \
+    { \
+        prj.inv_n(par, x, y, valid, count); \
+    } \
+}; \
+
+/* forward projection entry of arrays, lon and lat in radians */
+template <typename Prj, typename P, typename T>
+inline bool pj_fwd_n(Prj const& prj, P const& par,
+                     T const* lon, T const* lat, T* x, T* y,
+                     std::size_t count)
+{
+    typedef typename P::type calc_t;
+    static const calc_t EPS = 1.0e-12;
+    static const calc_t half_pi = geometry::math::half_pi<calc_t>();
+
+    calc_t block_x[pj_batch_size];
+    calc_t block_y[pj_batch_size];
+    bool valid[pj_batch_size];
+
+    bool result = true;
+    for (std::size_t first = 0; first < count; first += pj_batch_size)
+    {
+        std::size_t const n = (std::min)(count - first, pj_batch_size);
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            calc_t lp_lon = lon[first + i];
+            calc_t lp_lat = lat[first + i];
+            calc_t const t = geometry::math::abs(lp_lat) - half_pi;
+
+            /* check for forward and latitude or longitude overange */
+            valid[i] = ! (t > EPS || geometry::math::abs(lp_lon) > 10.);
+            if (! valid[i])
+            {
+                lp_lon = 0;
+                lp_lat = 0;
+            }
+            else if (geometry::math::abs(t) <= EPS)
+            {
+                lp_lat = lp_lat < 0. ? -half_pi : half_pi;
+            }
+            else if (par.geoc)
+            {
+                lp_lat = atan(par.rone_es * tan(lp_lat));
+            }
+
+            lp_lon -= par.lam0;    /* compute del lp.lam */
+            if (! par.over)
+            {
+                lp_lon = adjlon(lp_lon); /* post_forward del longitude */
+            }
+
+            block_x[i] = lp_lon;
+            block_y[i] = lp_lat;
+        }
+
+        prj.fwd_n(par, block_x, block_y, valid, n);
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            if (valid[i] && block_x[i] != HUGE_VAL && block_y[i] != HUGE_VAL)
+            {
+                x[first + i] = T(par.fr_meter * (par.a * block_x[i] + par.x0));
+                y[first + i] = T(par.fr_meter * (par.a * block_y[i] + par.y0));
+            }
+            else
+            {
+                x[first + i] = T(HUGE_VAL);
+                y[first + i] = T(HUGE_VAL);
+                result = false;
+            }
+        }
+    }
+    return result;
+}
+
+/* inverse projection entry of arrays, lon and lat in radians */
+template <typename Prj, typename P, typename T>
+inline bool pj_inv_n(Prj const& prj, P const& par,
+                     T const* x, T const* y, T* lon, T* lat,
+                     std::size_t count)
+{
+    typedef typename P::type calc_t;
+    static const calc_t EPS = 1.0e-12;
+    static const calc_t half_pi = geometry::math::half_pi<calc_t>();
+
+    calc_t block_x[pj_batch_size];
+    calc_t block_y[pj_batch_size];
+    bool valid[pj_batch_size];
+
+    bool result = true;
+    for (std::size_t first = 0; first < count; first += pj_batch_size)
+    {
+        std::size_t const n = (std::min)(count - first, pj_batch_size);
+
+        /* descale and de-offset */
+        for (std::size_t i = 0; i < n; i++)
+        {
+            valid[i] = x[first + i] != T(HUGE_VAL) && y[first + i] != T(HUGE_VAL);
+            block_x[i] = valid[i] ? (calc_t(x[first + i]) * par.to_meter - par.x0) * par.ra : 0;
+            block_y[i] = valid[i] ? (calc_t(y[first + i]) * par.to_meter - par.y0) * par.ra : 0;
+        }
+
+        prj.inv_n(par, block_x, block_y, valid, n);
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            calc_t lp_lon = block_x[i];
+            calc_t lp_lat = block_y[i];
+            if (! valid[i] || lp_lon == HUGE_VAL || lp_lat == HUGE_VAL)
+            {
+                lon[first + i] = T(HUGE_VAL);
+                lat[first + i] = T(HUGE_VAL);
+                result = false;
+                continue;
+            }
+
+            lp_lon += par.lam0; /* reduce from del lp.lam */
+            if (! par.over)
+            {
+                lp_lon = adjlon(lp_lon); /* adjust longitude to CM */
+            }
+            if (par.geoc && geometry::math::abs(geometry::math::abs(lp_lat) - half_pi) > EPS)
+            {
+                lp_lat = atan(par.one_es * tan(lp_lat));
+            }
+
+            lon[first + i] = T(lp_lon);
+            lat[first + i] = T(lp_lat);
+        }
+    }
+    return result;
+}
+
+} // namespace detail
+}}} // namespace boost::geometry::projections
+
+#endif // BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_BATCH_HPP
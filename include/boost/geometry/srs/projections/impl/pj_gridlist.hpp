@@ -178,6 +178,41 @@ inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
 }
 
 
+// Mapped files stream policy and mapped grids
+template <typename StreamPolicy, typename MappedGrids>
+inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
+                                       StreamPolicy const& stream_policy,
+                                       MappedGrids & grids,
+                                       std::vector<std::size_t> & gridindexes,
+                                       mapped_grids_tag)
+{
+    // Try to find in the existing list of mapped grids.
+    if (pj_gridlist_find_all(gridname, grids.gridinfo, gridindexes))
+        return true;
+
+    std::size_t orig_size = grids.gridinfo.size();
+
+    // Map the named grid and parse the headers, the shift values
+    // are decoded from the mapping when they are used.
+    typename StreamPolicy::stream_type is;
+    stream_policy.open(is, gridname);
+
+    bool const result = pj_gridinfo_init(gridname, is, grids.gridinfo);
+
+    // Keep the files parallel to the grids, also after partial failure.
+    grids.files.resize(grids.gridinfo.size(), is);
+
+    if (! result)
+    {
+        return false;
+    }
+
+    pj_gridlist_add_seq_inc(gridindexes, orig_size, grids.gridinfo.size());
+
+    return true;
+}
+
+
 /************************************************************************/
 /*                     pj_gridlist_from_nadgrids()                      */
 /*                                                                      */
@@ -46,6 +46,7 @@
 
 #include <boost/geometry/srs/projections/impl/geocent.hpp>
 #include <boost/geometry/srs/projections/impl/pj_apply_gridshift.hpp>
+#include <boost/geometry/srs/projections/impl/pj_batch.hpp>
 #include <boost/geometry/srs/projections/impl/projects.hpp>
 #include <boost/geometry/srs/projections/invalid_point.hpp>
 
@@ -210,6 +211,24 @@ inline int pj_geocentric_to_geodetic( T const& a, T const& es,
 template <typename T, typename Range>
 inline int pj_geodetic_to_geocentric( T const& a, T const& es,
                                       Range & range );
+template <typename Par>
+inline bool pj_transform_fused_enabled( Par const& srcdefn, Par const& dstdefn,
+                                        std::size_t point_count );
+template <typename SrcPrj, typename DstPrj2, typename Par, typename Range>
+inline bool pj_transform_fused( SrcPrj const& srcprj, Par const& srcdefn,
+                                DstPrj2 const& dstprj, Par const& dstdefn,
+                                Range & range );
+
+// Returns true if the error of a projection of a point has to be rethrown,
+// otherwise the point is set as invalid and the processing continues
+inline bool pj_transform_error_is_fatal(int code)
+{
+    return (code != 33 /*EDOM*/
+            && code != 34 /*ERANGE*/ )
+        && (code > 0
+            || code < -44 /*|| point_count == 1*/
+            || transient_error[-code] == 0);
+}
 
 /************************************************************************/
 /*                            pj_transform()                            */
@@ -240,6 +259,15 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
     std::size_t point_count = boost::size(range);
     bool result = true;
 
+/* -------------------------------------------------------------------- */
+/*      Apply all stages block by block if the datums are converted     */
+/*      through geocentric coordinates.                                 */
+/* -------------------------------------------------------------------- */
+    if( pj_transform_fused_enabled( srcdefn, dstdefn, point_count ) )
+    {
+        return pj_transform_fused( srcprj, srcdefn, dstprj, dstdefn, range );
+    }
+
 /* -------------------------------------------------------------------- */
 /*      Transform unusual input coordinate axis orientation to          */
 /*      standard form if needed.                                        */
@@ -370,11 +398,7 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
                 }
                 catch(projection_exception const& e)
                 {
-                    if( (e.code() != 33 /*EDOM*/
-                        && e.code() != 34 /*ERANGE*/ )
-                        && (e.code() > 0
-                            || e.code() < -44 /*|| point_count == 1*/
-                            || transient_error[-e.code()] == 0) ) {
+                    if( pj_transform_error_is_fatal(e.code()) ) {
                         BOOST_RETHROW
                     } else {
                         set_invalid_point(point);
@@ -542,11 +566,7 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
                     pj_fwd(dstprj, dstdefn, point, point);
                 } catch (projection_exception const& e) {
 
-                    if( (e.code() != 33 /*EDOM*/
-                         && e.code() != 34 /*ERANGE*/ )
-                        && (e.code() > 0
-                            || e.code() < -44 /*|| point_count == 1*/
-                            || transient_error[-e.code()] == 0) ) {
+                    if( pj_transform_error_is_fatal(e.code()) ) {
                         BOOST_RETHROW
                     } else {
                         set_invalid_point(point);
@@ -1023,6 +1043,318 @@ inline bool pj_datum_transform(Par const& srcdefn,
     return result;
 }
 
+/************************************************************************/
+/*                    pj_geodetic_to_geocentric_n()                     */
+/*                                                                      */
+/*      Array version of pj_Convert_Geodetic_To_Geocentric(), in        */
+/*      place. Latitudes are checked in a separate loop so the          */
+/*      conversion can be vectorized. Returns false if a latitude is    */
+/*      out of range, the point is then set as not valid.               */
+/************************************************************************/
+
+template <typename T, typename CT>
+inline bool pj_geodetic_to_geocentric_n( GeocentricInfo<T> const& gi,
+                                         CT * x, CT * y, CT * z,
+                                         bool * valid, std::size_t count )
+{
+    static const T PI = math::pi<T>();
+    static const T PI_OVER_2 = math::half_pi<T>();
+
+    bool result = true;
+
+    T lat[pj_batch_size];
+    for( std::size_t i = 0 ; i < count ; ++i )
+    {
+        T latitude = y[i];
+        if( latitude < -PI_OVER_2 && latitude > -1.001 * PI_OVER_2 )
+            latitude = -PI_OVER_2;
+        else if( latitude > PI_OVER_2 && latitude < 1.001 * PI_OVER_2 )
+            latitude = PI_OVER_2;
+        else if( (latitude < -PI_OVER_2) || (latitude > PI_OVER_2) )
+        {
+            if( valid[i] )
+                result = false;
+            valid[i] = false;
+        }
+
+        lat[i] = valid[i] ? latitude : T(0);
+    }
+
+    for( std::size_t i = 0 ; i < count ; ++i )
+    {
+        T const longitude = x[i] > PI ? x[i] - (2*PI) : T(x[i]);
+        T const height = z[i];
+        T const sin_lat = sin(lat[i]);
+        T const cos_lat = cos(lat[i]);
+        T const rn = gi.Geocent_a / (sqrt(1.0e0 - gi.Geocent_e2 * (sin_lat * sin_lat)));
+        x[i] = CT((rn + height) * cos_lat * cos(longitude));
+        y[i] = CT((rn + height) * cos_lat * sin(longitude));
+        z[i] = CT(((rn * (1 - gi.Geocent_e2)) + height) * sin_lat);
+    }
+
+    return result;
+}
+
+/************************************************************************/
+/*                      pj_geocentric_to_wgs84_n()                      */
+/*                     pj_geocentric_from_wgs84_n()                     */
+/*                                                                      */
+/*      Array versions of the 3 and 7 parameter Helmert                 */
+/*      transformations, in place.                                      */
+/************************************************************************/
+
+template <typename Par, typename CT>
+inline void pj_geocentric_to_wgs84_n( Par const& defn,
+                                      CT * x, CT * y, CT * z,
+                                      std::size_t count )
+{
+    typedef typename Par::type calc_t;
+
+    calc_t const dx = Dx_BF(defn), dy = Dy_BF(defn), dz = Dz_BF(defn);
+
+    if( defn.datum_type == datum_3param )
+    {
+        for( std::size_t i = 0 ; i < count ; ++i )
+        {
+            x[i] = CT(x[i] + dx);
+            y[i] = CT(y[i] + dy);
+            z[i] = CT(z[i] + dz);
+        }
+    }
+    else if( defn.datum_type == datum_7param )
+    {
+        calc_t const rx = Rx_BF(defn), ry = Ry_BF(defn), rz = Rz_BF(defn);
+        calc_t const m = M_BF(defn);
+
+        for( std::size_t i = 0 ; i < count ; ++i )
+        {
+            CT const x_in = x[i];
+            CT const y_in = y[i];
+            CT const z_in = z[i];
+
+            x[i] = CT(m*(     x_in - rz*y_in + ry*z_in) + dx);
+            y[i] = CT(m*( rz*x_in +     y_in - rx*z_in) + dy);
+            z[i] = CT(m*(-ry*x_in + rx*y_in +     z_in) + dz);
+        }
+    }
+}
+
+template <typename Par, typename CT>
+inline void pj_geocentric_from_wgs84_n( Par const& defn,
+                                        CT * x, CT * y, CT * z,
+                                        std::size_t count )
+{
+    typedef typename Par::type calc_t;
+
+    calc_t const dx = Dx_BF(defn), dy = Dy_BF(defn), dz = Dz_BF(defn);
+
+    if( defn.datum_type == datum_3param )
+    {
+        for( std::size_t i = 0 ; i < count ; ++i )
+        {
+            x[i] = CT(x[i] - dx);
+            y[i] = CT(y[i] - dy);
+            z[i] = CT(z[i] - dz);
+        }
+    }
+    else if( defn.datum_type == datum_7param )
+    {
+        calc_t const rx = Rx_BF(defn), ry = Ry_BF(defn), rz = Rz_BF(defn);
+        calc_t const m = M_BF(defn);
+
+        for( std::size_t i = 0 ; i < count ; ++i )
+        {
+            CT const x_tmp = CT((x[i] - dx) / m);
+            CT const y_tmp = CT((y[i] - dy) / m);
+            CT const z_tmp = CT((z[i] - dz) / m);
+
+            x[i] = CT(     x_tmp + rz*y_tmp - ry*z_tmp);
+            y[i] = CT(-rz*x_tmp +     y_tmp + rx*z_tmp);
+            z[i] = CT( ry*x_tmp - rx*y_tmp +     z_tmp);
+        }
+    }
+}
+
+/************************************************************************/
+/*                     pj_transform_fused_enabled()                     */
+/*                                                                      */
+/*      Returns true if the datums of a range are converted through     */
+/*      geocentric coordinates without grid shifts, in this case        */
+/*      pj_transform_fused() is used.                                   */
+/************************************************************************/
+
+template <typename Par>
+inline bool pj_transform_fused_enabled( Par const& srcdefn, Par const& dstdefn,
+                                        std::size_t point_count )
+{
+    if( point_count < 2
+        || srcdefn.is_geocent || dstdefn.is_geocent
+        || srcdefn.datum_type == datum_unknown
+        || dstdefn.datum_type == datum_unknown
+        || srcdefn.datum_type == datum_gridshift
+        || dstdefn.datum_type == datum_gridshift )
+        return false;
+
+    if( pj_compare_datums( srcdefn, dstdefn ) )
+        return false;
+
+    return srcdefn.es_orig != dstdefn.es_orig
+        || srcdefn.a_orig != dstdefn.a_orig
+        || srcdefn.datum_type == datum_3param
+        || srcdefn.datum_type == datum_7param
+        || dstdefn.datum_type == datum_3param
+        || dstdefn.datum_type == datum_7param;
+}
+
+/************************************************************************/
+/*                         pj_transform_fused()                         */
+/*                                                                      */
+/*      Same as pj_transform() but all stages are applied to a block    */
+/*      of points before the next block is processed, so the            */
+/*      coordinates stay in cache. Geocentric coordinates are kept in   */
+/*      arrays and the results are the same as the ones of separate     */
+/*      passes over the range.                                          */
+/************************************************************************/
+
+template <typename SrcPrj, typename DstPrj2, typename Par, typename Range>
+inline bool pj_transform_fused( SrcPrj const& srcprj, Par const& srcdefn,
+                                DstPrj2 const& dstprj, Par const& dstdefn,
+                                Range & range )
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    typedef typename coordinate_type<point_type>::type coord_t;
+    typedef typename Par::type calc_t;
+    static const std::size_t dimension = geometry::dimension<point_type>::value;
+    std::size_t point_count = boost::size(range);
+    bool result = true;
+
+    calc_t const src_a = srcdefn.a_orig;
+    calc_t const src_es = srcdefn.es_orig;
+    calc_t const dst_a = dstdefn.a_orig;
+    calc_t const dst_es = dstdefn.es_orig;
+
+    GeocentricInfo<calc_t> src_gi, dst_gi;
+    if( pj_Set_Geocentric_Parameters( src_gi, src_a,
+                                      (src_es == 0.0) ? src_a : src_a * sqrt(1-src_es) ) != 0
+        || pj_Set_Geocentric_Parameters( dst_gi, dst_a,
+                                         (dst_es == 0.0) ? dst_a : dst_a * sqrt(1-dst_es) ) != 0 )
+    {
+        BOOST_THROW_EXCEPTION( projection_exception(error_geocentric) );
+    }
+
+    coord_t x[pj_batch_size];
+    coord_t y[pj_batch_size];
+    coord_t z[pj_batch_size];
+    bool valid[pj_batch_size];
+
+    for( std::size_t first = 0 ; first < point_count ; first += pj_batch_size )
+    {
+        std::size_t const n = (std::min)(point_count - first, pj_batch_size);
+
+        // Source coordinates to geodetic
+        for( std::size_t i = 0 ; i < n ; ++i )
+        {
+            point_type & point = range::at(range, first + i);
+
+            if( srcdefn.vto_meter != 1.0 && dimension > 2 )
+                set_z(point, get_z(point) * srcdefn.vto_meter);
+
+            valid[i] = ! is_invalid_point(point);
+
+            if( valid[i] && ! srcdefn.is_latlong )
+            {
+                try
+                {
+                    pj_inv(srcprj, srcdefn, point, point);
+                }
+                catch(projection_exception const& e)
+                {
+                    if( pj_transform_error_is_fatal(e.code()) ) {
+                        BOOST_RETHROW
+                    }
+                    set_invalid_point(point);
+                    valid[i] = false;
+                    result = false;
+                }
+            }
+
+            if( valid[i] && srcdefn.from_greenwich != 0.0 )
+                set<0>(point, get<0>(point) + srcdefn.from_greenwich);
+
+            x[i] = valid[i] ? coord_t(get_as_radian<0>(point)) : coord_t(0);
+            y[i] = valid[i] ? coord_t(get_as_radian<1>(point)) : coord_t(0);
+            z[i] = valid[i] ? coord_t(get_z(point)) : coord_t(0);
+        }
+
+        // Datum shift in geocentric coordinates
+        if( ! pj_geodetic_to_geocentric_n( src_gi, x, y, z, valid, n ) )
+            result = false;
+
+        pj_geocentric_to_wgs84_n( srcdefn, x, y, z, n );
+        pj_geocentric_from_wgs84_n( dstdefn, x, y, z, n );
+
+        // Geodetic to destination coordinates
+        for( std::size_t i = 0 ; i < n ; ++i )
+        {
+            point_type & point = range::at(range, first + i);
+
+            if( valid[i] )
+            {
+                calc_t longitude = 0, latitude = 0, height = 0;
+                pj_Convert_Geocentric_To_Geodetic( dst_gi,
+                                                   calc_t(x[i]), calc_t(y[i]), calc_t(z[i]),
+                                                   longitude, latitude, height );
+
+                set_from_radian<0>(point, longitude);
+                set_from_radian<1>(point, latitude);
+                if( dimension > 2 )
+                    set_z(point, height);
+
+                if( dstdefn.from_greenwich != 0.0 )
+                    set<0>(point, get<0>(point) - dstdefn.from_greenwich);
+
+                if( ! dstdefn.is_latlong )
+                {
+                    try
+                    {
+                        pj_fwd(dstprj, dstdefn, point, point);
+                    }
+                    catch(projection_exception const& e)
+                    {
+                        if( pj_transform_error_is_fatal(e.code()) ) {
+                            BOOST_RETHROW
+                        }
+                        set_invalid_point(point);
+                        result = false;
+                    }
+                }
+                else if( dstdefn.is_long_wrap_set )
+                {
+                    coord_t lon = get_as_radian<0>(point);
+
+                    // TODO - units-dependant constants could be used instead
+                    while( lon < dstdefn.long_wrap_center - math::pi<coord_t>() )
+                        lon += math::two_pi<coord_t>();
+                    while( lon > dstdefn.long_wrap_center + math::pi<coord_t>() )
+                        lon -= math::two_pi<coord_t>();
+
+                    set_from_radian<0>(point, lon);
+                }
+            }
+            else if( ! is_invalid_point(point) )
+            {
+                // converted point out of range
+                set_invalid_point(point);
+            }
+
+            if( dstdefn.vto_meter != 1.0 && dimension > 2 )
+                set_z(point, get_z(point) * dstdefn.vfr_meter);
+        }
+    }
+
+    return result;
+}
+
 } // namespace detail
 
 }}} // namespace boost::geometry::projections
@@ -124,14 +124,12 @@ namespace projections
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& par, T lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    T rho = this->m_proj_parm.c - (this->m_proj_parm.ellips
-                                                                    ? this->m_proj_parm.n * pj_qsfn(sin(lp_lat), par.e, par.one_es)
-                                                                    : this->m_proj_parm.n2 * sin(lp_lat));
+                    T const rho = this->m_proj_parm.ellips
+                                ? rho_ellipsoid(par, lp_lat)
+                                : rho_spheroid(lp_lat);
                     if (rho < 0.)
                         BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
-                    rho = this->m_proj_parm.dd * sqrt(rho);
-                    xy_x = rho * sin( lp_lon *= this->m_proj_parm.n );
-                    xy_y = this->m_proj_parm.rho0 - rho * cos(lp_lon);
+                    fwd_rho(lp_lon, rho, xy_x, xy_y);
                 }
 
                 // INVERSE(e_inverse)  ellipsoid & spheroid
@@ -166,6 +164,46 @@ namespace projections
                     }
                 }
 
+                // Forward projection of arrays, in place (see pj_fwd_n)
+                // rho is calculated in place in y
+                inline void fwd_n(Parameters const& par, T* x, T* y, bool* valid, std::size_t count) const
+                {
+                    if (this->m_proj_parm.ellips) {
+                        for (std::size_t i = 0; i < count; i++) {
+                            y[i] = rho_ellipsoid(par, y[i]);
+                        }
+                    } else {
+                        for (std::size_t i = 0; i < count; i++) {
+                            y[i] = rho_spheroid(y[i]);
+                        }
+                    }
+                    for (std::size_t i = 0; i < count; i++) {
+                        valid[i] = valid[i] && ! (y[i] < 0.);
+                    }
+                    for (std::size_t i = 0; i < count; i++) {
+                        fwd_rho(x[i], y[i], x[i], y[i]);
+                    }
+                }
+
+                // rho before the square root, negative if the point can
+                // not be projected
+                inline T rho_ellipsoid(Parameters const& par, T const& lp_lat) const
+                {
+                    return this->m_proj_parm.c - this->m_proj_parm.n * pj_qsfn(sin(lp_lat), par.e, par.one_es);
+                }
+
+                inline T rho_spheroid(T const& lp_lat) const
+                {
+                    return this->m_proj_parm.c - this->m_proj_parm.n2 * sin(lp_lat);
+                }
+
+                inline void fwd_rho(T lp_lon, T rho, T& xy_x, T& xy_y) const
+                {
+                    rho = this->m_proj_parm.dd * sqrt(rho);
+                    xy_x = rho * sin( lp_lon *= this->m_proj_parm.n );
+                    xy_y = this->m_proj_parm.rho0 - rho * cos(lp_lon);
+                }
+
                 static inline std::string get_name()
                 {
                     return "aea_ellipsoid";
@@ -315,6 +353,10 @@ namespace projections
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_STATIC_PROJECTION_FI(srs::spar::proj_aea, aea_ellipsoid)
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_STATIC_PROJECTION_FI(srs::spar::proj_leac, leac_ellipsoid)
 
+        // Batch projection
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F(aea_ellipsoid)
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F(leac_ellipsoid)
+
         // Factory entry(s)
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_FACTORY_ENTRY_FI(aea_entry, aea_ellipsoid)
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_FACTORY_ENTRY_FI(leac_entry, leac_ellipsoid)
@@ -83,24 +83,13 @@ namespace projections
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& par, T lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T fourth_pi = detail::fourth_pi<T>();
-                    static const T half_pi = detail::half_pi<T>();
-
-                    T rho;
-
-                    if (fabs(fabs(lp_lat) - half_pi) < epsilon10) {
-                        if ((lp_lat * this->m_proj_parm.n) <= 0.) {
-                            BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
-                        }
-                        rho = 0.;
-                    } else {
-                        rho = this->m_proj_parm.c * (this->m_proj_parm.ellips
-                            ? math::pow(pj_tsfn(lp_lat, sin(lp_lat), par.e), this->m_proj_parm.n)
-                            : math::pow(tan(fourth_pi + T(0.5) * lp_lat), -this->m_proj_parm.n));
+                    if (! fwd_valid(lp_lat)) {
+                        BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
                     }
-                    lp_lon *= this->m_proj_parm.n;
-                    xy_x = par.k0 * (rho * sin( lp_lon) );
-                    xy_y = par.k0 * (this->m_proj_parm.rho0 - rho * cos(lp_lon) );
+                    T const rho = this->m_proj_parm.ellips
+                                ? rho_ellipsoid(par, lp_lat)
+                                : rho_spheroid(lp_lat);
+                    fwd_rho(par, lp_lon, rho, xy_x, xy_y);
                 }
 
                 // INVERSE(e_inverse)  ellipsoid & spheroid
@@ -136,6 +125,60 @@ namespace projections
                     }
                 }
 
+                // Forward projection of arrays, in place (see pj_fwd_n)
+                // rho is calculated in place in y
+                inline void fwd_n(Parameters const& par, T* x, T* y, bool* valid, std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++) {
+                        valid[i] = valid[i] && fwd_valid(y[i]);
+                    }
+                    if (this->m_proj_parm.ellips) {
+                        for (std::size_t i = 0; i < count; i++) {
+                            y[i] = rho_ellipsoid(par, y[i]);
+                        }
+                    } else {
+                        for (std::size_t i = 0; i < count; i++) {
+                            y[i] = rho_spheroid(y[i]);
+                        }
+                    }
+                    for (std::size_t i = 0; i < count; i++) {
+                        fwd_rho(par, x[i], y[i], x[i], y[i]);
+                    }
+                }
+
+                // The pole opposite to the cone can not be projected
+                inline bool fwd_valid(T const& lp_lat) const
+                {
+                    static const T half_pi = detail::half_pi<T>();
+
+                    return ! (fabs(fabs(lp_lat) - half_pi) < epsilon10
+                              && (lp_lat * this->m_proj_parm.n) <= 0.);
+                }
+
+                inline T rho_ellipsoid(Parameters const& par, T const& lp_lat) const
+                {
+                    static const T half_pi = detail::half_pi<T>();
+
+                    return fabs(fabs(lp_lat) - half_pi) < epsilon10 ? T(0)
+                        : this->m_proj_parm.c * math::pow(pj_tsfn(lp_lat, sin(lp_lat), par.e), this->m_proj_parm.n);
+                }
+
+                inline T rho_spheroid(T const& lp_lat) const
+                {
+                    static const T fourth_pi = detail::fourth_pi<T>();
+                    static const T half_pi = detail::half_pi<T>();
+
+                    return fabs(fabs(lp_lat) - half_pi) < epsilon10 ? T(0)
+                        : this->m_proj_parm.c * math::pow(tan(fourth_pi + T(0.5) * lp_lat), -this->m_proj_parm.n);
+                }
+
+                inline void fwd_rho(Parameters const& par, T lp_lon, T rho, T& xy_x, T& xy_y) const
+                {
+                    lp_lon *= this->m_proj_parm.n;
+                    xy_x = par.k0 * (rho * sin( lp_lon) );
+                    xy_y = par.k0 * (this->m_proj_parm.rho0 - rho * cos(lp_lon) );
+                }
+
                 static inline std::string get_name()
                 {
                     return "lcc_ellipsoid";
@@ -246,6 +289,9 @@ namespace projections
         // Static projection
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_STATIC_PROJECTION_FI(srs::spar::proj_lcc, lcc_ellipsoid)
 
+        // Batch projection
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F(lcc_ellipsoid)
+
         // Factory entry(s)
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_FACTORY_ENTRY_FI(lcc_entry, lcc_ellipsoid)
         
@@ -62,6 +62,15 @@ namespace projections
 
             static const double epsilon10 = 1.e-10;
 
+            // The poles can not be projected
+            template <typename T>
+            inline bool fwd_valid(T const& lp_lat)
+            {
+                static const T half_pi = detail::half_pi<T>();
+
+                return ! (fabs(fabs(lp_lat) - half_pi) <= epsilon10);
+            }
+
             template <typename T, typename Parameters>
             struct base_merc_ellipsoid
             {
@@ -69,13 +78,10 @@ namespace projections
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T half_pi = detail::half_pi<T>();
-
-                    if (fabs(fabs(lp_lat) - half_pi) <= epsilon10) {
+                    if (! fwd_valid(lp_lat)) {
                         BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
                     }
-                    xy_x = par.k0 * lp_lon;
-                    xy_y = - par.k0 * log(pj_tsfn(lp_lat, sin(lp_lat), par.e));
+                    fwd_point(par, lp_lon, lp_lat, xy_x, xy_y);
                 }
 
                 // INVERSE(e_inverse)  ellipsoid
@@ -88,6 +94,23 @@ namespace projections
                     lp_lon = xy_x / par.k0;
                 }
 
+                // Forward projection of arrays, in place (see pj_fwd_n)
+                inline void fwd_n(Parameters const& par, T* x, T* y, bool* valid, std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++) {
+                        valid[i] = valid[i] && fwd_valid(y[i]);
+                    }
+                    for (std::size_t i = 0; i < count; i++) {
+                        fwd_point(par, x[i], y[i], x[i], y[i]);
+                    }
+                }
+
+                static inline void fwd_point(Parameters const& par, T lp_lon, T lp_lat, T& xy_x, T& xy_y)
+                {
+                    xy_x = par.k0 * lp_lon;
+                    xy_y = - par.k0 * log(pj_tsfn(lp_lat, sin(lp_lat), par.e));
+                }
+
                 static inline std::string get_name()
                 {
                     return "merc_ellipsoid";
@@ -102,19 +125,47 @@ namespace projections
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T half_pi = detail::half_pi<T>();
-                    static const T fourth_pi = detail::fourth_pi<T>();
-
-                    if (fabs(fabs(lp_lat) - half_pi) <= epsilon10) {
+                    if (! fwd_valid(lp_lat)) {
                         BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
                     }
-                    xy_x = par.k0 * lp_lon;
-                    xy_y = par.k0 * log(tan(fourth_pi + .5 * lp_lat));
+                    fwd_point(par, lp_lon, lp_lat, xy_x, xy_y);
                 }
 
                 // INVERSE(s_inverse)  spheroid
                 // Project coordinates from cartesian (x, y) to geographic (lon, lat)
                 inline void inv(Parameters const& par, T const& xy_x, T const& xy_y, T& lp_lon, T& lp_lat) const
+                {
+                    inv_point(par, xy_x, xy_y, lp_lon, lp_lat);
+                }
+
+                // Forward projection of arrays, in place (see pj_fwd_n)
+                inline void fwd_n(Parameters const& par, T* x, T* y, bool* valid, std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++) {
+                        valid[i] = valid[i] && fwd_valid(y[i]);
+                    }
+                    for (std::size_t i = 0; i < count; i++) {
+                        fwd_point(par, x[i], y[i], x[i], y[i]);
+                    }
+                }
+
+                // Inverse projection of arrays, in place (see pj_inv_n)
+                inline void inv_n(Parameters const& par, T* x, T* y, bool* , std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++) {
+                        inv_point(par, x[i], y[i], x[i], y[i]);
+                    }
+                }
+
+                static inline void fwd_point(Parameters const& par, T lp_lon, T lp_lat, T& xy_x, T& xy_y)
+                {
+                    static const T fourth_pi = detail::fourth_pi<T>();
+
+                    xy_x = par.k0 * lp_lon;
+                    xy_y = par.k0 * log(tan(fourth_pi + .5 * lp_lat));
+                }
+
+                static inline void inv_point(Parameters const& par, T xy_x, T xy_y, T& lp_lon, T& lp_lat)
                 {
                     static const T half_pi = detail::half_pi<T>();
 
@@ -213,6 +264,10 @@ namespace projections
         // Static projection
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_STATIC_PROJECTION_FI2(srs::spar::proj_merc, merc_spheroid, merc_ellipsoid)
 
+        // Batch projection
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_FI(merc_spheroid)
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F(merc_ellipsoid)
+
         // Factory entry(s)
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_FACTORY_ENTRY_FI2(merc_entry, merc_spheroid, merc_ellipsoid)
         
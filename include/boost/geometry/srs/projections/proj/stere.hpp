@@ -98,51 +98,22 @@ namespace projections
 
                 // FORWARD(e_forward)  ellipsoid
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
-                inline void fwd(Parameters const& par, T const& lp_lon, T lp_lat, T& xy_x, T& xy_y) const
+                inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T half_pi = detail::half_pi<T>();
-
-                    T coslam, sinlam, sinX=0.0, cosX=0.0, X, A = 0.0, sinphi;
-
-                    coslam = cos(lp_lon);
-                    sinlam = sin(lp_lon);
-                    sinphi = sin(lp_lat);
-                    if (this->m_proj_parm.mode == obliq || this->m_proj_parm.mode == equit) {
-                        sinX = sin(X = 2. * atan(ssfn_(lp_lat, sinphi, par.e)) - half_pi);
-                        cosX = cos(X);
-                    }
                     switch (this->m_proj_parm.mode) {
                     case obliq:
-                        A = this->m_proj_parm.akm1 / (this->m_proj_parm.cosX1 * (1. + this->m_proj_parm.sinX1 * sinX +
-                           this->m_proj_parm.cosX1 * cosX * coslam));
-                        xy_y = A * (this->m_proj_parm.cosX1 * sinX - this->m_proj_parm.sinX1 * cosX * coslam);
-                        goto xmul; /* but why not just  xy.x = A * cosX; break;  ? */
-
+                        fwd_oblique(par, lp_lon, lp_lat, xy_x, xy_y);
+                        break;
                     case equit:
-                        // TODO: calculate denominator once
-                        /* avoid zero division */
-                        if (1. + cosX * coslam == 0.0) {
-                            xy_y = HUGE_VAL;
-                        } else {
-                            A = this->m_proj_parm.akm1 / (1. + cosX * coslam);
-                            xy_y = A * sinX;
-                        }
-                xmul:
-                        xy_x = A * cosX;
+                        fwd_equatorial(par, lp_lon, lp_lat, xy_x, xy_y);
                         break;
-
                     case s_pole:
-                        lp_lat = -lp_lat;
-                        coslam = - coslam;
-                        sinphi = -sinphi;
-                        BOOST_FALLTHROUGH;
+                        fwd_polar(par, T(-1), lp_lon, lp_lat, xy_x, xy_y);
+                        break;
                     case n_pole:
-                        xy_x = this->m_proj_parm.akm1 * pj_tsfn(lp_lat, sinphi, par.e);
-                        xy_y = - xy_x * coslam;
+                        fwd_polar(par, T(1), lp_lon, lp_lat, xy_x, xy_y);
                         break;
                     }
-
-                    xy_x = xy_x * sinlam;
                 }
 
                 // INVERSE(e_inverse)  ellipsoid
@@ -193,6 +164,74 @@ namespace projections
                     BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
                 }
 
+                // Forward projection of arrays, in place (see pj_fwd_n)
+                // The mode is selected once for all points
+                inline void fwd_n(Parameters const& par, T* x, T* y, bool* , std::size_t count) const
+                {
+                    switch (this->m_proj_parm.mode) {
+                    case obliq:
+                        for (std::size_t i = 0; i < count; i++) {
+                            fwd_oblique(par, x[i], y[i], x[i], y[i]);
+                        }
+                        break;
+                    case equit:
+                        for (std::size_t i = 0; i < count; i++) {
+                            fwd_equatorial(par, x[i], y[i], x[i], y[i]);
+                        }
+                        break;
+                    case s_pole:
+                    case n_pole:
+                        {
+                            T const sign = this->m_proj_parm.mode == s_pole ? -1. : 1.;
+                            for (std::size_t i = 0; i < count; i++) {
+                                fwd_polar(par, sign, x[i], y[i], x[i], y[i]);
+                            }
+                        }
+                        break;
+                    }
+                }
+
+                inline void fwd_oblique(Parameters const& par, T lp_lon, T lp_lat, T& xy_x, T& xy_y) const
+                {
+                    static const T half_pi = detail::half_pi<T>();
+
+                    T const coslam = cos(lp_lon);
+                    T const sinlam = sin(lp_lon);
+                    T const X = 2. * atan(ssfn_(lp_lat, sin(lp_lat), par.e)) - half_pi;
+                    T const sinX = sin(X);
+                    T const cosX = cos(X);
+                    T const A = this->m_proj_parm.akm1 / (this->m_proj_parm.cosX1 * (1. + this->m_proj_parm.sinX1 * sinX +
+                       this->m_proj_parm.cosX1 * cosX * coslam));
+                    xy_y = A * (this->m_proj_parm.cosX1 * sinX - this->m_proj_parm.sinX1 * cosX * coslam);
+                    xy_x = A * cosX * sinlam;
+                }
+
+                inline void fwd_equatorial(Parameters const& par, T lp_lon, T lp_lat, T& xy_x, T& xy_y) const
+                {
+                    static const T half_pi = detail::half_pi<T>();
+
+                    T const coslam = cos(lp_lon);
+                    T const sinlam = sin(lp_lon);
+                    T const X = 2. * atan(ssfn_(lp_lat, sin(lp_lat), par.e)) - half_pi;
+                    T const sinX = sin(X);
+                    T const cosX = cos(X);
+                    /* avoid zero division, HUGE_VAL marks the point invalid */
+                    T const denominator = 1. + cosX * coslam;
+                    T const A = denominator == 0.0 ? T(0) : this->m_proj_parm.akm1 / denominator;
+                    xy_y = denominator == 0.0 ? T(HUGE_VAL) : A * sinX;
+                    xy_x = A * cosX * sinlam;
+                }
+
+                // sign is -1 for the south pole and 1 for the north pole
+                inline void fwd_polar(Parameters const& par, T sign, T lp_lon, T lp_lat, T& xy_x, T& xy_y) const
+                {
+                    T const coslam = sign * cos(lp_lon);
+                    T const sinphi = sign * sin(lp_lat);
+                    T const rho = this->m_proj_parm.akm1 * pj_tsfn(sign * lp_lat, sinphi, par.e);
+                    xy_y = - rho * coslam;
+                    xy_x = rho * sin(lp_lon);
+                }
+
                 static inline std::string get_name()
                 {
                     return "stere_ellipsoid";
@@ -207,43 +246,27 @@ namespace projections
 
                 // FORWARD(s_forward)  spheroid
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
-                inline void fwd(Parameters const& , T const& lp_lon, T lp_lat, T& xy_x, T& xy_y) const
+                inline void fwd(Parameters const& , T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T fourth_pi = detail::fourth_pi<T>();
-                    static const T half_pi = detail::half_pi<T>();
-
-                    T  sinphi, cosphi, coslam, sinlam;
-
-                    sinphi = sin(lp_lat);
-                    cosphi = cos(lp_lat);
-                    coslam = cos(lp_lon);
-                    sinlam = sin(lp_lon);
+                    bool valid = true;
                     switch (this->m_proj_parm.mode) {
                     case equit:
-                        xy_y = 1. + cosphi * coslam;
-                        goto oblcon;
+                        valid = fwd_oblique(T(0), T(1), lp_lon, lp_lat, xy_x, xy_y);
+                        break;
                     case obliq:
-                        xy_y = 1. + this->m_proj_parm.sinX1 * sinphi + this->m_proj_parm.cosX1 * cosphi * coslam;
-                oblcon:
-                        if (xy_y <= epsilon10) {
-                            BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
-                        }
-                        xy_x = (xy_y = this->m_proj_parm.akm1 / xy_y) * cosphi * sinlam;
-                        xy_y *= (this->m_proj_parm.mode == equit) ? sinphi :
-                           this->m_proj_parm.cosX1 * sinphi - this->m_proj_parm.sinX1 * cosphi * coslam;
+                        valid = fwd_oblique(this->m_proj_parm.sinX1, this->m_proj_parm.cosX1,
+                                            lp_lon, lp_lat, xy_x, xy_y);
                         break;
                     case n_pole:
-                        coslam = - coslam;
-                        lp_lat = - lp_lat;
-                        BOOST_FALLTHROUGH;
+                        valid = fwd_polar(T(-1), lp_lon, lp_lat, xy_x, xy_y);
+                        break;
                     case s_pole:
-                        if (fabs(lp_lat - half_pi) < tolerance) {
-                            BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
-                        }
-                        xy_x = sinlam * ( xy_y = this->m_proj_parm.akm1 * tan(fourth_pi + .5 * lp_lat) );
-                        xy_y *= coslam;
+                        valid = fwd_polar(T(1), lp_lon, lp_lat, xy_x, xy_y);
                         break;
                     }
+                    if (! valid) {
+                        BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
+                    }
                 }
 
                 // INVERSE(s_inverse)  spheroid
@@ -286,6 +309,62 @@ namespace projections
                     }
                 }
 
+                // Forward projection of arrays, in place (see pj_fwd_n)
+                // The mode is selected once for all points, and the points
+                // are checked while they are calculated
+                inline void fwd_n(Parameters const& , T* x, T* y, bool* valid, std::size_t count) const
+                {
+                    switch (this->m_proj_parm.mode) {
+                    case equit:
+                    case obliq:
+                        {
+                            T const s1 = this->m_proj_parm.mode == equit ? T(0) : this->m_proj_parm.sinX1;
+                            T const c1 = this->m_proj_parm.mode == equit ? T(1) : this->m_proj_parm.cosX1;
+                            for (std::size_t i = 0; i < count; i++) {
+                                valid[i] = fwd_oblique(s1, c1, x[i], y[i], x[i], y[i]) && valid[i];
+                            }
+                        }
+                        break;
+                    case n_pole:
+                    case s_pole:
+                        {
+                            T const sign = this->m_proj_parm.mode == n_pole ? -1. : 1.;
+                            for (std::size_t i = 0; i < count; i++) {
+                                valid[i] = fwd_polar(sign, x[i], y[i], x[i], y[i]) && valid[i];
+                            }
+                        }
+                        break;
+                    }
+                }
+
+                // Oblique case, with s1 = 0 and c1 = 1 equatorial
+                inline bool fwd_oblique(T const& s1, T const& c1, T lp_lon, T lp_lat, T& xy_x, T& xy_y) const
+                {
+                    T const sinphi = sin(lp_lat);
+                    T const cosphi = cos(lp_lat);
+                    T const coslam = cos(lp_lon);
+                    T const sinlam = sin(lp_lon);
+                    T const denominator = 1. + s1 * sinphi + c1 * cosphi * coslam;
+                    T const A = this->m_proj_parm.akm1 / denominator;
+                    xy_x = A * cosphi * sinlam;
+                    xy_y = A * (c1 * sinphi - s1 * cosphi * coslam);
+                    return ! (denominator <= epsilon10);
+                }
+
+                // sign is -1 for the north pole and 1 for the south pole
+                inline bool fwd_polar(T const& sign, T lp_lon, T lp_lat, T& xy_x, T& xy_y) const
+                {
+                    static const T fourth_pi = detail::fourth_pi<T>();
+                    static const T half_pi = detail::half_pi<T>();
+
+                    T const coslam = sign * cos(lp_lon);
+                    lp_lat *= sign;
+                    T const A = this->m_proj_parm.akm1 * tan(fourth_pi + .5 * lp_lat);
+                    xy_x = sin(lp_lon) * A;
+                    xy_y = A * coslam;
+                    return ! (fabs(lp_lat - half_pi) < tolerance);
+                }
+
                 static inline std::string get_name()
                 {
                     return "stere_spheroid";
@@ -496,6 +575,12 @@ namespace projections
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_STATIC_PROJECTION_FI2(srs::spar::proj_stere, stere_spheroid, stere_ellipsoid)
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_STATIC_PROJECTION_FI2(srs::spar::proj_ups, ups_spheroid, ups_ellipsoid)
 
+        // Batch projection
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F(stere_spheroid)
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F(stere_ellipsoid)
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F(ups_spheroid)
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F(ups_ellipsoid)
+
         // Factory entry(s)
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_FACTORY_ENTRY_FI2(stere_entry, stere_spheroid, stere_ellipsoid)
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_FACTORY_ENTRY_FI2(ups_entry, ups_spheroid, ups_ellipsoid)
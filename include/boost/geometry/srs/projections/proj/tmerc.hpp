@@ -78,6 +78,21 @@ namespace projections
             template <typename T>
             inline T FC8() { return .01785714285714285714285714285714285714; }
 
+            /*
+             * Fail if our longitude is more than 90 degrees from the
+             * central meridian since the results are essentially garbage.
+             * Is error -20 really an appropriate return value?
+             *
+             *  http://trac.osgeo.org/proj/ticket/5
+             */
+            template <typename T>
+            inline bool lon_valid(T const& lp_lon)
+            {
+                static const T half_pi = detail::half_pi<T>();
+
+                return ! ( lp_lon < -half_pi || lp_lon > half_pi );
+            }
+
             template <typename T>
             struct par_tmerc
             {
@@ -95,52 +110,14 @@ namespace projections
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T half_pi = detail::half_pi<T>();
-                    static const T FC1 = tmerc::FC1<T>();
-                    static const T FC2 = tmerc::FC2<T>();
-                    static const T FC3 = tmerc::FC3<T>();
-                    static const T FC4 = tmerc::FC4<T>();
-                    static const T FC5 = tmerc::FC5<T>();
-                    static const T FC6 = tmerc::FC6<T>();
-                    static const T FC7 = tmerc::FC7<T>();
-                    static const T FC8 = tmerc::FC8<T>();
-
-                    T al, als, n, cosphi, sinphi, t;
-
-                    /*
-                     * Fail if our longitude is more than 90 degrees from the
-                     * central meridian since the results are essentially garbage.
-                     * Is error -20 really an appropriate return value?
-                     *
-                     *  http://trac.osgeo.org/proj/ticket/5
-                     */
-                    if( lp_lon < -half_pi || lp_lon > half_pi )
+                    if (! lon_valid(lp_lon))
                     {
                         xy_x = HUGE_VAL;
                         xy_y = HUGE_VAL;
                         BOOST_THROW_EXCEPTION( projection_exception(error_lat_or_lon_exceed_limit) );
                         return;
                     }
-
-                    sinphi = sin(lp_lat);
-                    cosphi = cos(lp_lat);
-                    t = fabs(cosphi) > 1e-10 ? sinphi/cosphi : 0.;
-                    t *= t;
-                    al = cosphi * lp_lon;
-                    als = al * al;
-                    al /= sqrt(1. - par.es * sinphi * sinphi);
-                    n = this->m_proj_parm.esp * cosphi * cosphi;
-                    xy_x = par.k0 * al * (FC1 +
-                        FC3 * als * (1. - t + n +
-                        FC5 * als * (5. + t * (t - 18.) + n * (14. - 58. * t)
-                        + FC7 * als * (61. + t * ( t * (179. - t) - 479. ) )
-                        )));
-                    xy_y = par.k0 * (pj_mlfn(lp_lat, sinphi, cosphi, this->m_proj_parm.en) - this->m_proj_parm.ml0 +
-                        sinphi * al * lp_lon * FC2 * ( 1. +
-                        FC4 * als * (5. - t + n * (9. + 4. * n) +
-                        FC6 * als * (61. + t * (t - 58.) + n * (270. - 330 * t)
-                        + FC8 * als * (1385. + t * ( t * (543. - t) - 3111.) )
-                        ))));
+                    fwd_point(par, lp_lon, lp_lat, xy_x, xy_y);
                 }
 
                 // INVERSE(e_inverse)  ellipsoid
@@ -186,6 +163,51 @@ namespace projections
                     }
                 }
 
+                // Forward projection of arrays, in place (see pj_fwd_n)
+                inline void fwd_n(Parameters const& par, T* x, T* y, bool* valid, std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++) {
+                        valid[i] = valid[i] && lon_valid(x[i]);
+                    }
+                    for (std::size_t i = 0; i < count; i++) {
+                        fwd_point(par, x[i], y[i], x[i], y[i]);
+                    }
+                }
+
+                inline void fwd_point(Parameters const& par, T lp_lon, T lp_lat, T& xy_x, T& xy_y) const
+                {
+                    static const T FC1 = tmerc::FC1<T>();
+                    static const T FC2 = tmerc::FC2<T>();
+                    static const T FC3 = tmerc::FC3<T>();
+                    static const T FC4 = tmerc::FC4<T>();
+                    static const T FC5 = tmerc::FC5<T>();
+                    static const T FC6 = tmerc::FC6<T>();
+                    static const T FC7 = tmerc::FC7<T>();
+                    static const T FC8 = tmerc::FC8<T>();
+
+                    T al, als, n, cosphi, sinphi, t;
+
+                    sinphi = sin(lp_lat);
+                    cosphi = cos(lp_lat);
+                    t = fabs(cosphi) > 1e-10 ? sinphi/cosphi : 0.;
+                    t *= t;
+                    al = cosphi * lp_lon;
+                    als = al * al;
+                    al /= sqrt(1. - par.es * sinphi * sinphi);
+                    n = this->m_proj_parm.esp * cosphi * cosphi;
+                    xy_x = par.k0 * al * (FC1 +
+                        FC3 * als * (1. - t + n +
+                        FC5 * als * (5. + t * (t - 18.) + n * (14. - 58. * t)
+                        + FC7 * als * (61. + t * ( t * (179. - t) - 479. ) )
+                        )));
+                    xy_y = par.k0 * (pj_mlfn(lp_lat, sinphi, cosphi, this->m_proj_parm.en) - this->m_proj_parm.ml0 +
+                        sinphi * al * lp_lon * FC2 * ( 1. +
+                        FC4 * als * (5. - t + n * (9. + 4. * n) +
+                        FC6 * als * (61. + t * (t - 58.) + n * (270. - 330 * t)
+                        + FC8 * als * (1385. + t * ( t * (543. - t) - 3111.) )
+                        ))));
+                }
+
                 static inline std::string get_name()
                 {
                     return "tmerc_ellipsoid";
@@ -202,49 +224,62 @@ namespace projections
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T half_pi = detail::half_pi<T>();
-
-                    T b, cosphi;
-
-                    /*
-                     * Fail if our longitude is more than 90 degrees from the
-                     * central meridian since the results are essentially garbage.
-                     * Is error -20 really an appropriate return value?
-                     *
-                     *  http://trac.osgeo.org/proj/ticket/5
-                     */
-                    if( lp_lon < -half_pi || lp_lon > half_pi )
+                    int const error = fwd_point(par, lp_lon, lp_lat, xy_x, xy_y);
+                    if (error != 0)
                     {
                         xy_x = HUGE_VAL;
                         xy_y = HUGE_VAL;
-                        BOOST_THROW_EXCEPTION( projection_exception(error_lat_or_lon_exceed_limit) );
-                        return;
+                        BOOST_THROW_EXCEPTION( projection_exception(error) );
                     }
+                }
 
-                    cosphi = cos(lp_lat);
-                    b = cosphi * sin(lp_lon);
-                    if (fabs(fabs(b) - 1.) <= epsilon10)
-                        BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
+                // INVERSE(s_inverse)  sphere
+                // Project coordinates from cartesian (x, y) to geographic (lon, lat)
+                inline void inv(Parameters const& par, T const& xy_x, T const& xy_y, T& lp_lon, T& lp_lat) const
+                {
+                    inv_point(par, xy_x, xy_y, lp_lon, lp_lat);
+                }
 
-                    xy_x = this->m_proj_parm.ml0 * log((1. + b) / (1. - b));
-                    xy_y = cosphi * cos(lp_lon) / sqrt(1. - b * b);
+                // Forward projection of arrays, in place (see pj_fwd_n)
+                // The points are checked while they are calculated
+                inline void fwd_n(Parameters const& par, T* x, T* y, bool* valid, std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++) {
+                        valid[i] = fwd_point(par, x[i], y[i], x[i], y[i]) == 0 && valid[i];
+                    }
+                }
+
+                // Inverse projection of arrays, in place (see pj_inv_n)
+                inline void inv_n(Parameters const& par, T* x, T* y, bool* , std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++) {
+                        inv_point(par, x[i], y[i], x[i], y[i]);
+                    }
+                }
 
-                    b = fabs( xy_y );
-                    if (b >= 1.) {
-                        if ((b - 1.) > epsilon10)
-                            BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
-                        else xy_y = 0.;
-                    } else
-                        xy_y = acos(xy_y);
+                // Returns the error code, the coordinates are only valid
+                // if it is 0
+                inline int fwd_point(Parameters const& par, T lp_lon, T lp_lat, T& xy_x, T& xy_y) const
+                {
+                    T const cosphi = cos(lp_lat);
+                    T const b = cosphi * sin(lp_lon);
+                    T const c = cosphi * cos(lp_lon) / sqrt(1. - b * b);
 
+                    xy_x = this->m_proj_parm.ml0 * log((1. + b) / (1. - b));
+                    xy_y = fabs(c) >= 1. ? T(0) : acos(c);
                     if (lp_lat < 0.)
                         xy_y = -xy_y;
                     xy_y = this->m_proj_parm.esp * (xy_y - par.phi0);
+
+                    if (! lon_valid(lp_lon))
+                        return error_lat_or_lon_exceed_limit;
+                    if (fabs(fabs(b) - 1.) <= epsilon10
+                        || (fabs(c) >= 1. && (fabs(c) - 1.) > epsilon10))
+                        return error_tolerance_condition;
+                    return 0;
                 }
 
-                // INVERSE(s_inverse)  sphere
-                // Project coordinates from cartesian (x, y) to geographic (lon, lat)
-                inline void inv(Parameters const& par, T const& xy_x, T const& xy_y, T& lp_lon, T& lp_lat) const
+                inline void inv_point(Parameters const& par, T xy_x, T xy_y, T& lp_lon, T& lp_lat) const
                 {
                     T h, g;
 
@@ -334,6 +369,10 @@ namespace projections
 
         // Static projection
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_STATIC_PROJECTION_FI2(srs::spar::proj_tmerc, tmerc_spheroid, tmerc_ellipsoid)
+
+        // Batch projection
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_FI(tmerc_spheroid)
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_BATCH_PROJECTION_F(tmerc_ellipsoid)
         
         // Factory entry(s) - dynamic projection
         BOOST_GEOMETRY_PROJECTIONS_DETAIL_FACTORY_ENTRY_FI2(tmerc_entry, tmerc_spheroid, tmerc_ellipsoid)
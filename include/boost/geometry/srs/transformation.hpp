@@ -12,8 +12,11 @@
 
 
 #include <string>
+#include <vector>
 
 #include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/parallel.hpp>
+#include <boost/geometry/algorithms/detail/transform/transform_parallel.hpp>
 
 #include <boost/geometry/core/coordinate_dimension.hpp>
 
@@ -27,8 +30,11 @@
 #include <boost/geometry/srs/projections/grids.hpp>
 #include <boost/geometry/srs/projections/impl/pj_transform.hpp>
 
+#include <boost/geometry/util/range.hpp>
+
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
+#include <boost/core/addressof.hpp>
 #include <boost/mpl/assert.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/smart_ptr/shared_ptr.hpp>
@@ -43,17 +49,7 @@ namespace boost { namespace geometry
 namespace projections { namespace detail
 {
 
-template <typename T1, typename T2>
-inline bool same_object(T1 const& , T2 const& )
-{
-    return false;
-}
-
-template <typename T>
-inline bool same_object(T const& o1, T const& o2)
-{
-    return boost::addressof(o1) == boost::addressof(o2);
-}
+using geometry::detail::transform::same_object;
 
 template
 <
@@ -554,6 +550,240 @@ struct transform<MultiPolygon, CT, multi_polygon_tag>
 {};
 
 
+template <typename Pieces, typename Wrappers>
+struct transform_components_convert
+{
+    transform_components_convert(Pieces const& pieces,
+                                 Wrappers & wrappers, bool input_angles)
+        : m_pieces(pieces)
+        , m_wrappers(wrappers)
+        , m_input_angles(input_angles)
+    {}
+
+    void operator()(std::size_t index) const
+    {
+        typedef typename Wrappers::value_type::element_type wrapper_type;
+        m_wrappers[index].reset(new wrapper_type(*m_pieces.inputs[index],
+                                                 *m_pieces.outputs[index],
+                                                 m_input_angles));
+    }
+
+    Pieces const& m_pieces;
+    Wrappers & m_wrappers;
+    bool m_input_angles;
+};
+
+template <typename Wrappers>
+struct transform_components_finish
+{
+    explicit transform_components_finish(Wrappers & wrappers)
+        : m_wrappers(wrappers)
+    {}
+
+    void operator()(std::size_t index) const
+    {
+        m_wrappers[index]->finish();
+    }
+
+    Wrappers & m_wrappers;
+};
+
+// pj_transform() of a part of a converted range
+template
+<
+    typename Proj1, typename Par1,
+    typename Proj2, typename Par2,
+    typename Grids, typename Wrappers
+>
+struct transform_components_part
+{
+    transform_components_part(Proj1 const& proj1, Par1 const& par1,
+                              Proj2 const& proj2, Par2 const& par2,
+                              Grids const& grids1, Grids const& grids2,
+                              Wrappers & wrappers)
+        : m_proj1(proj1), m_par1(par1)
+        , m_proj2(proj2), m_par2(par2)
+        , m_grids1(grids1), m_grids2(grids2)
+        , m_wrappers(wrappers)
+    {}
+
+    bool operator()(std::size_t piece, std::size_t first, std::size_t last) const
+    {
+        typedef typename Wrappers::value_type::element_type::type range_type;
+        typedef typename boost::range_iterator<range_type>::type iterator;
+
+        range_type & rng = m_wrappers[piece]->get();
+
+        std::pair<iterator, iterator> part(range::pos(rng, first),
+                                           range::pos(rng, last));
+
+        try
+        {
+            return pj_transform(m_proj1, m_par1, m_proj2, m_par2, part,
+                                m_grids1, m_grids2);
+        }
+        catch (projection_exception const&)
+        {
+            return false;
+        }
+    }
+
+    Proj1 const& m_proj1;
+    Par1 const& m_par1;
+    Proj2 const& m_proj2;
+    Par2 const& m_par2;
+    Grids const& m_grids1;
+    Grids const& m_grids2;
+    Wrappers & m_wrappers;
+};
+
+template
+<
+    typename Geometry,
+    typename CT,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct transform_parallel
+{
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename In, typename Out,
+        typename Grids
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             In const& in, Out & out,
+                             Grids const& grids1, Grids const& grids2,
+                             std::size_t )
+    {
+        return transform<Geometry, CT>::apply(proj1, par1, proj2, par2,
+                                              in, out, grids1, grids2);
+    }
+};
+
+// The points of all ranges are converted and then transformed in parts,
+// long ranges are divided between threads. The results are the same as
+// the results of the sequential transformation.
+template <typename CT>
+struct transform_parallel_ranges
+{
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename In, typename Out,
+        typename Grids
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             In const& in, Out & out,
+                             Grids const& grids1, Grids const& grids2,
+                             std::size_t threads)
+    {
+        // several blocks of pj_transform() in each part
+        static std::size_t const min_chunk_size = 4 * pj_batch_size;
+
+        typedef geometry::detail::transform::collect_pieces
+            <
+                In, Out, geometry::detail::transform::range_references
+            > collect_type;
+        typedef typename collect_type::pieces_type pieces_type;
+        typedef transform_geometry_wrapper
+            <
+                typename pieces_type::output_type, CT
+            > wrapper_type;
+        typedef std::vector<boost::shared_ptr<wrapper_type> > wrappers_type;
+
+        pieces_type pieces;
+        collect_type::apply(in, out, pieces);
+
+        std::size_t total = 0;
+        for (std::size_t i = 0 ; i < pieces.size() ; ++i)
+            total += boost::size(*pieces.inputs[i]);
+
+        if (geometry::detail::parallel::chunk_count(total, threads,
+                                                    min_chunk_size) <= 1)
+        {
+            bool res = true;
+            for (std::size_t i = 0 ; i < pieces.size() ; ++i)
+            {
+                if (! transform_range<CT>::apply(proj1, par1, proj2, par2,
+                                                 *pieces.inputs[i],
+                                                 *pieces.outputs[i],
+                                                 grids1, grids2))
+                {
+                    res = false;
+                }
+            }
+            return res;
+        }
+
+        // NOTE: this has to be consistent with pj_transform()
+        bool const input_angles = !par1.is_geocent && par1.is_latlong;
+
+        // Standard grids are loaded lazily, load them before the threads
+        // start so they are only read
+        pj_gridlist_load(grids1);
+        pj_gridlist_load(grids2);
+
+        wrappers_type wrappers(pieces.size());
+        geometry::detail::parallel::for_each_index(pieces.size(), threads,
+            transform_components_convert<pieces_type, wrappers_type>(
+                pieces, wrappers, input_angles));
+
+        // The sizes of converted ranges can be different, e.g. if the
+        // closing point is added
+        std::vector<std::size_t> sizes(wrappers.size());
+        for (std::size_t i = 0 ; i < wrappers.size() ; ++i)
+            sizes[i] = boost::size(wrappers[i]->get());
+
+        bool const res = geometry::detail::transform::for_each_range_part(
+            sizes, threads, min_chunk_size,
+            transform_components_part
+                <
+                    Proj1, Par1, Proj2, Par2, Grids, wrappers_type
+                >(proj1, par1, proj2, par2, grids1, grids2, wrappers));
+
+        geometry::detail::parallel::for_each_index(wrappers.size(), threads,
+            transform_components_finish<wrappers_type>(wrappers));
+
+        return res;
+    }
+};
+
+template <typename MultiPoint, typename CT>
+struct transform_parallel<MultiPoint, CT, multi_point_tag>
+    : transform_parallel_ranges<CT>
+{};
+
+template <typename Linestring, typename CT>
+struct transform_parallel<Linestring, CT, linestring_tag>
+    : transform_parallel_ranges<CT>
+{};
+
+template <typename MultiLinestring, typename CT>
+struct transform_parallel<MultiLinestring, CT, multi_linestring_tag>
+    : transform_parallel_ranges<CT>
+{};
+
+template <typename Ring, typename CT>
+struct transform_parallel<Ring, CT, ring_tag>
+    : transform_parallel_ranges<CT>
+{};
+
+template <typename Polygon, typename CT>
+struct transform_parallel<Polygon, CT, polygon_tag>
+    : transform_parallel_ranges<CT>
+{};
+
+template <typename MultiPolygon, typename CT>
+struct transform_parallel<MultiPolygon, CT, multi_polygon_tag>
+    : transform_parallel_ranges<CT>
+{};
+
+
 }} // namespace projections::detail
     
 namespace srs
@@ -697,6 +927,86 @@ public:
                          grids.src_grids);
     }
 
+    /*!
+        \brief Forward transformation of a geometry using the specified
+            number of threads, 0 meaning as many as the hardware supports
+        \details Points of multi geometries, polygons and long ranges are
+            divided between threads. The result, including the invalid
+            points, is the same as the result of the sequential version.
+            Ranges of points have to be random access ranges.
+    */
+    template <typename GeometryIn, typename GeometryOut>
+    bool forward(GeometryIn const& in, GeometryOut & out,
+                 std::size_t threads) const
+    {
+        return forward(in, out, transformation_grids<detail::empty_grids_storage>(),
+                       threads);
+    }
+
+    /*!
+        \brief Inverse transformation of a geometry using the specified
+            number of threads, 0 meaning as many as the hardware supports
+    */
+    template <typename GeometryIn, typename GeometryOut>
+    bool inverse(GeometryIn const& in, GeometryOut & out,
+                 std::size_t threads) const
+    {
+        return inverse(in, out, transformation_grids<detail::empty_grids_storage>(),
+                       threads);
+    }
+
+    /*!
+        \brief Forward transformation of a geometry using grids and the
+            specified number of threads
+        \details Standard grids used by the transformation are loaded
+            before the threads are started.
+    */
+    template <typename GeometryIn, typename GeometryOut, typename GridsStorage>
+    bool forward(GeometryIn const& in, GeometryOut & out,
+                 transformation_grids<GridsStorage> const& grids,
+                 std::size_t threads) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (GeometryIn, GeometryOut));
+
+        return projections::detail::transform_parallel
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(m_proj1.proj(), m_proj1.proj().params(),
+                         m_proj2.proj(), m_proj2.proj().params(),
+                         in, out,
+                         grids.src_grids,
+                         grids.dst_grids,
+                         threads);
+    }
+
+    /*!
+        \brief Inverse transformation of a geometry using grids and the
+            specified number of threads
+    */
+    template <typename GeometryIn, typename GeometryOut, typename GridsStorage>
+    bool inverse(GeometryIn const& in, GeometryOut & out,
+                 transformation_grids<GridsStorage> const& grids,
+                 std::size_t threads) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (GeometryIn, GeometryOut));
+
+        return projections::detail::transform_parallel
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(m_proj2.proj(), m_proj2.proj().params(),
+                         m_proj1.proj(), m_proj1.proj().params(),
+                         in, out,
+                         grids.dst_grids,
+                         grids.src_grids,
+                         threads);
+    }
+
     template <typename GridsStorage>
     inline transformation_grids<GridsStorage> initialize_grids(GridsStorage & grids_storage) const
     {
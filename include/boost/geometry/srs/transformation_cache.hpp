@@ -0,0 +1,146 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_TRANSFORMATION_CACHE_HPP
+#define BOOST_GEOMETRY_SRS_TRANSFORMATION_CACHE_HPP
+
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <boost/geometry/srs/projections/epsg_params.hpp>
+#include <boost/geometry/srs/projections/esri_params.hpp>
+#include <boost/geometry/srs/projections/iau2000_params.hpp>
+#include <boost/geometry/srs/projections/proj4.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Keys identifying the definitions of coordinate systems in the cache
+
+inline std::string transformation_cache_key(srs::proj4 const& params)
+{
+    return "proj4:" + params.str();
+}
+
+inline std::string transformation_cache_key(srs::epsg const& params)
+{
+    return "epsg:" + boost::lexical_cast<std::string>(params.code);
+}
+
+inline std::string transformation_cache_key(srs::esri const& params)
+{
+    return "esri:" + boost::lexical_cast<std::string>(params.code);
+}
+
+inline std::string transformation_cache_key(srs::iau2000 const& params)
+{
+    return "iau2000:" + boost::lexical_cast<std::string>(params.code);
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+    \brief Thread-safe cache of transformations between dynamic definitions
+    \details Transformations are created from the source and destination
+        definitions (srs::proj4, srs::epsg, srs::esri or srs::iau2000) the
+        first time a pair is requested. Later requests of the same pair
+        return the same immutable transformation, so the definitions are
+        parsed and the projections are created only once. The returned
+        transformations can be used concurrently by many threads and stay
+        valid after the cache is cleared or destroyed.
+        Proj4 definitions are compared as strings.
+    \ingroup projection
+    \tparam CT calculation type used internally
+*/
+template <typename CT = double>
+class transformation_cache
+{
+public:
+    typedef srs::transformation<srs::dynamic, srs::dynamic, CT> transformation_type;
+    typedef boost::shared_ptr<transformation_type const> transformation_ptr;
+
+    /*!
+        \brief Returns the transformation from src to dst, creating it
+            if it is not in the cache yet
+        \details Exceptions thrown for invalid definitions are propagated,
+            nothing is cached in this case.
+    */
+    template <typename Parameters1, typename Parameters2>
+    transformation_ptr get(Parameters1 const& src, Parameters2 const& dst)
+    {
+        key_type const key(detail::transformation_cache_key(src),
+                           detail::transformation_cache_key(dst));
+
+        {
+            boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+            typename map_type::const_iterator it = m_map.find(key);
+            if (it != m_map.end())
+            {
+                return it->second;
+            }
+        }
+
+        // Create outside of the lock, other pairs can be accessed meanwhile
+        transformation_ptr const created(new transformation_type(src, dst));
+
+        boost::unique_lock<boost::shared_mutex> lock(m_mutex);
+        // Another thread could create the same pair in the meantime
+        std::pair<typename map_type::iterator, bool> const inserted
+            = m_map.insert(typename map_type::value_type(key, created));
+        return inserted.first->second;
+    }
+
+    std::size_t size() const
+    {
+        boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+        return m_map.size();
+    }
+
+    bool empty() const
+    {
+        boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+        return m_map.empty();
+    }
+
+    void clear()
+    {
+        boost::unique_lock<boost::shared_mutex> lock(m_mutex);
+        m_map.clear();
+    }
+
+private:
+    typedef std::pair<std::string, std::string> key_type;
+    typedef std::map<key_type, transformation_ptr> map_type;
+
+    map_type m_map;
+    mutable boost::shared_mutex m_mutex;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_TRANSFORMATION_CACHE_HPP
@@ -0,0 +1,413 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_AGNOSTIC_HULL_AKL_TOUSSAINT_HPP
+#define BOOST_GEOMETRY_STRATEGIES_AGNOSTIC_HULL_AKL_TOUSSAINT_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/for_each_range.hpp>
+#include <boost/geometry/algorithms/detail/parallel.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/policies/compare.hpp>
+#include <boost/geometry/strategies/agnostic/hull_graham_andrew.hpp>
+#include <boost/geometry/strategies/side.hpp>
+#include <boost/geometry/views/detail/range_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace convex_hull
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Ranges smaller than this are handled on the calling thread
+static std::size_t const akl_toussaint_min_chunk_size = 1 << 16;
+
+
+// The four extreme points of the Akl-Toussaint heuristic. Left and right
+// are also the end points of the lower and upper half hull, so they are
+// defined with the same predicates as in graham_andrew.
+template <typename Point>
+struct extreme_quadrilateral
+{
+    Point left, bottom, right, top;
+    bool empty;
+
+    inline extreme_quadrilateral()
+        : empty(true)
+    {}
+
+    inline void add(extreme_quadrilateral const& other)
+    {
+        if (other.empty)
+        {
+            return;
+        }
+        if (empty)
+        {
+            *this = other;
+            return;
+        }
+
+        geometry::less<Point> less;
+        geometry::greater<Point> greater;
+        geometry::less<Point, 1> less_y;
+        geometry::greater<Point, 1> greater_y;
+
+        if (less(other.left, left)) { left = other.left; }
+        if (greater(other.right, right)) { right = other.right; }
+        if (less_y(other.bottom, bottom)) { bottom = other.bottom; }
+        if (greater_y(other.top, top)) { top = other.top; }
+    }
+
+    template <typename Iterator>
+    inline void add(Iterator first, Iterator last)
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        geometry::less<Point> less;
+        geometry::greater<Point> greater;
+        geometry::less<Point, 1> less_y;
+        geometry::greater<Point, 1> greater_y;
+
+        Iterator left_it = first, right_it = first;
+        Iterator bottom_it = first, top_it = first;
+        for (Iterator it = first + 1; it != last; ++it)
+        {
+            if (less(*it, *left_it)) { left_it = it; }
+            if (greater(*it, *right_it)) { right_it = it; }
+            if (less_y(*it, *bottom_it)) { bottom_it = it; }
+            if (greater_y(*it, *top_it)) { top_it = it; }
+        }
+
+        extreme_quadrilateral chunk;
+        chunk.left = *left_it;
+        chunk.right = *right_it;
+        chunk.bottom = *bottom_it;
+        chunk.top = *top_it;
+        chunk.empty = false;
+        add(chunk);
+    }
+};
+
+
+template <typename Point, typename SideStrategy, typename Container>
+struct quadrilateral_filter
+{
+    typedef extreme_quadrilateral<Point> quadrilateral_type;
+
+    quadrilateral_type const& quadrilateral;
+
+    inline quadrilateral_filter(quadrilateral_type const& q)
+        : quadrilateral(q)
+    {}
+
+    // Appends the points of [first, last) which are not strictly inside
+    // the quadrilateral to either lower or upper. Points on the line
+    // left-right are never part of the hull and are skipped as well.
+    template <typename Iterator>
+    inline void apply(Iterator first, Iterator last,
+                      Container& lower, Container& upper) const
+    {
+        quadrilateral_type const& q = quadrilateral;
+        for (Iterator it = first; it != last; ++it)
+        {
+            int const dir = SideStrategy::apply(q.left, q.right, *it);
+            if (dir == 1)
+            {
+                if (SideStrategy::apply(q.right, q.top, *it) != 1
+                    || SideStrategy::apply(q.top, q.left, *it) != 1)
+                {
+                    upper.push_back(*it);
+                }
+            }
+            else if (dir == -1)
+            {
+                if (SideStrategy::apply(q.left, q.bottom, *it) != 1
+                    || SideStrategy::apply(q.bottom, q.right, *it) != 1)
+                {
+                    lower.push_back(*it);
+                }
+            }
+        }
+    }
+};
+
+
+template <typename Iterator, typename Point>
+struct quadrilateral_chunk
+{
+    Iterator first;
+    std::vector<extreme_quadrilateral<Point> >& result;
+
+    inline quadrilateral_chunk(Iterator f,
+                               std::vector<extreme_quadrilateral<Point> >& r)
+        : first(f)
+        , result(r)
+    {}
+
+    inline void operator()(std::size_t index,
+                           std::size_t begin, std::size_t end) const
+    {
+        result[index].add(first + begin, first + end);
+    }
+};
+
+
+template <typename Iterator, typename Filter, typename Container>
+struct filter_chunk
+{
+    Iterator first;
+    Filter const& filter;
+    std::vector<Container>& lower;
+    std::vector<Container>& upper;
+
+    inline filter_chunk(Iterator f, Filter const& flt,
+                        std::vector<Container>& l, std::vector<Container>& u)
+        : first(f)
+        , filter(flt)
+        , lower(l)
+        , upper(u)
+    {}
+
+    inline void operator()(std::size_t index,
+                           std::size_t begin, std::size_t end) const
+    {
+        filter.apply(first + begin, first + end, lower[index], upper[index]);
+    }
+};
+
+
+template <typename Container>
+inline void append_all(Container& target, std::vector<Container> const& parts)
+{
+    std::size_t count = target.size();
+    for (std::size_t i = 0; i < parts.size(); i++)
+    {
+        count += parts[i].size();
+    }
+    target.reserve(count);
+    for (std::size_t i = 0; i < parts.size(); i++)
+    {
+        target.insert(target.end(), parts[i].begin(), parts[i].end());
+    }
+}
+
+
+template <typename Point>
+struct get_quadrilateral
+{
+    extreme_quadrilateral<Point> result;
+    std::size_t thread_count;
+
+    inline explicit get_quadrilateral(std::size_t threads)
+        : thread_count(threads)
+    {}
+
+    template <typename Range>
+    inline void apply(Range const& range)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+
+        std::size_t const size = boost::size(range);
+        std::size_t const chunks = geometry::detail::parallel::chunk_count(
+                size, thread_count, akl_toussaint_min_chunk_size);
+
+        std::vector<extreme_quadrilateral<Point> > parts(chunks);
+        geometry::detail::parallel::for_each_chunk(size, chunks, thread_count,
+            quadrilateral_chunk<iterator, Point>(boost::begin(range), parts));
+
+        for (std::size_t i = 0; i < parts.size(); i++)
+        {
+            result.add(parts[i]);
+        }
+    }
+};
+
+
+template <typename Point, typename SideStrategy, typename Container>
+struct assign_filtered
+{
+    typedef quadrilateral_filter<Point, SideStrategy, Container> filter_type;
+
+    filter_type filter;
+    std::size_t thread_count;
+    Container lower_points, upper_points;
+
+    inline assign_filtered(extreme_quadrilateral<Point> const& q,
+                           std::size_t threads)
+        : filter(q)
+        , thread_count(threads)
+    {}
+
+    template <typename Range>
+    inline void apply(Range const& range)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+
+        std::size_t const size = boost::size(range);
+        std::size_t const chunks = geometry::detail::parallel::chunk_count(
+                size, thread_count, akl_toussaint_min_chunk_size);
+
+        if (chunks <= 1)
+        {
+            filter.apply(boost::begin(range), boost::end(range),
+                         lower_points, upper_points);
+            return;
+        }
+
+        std::vector<Container> lower(chunks), upper(chunks);
+        geometry::detail::parallel::for_each_chunk(size, chunks, thread_count,
+            filter_chunk<iterator, filter_type, Container>(boost::begin(range),
+                                                           filter, lower, upper));
+        append_all(lower_points, lower);
+        append_all(upper_points, upper);
+    }
+};
+
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Convex hull strategy using the Akl-Toussaint heuristic and
+    Andrew's monotone chain, sorting in parallel
+\ingroup strategies
+\details First the points with minimal and maximal x and y coordinates are
+    found. All points strictly inside the quadrilateral formed by them can
+    not be part of the hull and are dropped, for uniformly distributed
+    input this is nearly all of them. The remaining points are sorted and
+    the hull is built as in graham_andrew, which gives the same output.
+    Both passes over the input and the sort are divided over the specified
+    number of threads, if the compiler supports them.
+\tparam InputGeometry \tparam_geometry
+\tparam OutputPoint point type of the output hull
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.convex_hull.convex_hull_2_with_strategy convex_hull (with strategy)]
+}
+ */
+template <typename InputGeometry, typename OutputPoint>
+class akl_toussaint
+{
+public :
+    typedef OutputPoint point_type;
+    typedef InputGeometry geometry_type;
+
+private:
+
+    typedef typename cs_tag<point_type>::type cs_tag;
+    typedef typename strategy::side::services::default_strategy
+        <
+            cs_tag
+        >::type side_strategy_type;
+
+    typedef typename std::vector<point_type> container_type;
+
+
+    class partitions
+    {
+        friend class akl_toussaint;
+
+        container_type m_lower_hull;
+        container_type m_upper_hull;
+    };
+
+
+public:
+    typedef partitions state_type;
+
+    /*!
+    \brief Constructor
+    \param thread_count number of threads to use, 0 for as many as the
+        hardware supports. Defaults to 1 (no threads)
+    */
+    explicit inline akl_toussaint(std::size_t thread_count = 1)
+        : m_thread_count(thread_count)
+    {}
+
+    inline void apply(InputGeometry const& geometry, partitions& state) const
+    {
+        // First pass: get the extreme points
+        detail::get_quadrilateral<point_type> extremes(m_thread_count);
+        geometry::detail::for_each_range(geometry, extremes);
+
+        if (extremes.result.empty)
+        {
+            return;
+        }
+
+        // Second pass: assign all points outside the quadrilateral
+        // to either lower or upper
+        detail::assign_filtered
+            <
+                point_type,
+                side_strategy_type,
+                container_type
+            > assigner(extremes.result, m_thread_count);
+        geometry::detail::for_each_range(geometry, assigner);
+
+        geometry::less<point_type> const less;
+        geometry::detail::parallel::sort(assigner.lower_points.begin(),
+                assigner.lower_points.end(), less, m_thread_count);
+        geometry::detail::parallel::sort(assigner.upper_points.begin(),
+                assigner.upper_points.end(), less, m_thread_count);
+
+        detail::build_half_hull<-1, side_strategy_type>(assigner.lower_points,
+                state.m_lower_hull, extremes.result.left, extremes.result.right);
+        detail::build_half_hull<1, side_strategy_type>(assigner.upper_points,
+                state.m_upper_hull, extremes.result.left, extremes.result.right);
+    }
+
+    template <typename OutputIterator>
+    inline void result(partitions const& state,
+                       OutputIterator out,
+                       bool clockwise,
+                       bool closed) const
+    {
+        if (state.m_lower_hull.empty())
+        {
+            return;
+        }
+
+        if (clockwise)
+        {
+            detail::output_ranges(state.m_upper_hull, state.m_lower_hull, out, closed);
+        }
+        else
+        {
+            detail::output_ranges(state.m_lower_hull, state.m_upper_hull, out, closed);
+        }
+    }
+
+private:
+    std::size_t m_thread_count;
+};
+
+
+}} // namespace strategy::convex_hull
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_AGNOSTIC_HULL_AKL_TOUSSAINT_HPP
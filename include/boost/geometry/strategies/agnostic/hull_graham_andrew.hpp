@@ -24,6 +24,10 @@
 
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/range/rbegin.hpp>
+#include <boost/range/rend.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
 
 #include <boost/geometry/algorithms/detail/for_each_range.hpp>
 #include <boost/geometry/core/assert.hpp>
@@ -184,6 +188,75 @@ static inline void sort(Range& range)
     std::sort(boost::begin(range), boost::end(range), comparator());
 }
 
+template <int Factor, typename SideStrategy, typename Container>
+static inline void add_to_hull(typename boost::range_value<Container>::type const& p,
+                               Container& output)
+{
+    typedef typename boost::range_value<Container>::type point_type;
+    typedef typename boost::range_reverse_iterator<Container const>::type rev_iterator;
+
+    output.push_back(p);
+    std::size_t output_size = output.size();
+    while (output_size >= 3)
+    {
+        rev_iterator rit = boost::const_rbegin(output);
+        point_type const last = *rit++;
+        point_type const& last2 = *rit++;
+
+        if (Factor * SideStrategy::apply(*rit, last, last2) <= 0)
+        {
+            // Remove last two points from stack, and add last again
+            // This is much faster then erasing the one but last.
+            output.pop_back();
+            output.pop_back();
+            output.push_back(last);
+            output_size--;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+template <int Factor, typename SideStrategy, typename Container>
+static inline void build_half_hull(Container const& input, Container& output,
+        typename boost::range_value<Container>::type const& left,
+        typename boost::range_value<Container>::type const& right)
+{
+    typedef typename boost::range_iterator<Container const>::type iterator;
+
+    output.push_back(left);
+    for (iterator it = boost::begin(input); it != boost::end(input); ++it)
+    {
+        add_to_hull<Factor, SideStrategy>(*it, output);
+    }
+    add_to_hull<Factor, SideStrategy>(right, output);
+}
+
+template <typename Container, typename OutputIterator>
+static inline void output_ranges(Container const& first, Container const& second,
+                                 OutputIterator out, bool closed)
+{
+    std::copy(boost::begin(first), boost::end(first), out);
+
+    BOOST_GEOMETRY_ASSERT(closed ? !boost::empty(second) : boost::size(second) > 1);
+    std::copy(++boost::rbegin(second), // skip the first Point
+              closed ? boost::rend(second) : --boost::rend(second), // skip the last Point if open
+              out);
+
+    typedef typename boost::range_size<Container>::type size_type;
+    size_type const count = boost::size(first) + boost::size(second) - 1;
+    // count describes a closed case but comparison with min size of closed
+    // gives the result compatible also with open
+    // here core_detail::closure::minimum_ring_size<closed> could be used
+    if (count < 4)
+    {
+        // there should be only one missing
+        *out++ = *boost::begin(first);
+    }
+}
+
 } // namespace detail
 #endif // DOXYGEN_NO_DETAIL
 
@@ -204,8 +277,6 @@ private:
     typedef typename cs_tag<point_type>::type cs_tag;
 
     typedef typename std::vector<point_type> container_type;
-    typedef typename std::vector<point_type>::const_iterator iterator;
-    typedef typename std::vector<point_type>::const_reverse_iterator rev_iterator;
 
 
     class partitions
@@ -274,9 +345,10 @@ public:
         //std::cout << boost::size(assigner.upper_points) << std::endl;
 
         // And decide which point should be in the final hull
-        build_half_hull<-1>(assigner.lower_points, state.m_lower_hull,
+        typedef typename strategy::side::services::default_strategy<cs_tag>::type side;
+        detail::build_half_hull<-1, side>(assigner.lower_points, state.m_lower_hull,
                 extremes.left, extremes.right);
-        build_half_hull<1>(assigner.upper_points, state.m_upper_hull,
+        detail::build_half_hull<1, side>(assigner.upper_points, state.m_upper_hull,
                 extremes.left, extremes.right);
     }
 
@@ -289,81 +361,11 @@ public:
     {
         if (clockwise)
         {
-            output_ranges(state.m_upper_hull, state.m_lower_hull, out, closed);
+            detail::output_ranges(state.m_upper_hull, state.m_lower_hull, out, closed);
         }
         else
         {
-            output_ranges(state.m_lower_hull, state.m_upper_hull, out, closed);
-        }
-    }
-
-
-private:
-
-    template <int Factor>
-    static inline void build_half_hull(container_type const& input,
-            container_type& output,
-            point_type const& left, point_type const& right)
-    {
-        output.push_back(left);
-        for(iterator it = input.begin(); it != input.end(); ++it)
-        {
-            add_to_hull<Factor>(*it, output);
-        }
-        add_to_hull<Factor>(right, output);
-    }
-
-
-    template <int Factor>
-    static inline void add_to_hull(point_type const& p, container_type& output)
-    {
-        typedef typename strategy::side::services::default_strategy<cs_tag>::type side;
-
-        output.push_back(p);
-        std::size_t output_size = output.size();
-        while (output_size >= 3)
-        {
-            rev_iterator rit = output.rbegin();
-            point_type const last = *rit++;
-            point_type const& last2 = *rit++;
-
-            if (Factor * side::apply(*rit, last, last2) <= 0)
-            {
-                // Remove last two points from stack, and add last again
-                // This is much faster then erasing the one but last.
-                output.pop_back();
-                output.pop_back();
-                output.push_back(last);
-                output_size--;
-            }
-            else
-            {
-                return;
-            }
-        }
-    }
-
-
-    template <typename OutputIterator>
-    static inline void output_ranges(container_type const& first, container_type const& second,
-                                     OutputIterator out, bool closed)
-    {
-        std::copy(boost::begin(first), boost::end(first), out);
-
-        BOOST_GEOMETRY_ASSERT(closed ? !boost::empty(second) : boost::size(second) > 1);
-        std::copy(++boost::rbegin(second), // skip the first Point
-                  closed ? boost::rend(second) : --boost::rend(second), // skip the last Point if open
-                  out);
-
-        typedef typename boost::range_size<container_type>::type size_type;
-        size_type const count = boost::size(first) + boost::size(second) - 1;
-        // count describes a closed case but comparison with min size of closed
-        // gives the result compatible also with open
-        // here core_detail::closure::minimum_ring_size<closed> could be used
-        if (count < 4)
-        {
-            // there should be only one missing
-            *out++ = *boost::begin(first);
+            detail::output_ranges(state.m_lower_hull, state.m_upper_hull, out, closed);
         }
     }
 };
@@ -68,16 +68,20 @@ namespace strategy { namespace intersection
 
 /*!
     \see http://mathworld.wolfram.com/Line-LineIntersection.html
+    \tparam CalculationType \tparam_calculation
+    \tparam SideStrategy side strategy used to classify the segments, if it
+        is robust (see side::services::is_robust) overlay does not rescale
  */
 template
 <
-    typename CalculationType = void
+    typename CalculationType = void,
+    typename SideStrategy = side::side_by_triangle<CalculationType>
 >
 struct cartesian_segments
 {
     typedef cartesian_tag cs_tag;
 
-    typedef side::side_by_triangle<CalculationType> side_strategy_type;
+    typedef SideStrategy side_strategy_type;
 
     static inline side_strategy_type get_side_strategy()
     {
@@ -719,6 +723,11 @@ struct default_strategy<cartesian_tag, CalculationType>
     typedef cartesian_segments<CalculationType> type;
 };
 
+template <typename CalculationType, typename SideStrategy>
+struct is_robust<cartesian_segments<CalculationType, SideStrategy> >
+    : side::services::is_robust<SideStrategy>
+{};
+
 } // namespace services
 #endif // DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
 
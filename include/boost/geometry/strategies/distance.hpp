@@ -21,6 +21,7 @@
 
 
 #include <boost/mpl/assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/strategies/tags.hpp>
@@ -65,6 +66,19 @@ template <typename Strategy> struct get_comparable
 template <typename Strategy, typename P1, typename P2>
 struct result_from_distance {};
 
+/*!
+    \brief Traits class indicating if a point-point distance strategy
+        calculates distances of arrays of points with apply_n()
+    \details Algorithms calculating many distances, e.g. length, use it
+        to calculate them together. The results are the same as the
+        results of apply().
+    \ingroup distance
+*/
+template <typename Strategy>
+struct enable_batch
+    : boost::false_type
+{};
+
 
 
 
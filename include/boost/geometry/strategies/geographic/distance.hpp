@@ -17,11 +17,17 @@
 #define BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_DISTANCE_HPP
 
 
+#include <algorithm>
+#include <cstddef>
+
+#include <boost/type_traits/integral_constant.hpp>
+
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/core/radius.hpp>
 
 #include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/batch.hpp>
 #include <boost/geometry/formulas/meridian_inverse.hpp>
 #include <boost/geometry/formulas/flattening.hpp>
 
@@ -125,6 +131,89 @@ public :
         return apply(lon1, lat1, lon2, lat2, m_spheroid);
     }
 
+    /*!
+    \brief Calculates distances between pairs of points given by arrays
+        of coordinates in radians
+    \details Pairs on meridians are calculated one by one, the other pairs
+        are calculated together by the batch version of the formula.
+        The results are the same as the results of apply().
+    */
+    template <typename CT>
+    static inline void apply_n(CT const* lon1, CT const* lat1,
+                               CT const* lon2, CT const* lat2,
+                               std::size_t count,
+                               Spheroid const& spheroid,
+                               CT* distances)
+    {
+        typedef typename formula::meridian_inverse
+                <
+                CT, strategy::default_order<FormulaPolicy>::value
+                > meridian_inverse;
+
+        typedef formula::batch_inverse
+            <
+                typename FormulaPolicy::template inverse
+                    <
+                        CT, true, false, false, false, false
+                    >
+            > batch_inverse;
+
+        typedef typename batch_inverse::result_type result_type;
+
+        static std::size_t const block_size = formula::batch_block_size;
+
+        // Pairs not on meridians of a block and their indexes
+        CT block_lon1[block_size];
+        CT block_lat1[block_size];
+        CT block_lon2[block_size];
+        CT block_lat2[block_size];
+        std::size_t indexes[block_size];
+        result_type results[block_size];
+
+        for (std::size_t first = 0; first < count; first += block_size)
+        {
+            std::size_t const last = (std::min)(first + block_size, count);
+
+            std::size_t n = 0;
+            for (std::size_t i = first; i < last; i++)
+            {
+                typename meridian_inverse::result res =
+                         meridian_inverse::apply(lon1[i], lat1[i], lon2[i], lat2[i], spheroid);
+
+                if (res.meridian)
+                {
+                    distances[i] = res.distance;
+                }
+                else
+                {
+                    block_lon1[n] = lon1[i];
+                    block_lat1[n] = lat1[i];
+                    block_lon2[n] = lon2[i];
+                    block_lat2[n] = lat2[i];
+                    indexes[n] = i;
+                    n++;
+                }
+            }
+
+            batch_inverse::apply(block_lon1, block_lat1, block_lon2, block_lat2,
+                                 n, spheroid, results);
+
+            for (std::size_t j = 0; j < n; j++)
+            {
+                distances[indexes[j]] = results[j].distance;
+            }
+        }
+    }
+
+    template <typename CT>
+    inline void apply_n(CT const* lon1, CT const* lat1,
+                        CT const* lon2, CT const* lat2,
+                        std::size_t count,
+                        CT* distances) const
+    {
+        apply_n(lon1, lat1, lon2, lat2, count, m_spheroid, distances);
+    }
+
     inline Spheroid const& model() const
     {
         return m_spheroid;
@@ -191,6 +280,16 @@ struct get_comparable<geographic<FormulaPolicy, Spheroid, CalculationType> >
     }
 };
 
+template
+<
+    typename FormulaPolicy,
+    typename Spheroid,
+    typename CalculationType
+>
+struct enable_batch<geographic<FormulaPolicy, Spheroid, CalculationType> >
+    : boost::true_type
+{};
+
 template
 <
     typename FormulaPolicy,
@@ -114,6 +114,11 @@ struct result_from_distance<andoyer<Spheroid, CalculationType>, P1, P2>
     }
 };
 
+template <typename Spheroid, typename CalculationType>
+struct enable_batch<andoyer<Spheroid, CalculationType> >
+    : boost::true_type
+{};
+
 
 } // namespace services
 #endif // DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
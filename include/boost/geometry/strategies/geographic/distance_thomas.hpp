@@ -107,6 +107,11 @@ struct result_from_distance<thomas<Spheroid, CalculationType>, P1, P2 >
     }
 };
 
+template <typename Spheroid, typename CalculationType>
+struct enable_batch<thomas<Spheroid, CalculationType> >
+    : boost::true_type
+{};
+
 
 } // namespace services
 #endif // DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
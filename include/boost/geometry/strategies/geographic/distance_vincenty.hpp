@@ -109,6 +109,11 @@ struct result_from_distance<vincenty<Spheroid, CalculationType>, P1, P2 >
     }
 };
 
+template <typename Spheroid, typename CalculationType>
+struct enable_batch<vincenty<Spheroid, CalculationType> >
+    : boost::true_type
+{};
+
 
 } // namespace services
 #endif // DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
@@ -11,6 +11,7 @@
 #define BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_PARAMETERS_HPP
 
 #include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/batch.hpp>
 #include <boost/geometry/formulas/thomas_direct.hpp>
 #include <boost/geometry/formulas/thomas_inverse.hpp>
 #include <boost/geometry/formulas/vincenty_direct.hpp>
@@ -210,7 +211,100 @@ struct default_order<karney>
 {};
 */
 
-}}} // namespace boost::geometry::strategy
+} // namespace strategy
+
+
+namespace formula
+{
+
+// The inverse formulas of the policies are derived from the formulas,
+// the batch versions of the formulas are used for them
+
+template
+<
+    typename CT,
+    bool EnableDistance,
+    bool EnableAzimuth,
+    bool EnableReverseAzimuth,
+    bool EnableReducedLength,
+    bool EnableGeodesicScale
+>
+struct batch_inverse
+    <
+        strategy::andoyer::inverse
+            <
+                CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+                EnableReducedLength, EnableGeodesicScale
+            >
+    >
+    : batch_inverse
+        <
+            andoyer_inverse
+                <
+                    CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+                    EnableReducedLength, EnableGeodesicScale
+                >
+        >
+{};
+
+template
+<
+    typename CT,
+    bool EnableDistance,
+    bool EnableAzimuth,
+    bool EnableReverseAzimuth,
+    bool EnableReducedLength,
+    bool EnableGeodesicScale
+>
+struct batch_inverse
+    <
+        strategy::thomas::inverse
+            <
+                CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+                EnableReducedLength, EnableGeodesicScale
+            >
+    >
+    : batch_inverse
+        <
+            thomas_inverse
+                <
+                    CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+                    EnableReducedLength, EnableGeodesicScale
+                >
+        >
+{};
+
+template
+<
+    typename CT,
+    bool EnableDistance,
+    bool EnableAzimuth,
+    bool EnableReverseAzimuth,
+    bool EnableReducedLength,
+    bool EnableGeodesicScale
+>
+struct batch_inverse
+    <
+        strategy::vincenty::inverse
+            <
+                CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+                EnableReducedLength, EnableGeodesicScale
+            >
+    >
+    : batch_inverse
+        <
+            vincenty_inverse
+                <
+                    CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+                    EnableReducedLength, EnableGeodesicScale
+                >
+        >
+{};
+
+} // namespace formula
+
+
+}} // namespace boost::geometry
 
 
 #endif // BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_PARAMETERS_HPP
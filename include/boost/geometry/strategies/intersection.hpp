@@ -15,6 +15,7 @@
 
 
 #include <boost/mpl/assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 
 namespace boost { namespace geometry
@@ -42,6 +43,17 @@ struct default_strategy
         );
 };
 
+/*!
+\brief Traits class indicating if a segments intersection strategy calculates
+    sides exactly. Overlay does not rescale the input for such strategies.
+\ingroup util
+\tparam Strategy segments intersection strategy
+*/
+template <typename Strategy>
+struct is_robust
+    : boost::false_type
+{};
+
 } // namespace services
 
 }} // namespace strategy::intersection
@@ -21,6 +21,7 @@
 
 
 #include <boost/mpl/assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 #include <boost/geometry/strategies/tags.hpp>
 
@@ -50,6 +51,17 @@ struct default_strategy
         );
 };
 
+/*!
+\brief Traits class indicating if a side strategy calculates the side
+    exactly, for all representable input
+\ingroup util
+\tparam SideStrategy side strategy
+*/
+template <typename SideStrategy>
+struct is_robust
+    : boost::false_type
+{};
+
 
 } // namespace services
 
@@ -97,6 +97,36 @@ void test_all()
             area_strategy,
             1, 0, 3.12566719800474635, ut_settings(1.0));
     }
+
+    {
+        // Dense points with a square hole, most circles are covered by
+        // others and are left out
+        typename bg::strategy::area::services::default_strategy
+            <
+                typename bg::cs_tag<P>::type
+            >::type area_strategy;
+
+        multi_point_type g;
+        for (int i = 0; i < 40; i++)
+        {
+            for (int j = 0; j < 40; j++)
+            {
+                if (i < 10 || i >= 20 || j < 10 || j >= 20)
+                {
+                    bg::append(g, P(i * 0.5 + 0.01 * (j % 3), j * 0.5));
+                }
+            }
+        }
+        bg::model::multi_polygon<polygon> buffered;
+        test_buffer<polygon>("dense_grid", buffered, g,
+            bg::strategy::buffer::join_round(36),
+            bg::strategy::buffer::end_round(36),
+            distance_strategy(1.2),
+            side_strategy,
+            bg::strategy::buffer::point_circle(36),
+            area_strategy,
+            1, 1, 467.7078, ut_settings(0.01));
+    }
 }
 
 template <typename P>
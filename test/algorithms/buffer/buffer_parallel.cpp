@@ -0,0 +1,221 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+
+#include "geometry_test_common.hpp"
+
+#include <boost/geometry/algorithms/buffer.hpp>
+
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+
+// For test
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+
+
+// This unit test tests boost::geometry::buffer (overload with strategies and
+// number of threads) by comparing it with the overload without threads
+
+
+template
+<
+    typename Geometry,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+void test_parallel(std::string const& caseid, Geometry const& geometry,
+                   DistanceStrategy const& distance_strategy,
+                   SideStrategy const& side_strategy,
+                   JoinStrategy const& join_strategy,
+                   EndStrategy const& end_strategy,
+                   PointStrategy const& point_strategy)
+{
+    MultiPolygon expected;
+    bg::buffer(geometry, expected, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy);
+
+    std::size_t const thread_counts[] = { 1, 2, 4, 0 };
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        std::size_t const threads = thread_counts[i];
+        MultiPolygon detected;
+        bg::buffer(geometry, detected, distance_strategy, side_strategy,
+                   join_strategy, end_strategy, point_strategy, threads);
+
+        double const expected_area = bg::area(expected);
+        double const detected_area = bg::area(detected);
+        BOOST_CHECK_MESSAGE
+            (
+                bg::math::abs(expected_area - detected_area)
+                    < 1.0e-6 * expected_area,
+                caseid << " threads: " << threads
+                << std::setprecision(12)
+                << " area expected: " << expected_area
+                << " detected: " << detected_area
+            );
+        BOOST_CHECK_MESSAGE
+            (
+                boost::size(detected) == boost::size(expected),
+                caseid << " threads: " << threads
+                << " count expected: " << boost::size(expected)
+                << " detected: " << boost::size(detected)
+            );
+        BOOST_CHECK_MESSAGE(bg::is_valid(detected),
+            caseid << " threads: " << threads << " result is not valid");
+    }
+}
+
+template <typename Geometry, typename MultiPolygon, typename Strategies>
+void test_parallel(std::string const& caseid, Geometry const& geometry,
+                   Strategies const& s)
+{
+    test_parallel<Geometry, MultiPolygon>(caseid, geometry,
+            s.distance, s.side, s.join, s.end, s.point);
+}
+
+template <typename Point>
+struct buffer_strategies
+{
+    typedef bg::strategy::buffer::distance_symmetric
+        <
+            typename bg::coordinate_type<Point>::type
+        > distance_type;
+
+    explicit buffer_strategies(double d)
+        : distance(d), join(36), end(36), point(36)
+    {}
+
+    distance_type distance;
+    bg::strategy::buffer::side_straight side;
+    bg::strategy::buffer::join_round join;
+    bg::strategy::buffer::end_round end;
+    bg::strategy::buffer::point_circle point;
+};
+
+template <bool Clockwise, typename Point>
+void test_all()
+{
+    typedef bg::model::polygon<Point, Clockwise> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::multi_point<Point> multi_point;
+    typedef bg::model::linestring<Point> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    buffer_strategies<Point> const strategies(1.0);
+
+    // A grid of points, pairs of neighbouring points are closer than twice
+    // the distance and merge, the pairs themselves are apart
+    multi_point mp;
+    for (int i = 0; i < 20; i++)
+    {
+        for (int j = 0; j < 20; j++)
+        {
+            bg::append(mp, Point(i * 6.0, j * 6.0));
+            bg::append(mp, Point(i * 6.0 + 1.5, j * 6.0));
+        }
+    }
+    test_parallel<multi_point, multi_polygon>("grid", mp, strategies);
+
+    // Separate points are all buffered independently, chained points are
+    // buffered in one group
+    multi_point chain;
+    bg::read_wkt("MULTIPOINT((0 0),(1.5 0),(3 0),(4.5 0),(20 0),(40 0))",
+                 chain);
+    test_parallel<multi_point, multi_polygon>("chain", chain, strategies);
+
+    multi_linestring mls;
+    bg::read_wkt("MULTILINESTRING((0 0,10 0,10 10),(12 0,12 10),"
+                 "(30 0,40 0),(50 0,60 10),(60 12,50 20))", mls);
+    test_parallel<multi_linestring, multi_polygon>("lines", mls, strategies);
+
+    multi_polygon mpoly;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0),(1 1,4 1,4 4,1 4,1 1)),"
+                 "((6 0,6 5,11 5,11 0,6 0)),((20 0,20 5,25 5,25 0,20 0)),"
+                 "((40 0,40 5,45 5,45 0,40 0)))", mpoly);
+    bg::correct(mpoly);
+    test_parallel<multi_polygon, multi_polygon>("polygons", mpoly,
+                                                strategies);
+
+    // Deflating polygons keeps them apart
+    test_parallel<multi_polygon, multi_polygon>("deflate", mpoly,
+            buffer_strategies<Point>(-0.25));
+
+    // A long meandering linestring, buffered in chunks
+    linestring ls;
+    for (int i = 0; i < 5000; i++)
+    {
+        double const x = i * 0.5;
+        bg::append(ls, Point(x, 10.0 * std::sin(x / 20.0) + (i % 2) * 0.3));
+    }
+    test_parallel<linestring, multi_polygon>("long", ls, strategies);
+
+    bg::strategy::buffer::join_miter const miter;
+    bg::strategy::buffer::end_flat const flat;
+    typename buffer_strategies<Point>::distance_type const distance(1.0);
+    test_parallel<linestring, multi_polygon>("long_flat", ls,
+            distance, strategies.side, miter, flat, strategies.point);
+
+    // A loop returning to its start at the cut of the first chunk
+    linestring loop;
+    for (int i = 0; i <= 1025; i++)
+    {
+        double const a = 2.0 * bg::math::pi<double>() * i / 1025.0;
+        bg::append(loop, Point(20.0 - 20.0 * std::cos(a), 20.0 * std::sin(a)));
+    }
+    bg::range::back(loop) = bg::range::front(loop);
+    for (int i = 1; i < 1100; i++)
+    {
+        bg::append(loop, Point(-i * 0.5, 0.0));
+    }
+    test_parallel<linestring, multi_polygon>("loop", loop, strategies);
+}
+
+// The end of a looping linestring at the cut of its chunk is a real end at
+// the first point and a cut at the last point
+template <typename Point>
+void test_chunk_end()
+{
+    typedef bg::strategy::buffer::end_round end_type;
+    typedef bg::detail::buffer::chunk_end<end_type, Point> chunk_end_type;
+
+    end_type const end(36);
+    bg::strategy::buffer::distance_symmetric<double> const distance(1.0);
+    Point const origin(0.0, 0.0);
+    chunk_end_type const strategy(end, origin, origin, true, false);
+
+    std::vector<Point> range_out;
+    strategy.apply(Point(-1.0, 0.0), Point(0.0, 1.0), origin, Point(0.0, -1.0),
+                   bg::strategy::buffer::buffer_side_left, distance, range_out);
+    BOOST_CHECK_EQUAL(strategy.get_piece_type(),
+                      bg::strategy::buffer::buffered_flat_end);
+
+    range_out.clear();
+    strategy.apply(Point(0.0, 1.0), Point(-1.0, 0.0), origin, Point(1.0, 0.0),
+                   bg::strategy::buffer::buffer_side_right, distance, range_out);
+    BOOST_CHECK_EQUAL(strategy.get_piece_type(),
+                      bg::strategy::buffer::buffered_round_end);
+}
+
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> dpoint;
+
+    test_all<true, dpoint>();
+    test_all<false, dpoint>();
+    test_chunk_end<dpoint>();
+
+    return 0;
+}
@@ -0,0 +1,301 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <sstream>
+#include <vector>
+
+#include "test_formula.hpp"
+#include "inverse_cases.hpp"
+#include "inverse_cases_antipodal.hpp"
+#include "inverse_cases_small_angles.hpp"
+
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/batch.hpp>
+#include <boost/geometry/formulas/karney_inverse.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+#include <boost/geometry/formulas/vincenty_direct.hpp>
+#include <boost/geometry/formulas/vincenty_inverse.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/spheroid.hpp>
+#include <boost/geometry/strategies/geographic/distance_andoyer.hpp>
+#include <boost/geometry/strategies/geographic/distance_thomas.hpp>
+#include <boost/geometry/strategies/geographic/distance_vincenty.hpp>
+
+
+// This unit test checks that the batch versions of the formulas and the
+// algorithms using them give the same results as the formulas applied
+// to each pair of points
+
+
+struct pairs
+{
+    void add(double lon1_deg, double lat1_deg, double lon2_deg, double lat2_deg)
+    {
+        double const d2r = bg::math::d2r<double>();
+        lon1.push_back(lon1_deg * d2r);
+        lat1.push_back(lat1_deg * d2r);
+        lon2.push_back(lon2_deg * d2r);
+        lat2.push_back(lat2_deg * d2r);
+    }
+
+    std::size_t size() const
+    {
+        return lon1.size();
+    }
+
+    std::vector<double> lon1, lat1, lon2, lat2;
+};
+
+pairs test_pairs()
+{
+    pairs result;
+    for (std::size_t i = 0; i < expected_size; ++i)
+    {
+        result.add(expected[i].p1.lon, expected[i].p1.lat,
+                   expected[i].p2.lon, expected[i].p2.lat);
+    }
+    for (std::size_t i = 0; i < expected_size_antipodal; ++i)
+    {
+        result.add(expected_antipodal[i].p1.lon, expected_antipodal[i].p1.lat,
+                   expected_antipodal[i].p2.lon, expected_antipodal[i].p2.lat);
+    }
+    for (std::size_t i = 0; i < expected_size_small_angles; ++i)
+    {
+        result.add(expected_small_angles[i].p1.lon, expected_small_angles[i].p1.lat,
+                   expected_small_angles[i].p2.lon, expected_small_angles[i].p2.lat);
+    }
+
+    // equal points, poles, meridians and longitudes differing by more than 180
+    result.add(10, 20, 10, 20);
+    result.add(0, 90, 0, 90);
+    result.add(0, 90, 0, -90);
+    result.add(0, -90, 90, 0);
+    result.add(30, 10, 30, 60);
+    result.add(-170, 10, 170, 20);
+    result.add(170, -10, -170, 20);
+    result.add(0, 0, 179.5, 0.5);
+
+    // more pairs than in one block
+    for (int i = 0; i < 150; i++)
+    {
+        result.add(-180 + i * 2.3, -80 + i, 10 - i * 1.1, 40 - i * 0.5);
+    }
+
+    return result;
+}
+
+// The values are the same unless the compiler contracts the operations
+// of the scalar and the batch versions differently (FMA)
+bool same_values(double v1, double v2, double scale = 1.0)
+{
+    double const m = (std::max)(scale, (std::max)(bg::math::abs(v1), bg::math::abs(v2)));
+    return v1 == v2
+        || (v1 != v1 && v2 != v2)
+        || bg::math::abs(v1 - v2) <= 1e-10 * m;
+}
+
+template <typename Inverse>
+void test_inverse(std::string const& name, pairs const& p)
+{
+    typedef typename Inverse::result_type result_type;
+
+    bg::srs::spheroid<double> const spheroid(6378137.0, 6356752.3142451793);
+
+    std::vector<result_type> results(p.size());
+    bg::formula::batch_inverse<Inverse>::apply(&p.lon1[0], &p.lat1[0],
+                                               &p.lon2[0], &p.lat2[0],
+                                               p.size(), spheroid, &results[0]);
+
+    for (std::size_t i = 0; i < p.size(); i++)
+    {
+        result_type const r = Inverse::apply(p.lon1[i], p.lat1[i],
+                                             p.lon2[i], p.lat2[i], spheroid);
+
+        std::stringstream ss;
+        ss << name << " " << i << " (" << p.lon1[i] << " " << p.lat1[i]
+           << ")->(" << p.lon2[i] << " " << p.lat2[i] << ")";
+
+        BOOST_CHECK_MESSAGE(same_values(results[i].distance, r.distance), ss.str() + " distance");
+        BOOST_CHECK_MESSAGE(same_values(results[i].azimuth, r.azimuth), ss.str() + " azimuth");
+        BOOST_CHECK_MESSAGE(same_values(results[i].reverse_azimuth, r.reverse_azimuth), ss.str() + " reverse azimuth");
+        // reduced length of nearly antipodal points is ill-conditioned
+        BOOST_CHECK_MESSAGE(same_values(results[i].reduced_length, r.reduced_length, r.distance), ss.str() + " reduced length");
+        BOOST_CHECK_MESSAGE(same_values(results[i].geodesic_scale, r.geodesic_scale), ss.str() + " geodesic scale");
+    }
+}
+
+void test_formulas()
+{
+    pairs const p = test_pairs();
+
+    test_inverse<bg::formula::vincenty_inverse<double, true, false> >("vincenty_d", p);
+    test_inverse<bg::formula::vincenty_inverse<double, true, true, true> >("vincenty_a", p);
+    test_inverse<bg::formula::vincenty_inverse<double, true, true, true, true, true> >("vincenty", p);
+    test_inverse<bg::formula::thomas_inverse<double, true, false> >("thomas_d", p);
+    test_inverse<bg::formula::thomas_inverse<double, true, true, true, true, true> >("thomas", p);
+    test_inverse<bg::formula::andoyer_inverse<double, true, false> >("andoyer_d", p);
+    test_inverse<bg::formula::andoyer_inverse<double, true, true, true, true, true> >("andoyer", p);
+    test_inverse<bg::formula::karney_inverse<double, true, true, true, true, true> >("karney", p);
+
+    // formulas of the strategies
+    test_inverse<bg::strategy::vincenty::inverse<double, true, false> >("policy_vincenty", p);
+    test_inverse<bg::strategy::thomas::inverse<double, true, false> >("policy_thomas", p);
+    test_inverse<bg::strategy::andoyer::inverse<double, true, false> >("policy_andoyer", p);
+
+    // a block of equal points only, which are not iterated
+    pairs equal;
+    for (int i = 0; i < 10; i++)
+    {
+        equal.add(i * 10.0, i * 5.0, i * 10.0, i * 5.0);
+    }
+    test_inverse<bg::formula::vincenty_inverse<double, true, true, true, true, true> >("vincenty_equal", equal);
+}
+
+void test_direct()
+{
+    typedef bg::formula::vincenty_direct<double, true, true> direct_type;
+
+    bg::srs::spheroid<double> const spheroid;
+
+    double const lon1[] = { 0.1, -1.2, 2.5 };
+    double const lat1[] = { 0.5, 0.2, -1.1 };
+    double const distance[] = { 1000.0, 250000.0, 7000000.0 };
+    double const azimuth[] = { 0.3, -2.0, 1.5 };
+
+    direct_type::result_type results[3];
+    bg::formula::batch_direct<direct_type>::apply(lon1, lat1, distance, azimuth,
+                                                  3, spheroid, results);
+
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        direct_type::result_type const r = direct_type::apply(lon1[i], lat1[i],
+                                                              distance[i], azimuth[i],
+                                                              spheroid);
+        BOOST_CHECK_EQUAL(results[i].lon2, r.lon2);
+        BOOST_CHECK_EQUAL(results[i].lat2, r.lat2);
+        BOOST_CHECK_EQUAL(results[i].reverse_azimuth, r.reverse_azimuth);
+    }
+}
+
+template <typename Strategy>
+void test_strategy(std::string const& name, Strategy const& strategy)
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+    typedef bg::model::multi_point<point_type> multi_point_type;
+    typedef bg::model::ring<point_type> ring_type;
+    typedef typename bg::default_length_result<linestring_type>::type length_type;
+
+    pairs const p = test_pairs();
+
+    // apply_n gives the same results as apply, also for meridians
+    std::vector<double> distances(p.size());
+    strategy.apply_n(&p.lon1[0], &p.lat1[0], &p.lon2[0], &p.lat2[0],
+                     p.size(), &distances[0]);
+    for (std::size_t i = 0; i < p.size(); i++)
+    {
+        double const d = strategy.apply(p.lon1[i], p.lat1[i], p.lon2[i], p.lat2[i],
+                                        strategy.model());
+        BOOST_CHECK_MESSAGE(same_values(distances[i], d),
+                            name << " apply_n " << i << " " << distances[i] << " " << d);
+    }
+
+    // A track with segments along meridians and degenerated segments
+    linestring_type track;
+    for (int i = 0; i < 1000; i++)
+    {
+        double const lon = 15.0 + (i / 10) * 0.01;
+        double const lat = 50.0 + i * 0.0013 + ((i % 7 == 0) ? 0.001 : 0.0);
+        bg::append(track, point_type(lon, lat));
+        if (i % 50 == 0)
+        {
+            bg::append(track, point_type(lon, lat));
+        }
+    }
+
+    length_type expected_length = 0;
+    for (std::size_t i = 1; i < track.size(); i++)
+    {
+        expected_length += strategy.apply(track[i - 1], track[i]);
+    }
+    BOOST_CHECK(same_values(bg::length(track, strategy), expected_length));
+
+    multi_linestring_type mtrack;
+    mtrack.push_back(track);
+    mtrack.push_back(linestring_type(track.begin(), track.begin() + 3));
+    length_type expected_multi_length = expected_length;
+    expected_multi_length += strategy.apply(track[0], track[1]);
+    expected_multi_length += strategy.apply(track[1], track[2]);
+    BOOST_CHECK(same_values(bg::length(mtrack, strategy), expected_multi_length));
+
+    // Perimeter of an open ring, the closing segment is included
+    ring_type ring;
+    bg::append(ring, point_type(0, 0));
+    bg::append(ring, point_type(1, 0));
+    bg::append(ring, point_type(1, 1));
+    bg::append(ring, point_type(0, 1));
+    bg::append(ring, point_type(0, 0));
+    length_type expected_perimeter = 0;
+    for (std::size_t i = 1; i < ring.size(); i++)
+    {
+        expected_perimeter += strategy.apply(ring[i - 1], ring[i]);
+    }
+    BOOST_CHECK(same_values(bg::perimeter(ring, strategy), expected_perimeter));
+
+    // Point to multi point
+    multi_point_type mpoint(track.begin(), track.end());
+    point_type const pt(15.3, 50.7);
+    double expected_distance = strategy.apply(pt, mpoint[0]);
+    for (std::size_t i = 1; i < mpoint.size(); i++)
+    {
+        expected_distance = (std::min)(expected_distance, strategy.apply(pt, mpoint[i]));
+    }
+    BOOST_CHECK(same_values(bg::distance(pt, mpoint, strategy), expected_distance));
+    BOOST_CHECK(same_values(bg::distance(mpoint, pt, strategy), expected_distance));
+    BOOST_CHECK(bg::distance(track[500], mpoint, strategy) < 1e-6);
+}
+
+void test_strategies()
+{
+    typedef bg::srs::spheroid<double> spheroid_type;
+
+    test_strategy("andoyer", bg::strategy::distance::andoyer<spheroid_type>());
+    test_strategy("thomas", bg::strategy::distance::thomas<spheroid_type>());
+    test_strategy("vincenty", bg::strategy::distance::vincenty<spheroid_type>());
+    test_strategy("geographic", bg::strategy::distance::geographic<>());
+    test_strategy("andoyer_grs80",
+        bg::strategy::distance::andoyer<spheroid_type>(
+            spheroid_type(6378137.0, 6356752.3141403561)));
+
+    // default strategy
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    bg::model::linestring<point_type> line;
+    bg::append(line, point_type(0, 0));
+    bg::append(line, point_type(1, 1));
+    bg::append(line, point_type(2, 1));
+    bg::strategy::distance::andoyer<spheroid_type> const andoyer;
+    bg::default_length_result<bg::model::linestring<point_type> >::type
+        expected_length = 0;
+    expected_length += andoyer.apply(line[0], line[1]);
+    expected_length += andoyer.apply(line[1], line[2]);
+    BOOST_CHECK(same_values(bg::length(line), expected_length));
+}
+
+int test_main(int, char*[])
+{
+    test_formulas();
+    test_direct();
+    test_strategies();
+
+    return 0;
+}
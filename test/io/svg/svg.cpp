@@ -13,6 +13,7 @@
 #include <fstream>
 #endif
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
@@ -28,6 +29,7 @@
 
 #include <boost/geometry/io/svg/svg_mapper.hpp>
 #include <boost/geometry/io/svg/write.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
 
 #include <boost/geometry/strategies/strategies.hpp>
 
@@ -144,11 +146,126 @@ void test_all()
     }
 }
 
+template <typename P>
+void test_streaming()
+{
+    typedef bg::model::box<P> box;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_point<P> multi_point;
+
+    std::stringstream os;
+    {
+        bg::svg_mapper<P> mapper(os, 100, 100);
+        mapper.streaming(box(P(0, 0), P(100, 100)));
+
+        // Ignored in streaming mode
+        mapper.add(P(1000, 1000));
+
+        linestring ls;
+        bg::read_wkt("LINESTRING(10 10,10.2 10.1,50 50)", ls);
+        mapper.map(ls, "a");
+
+        bg::read_wkt("LINESTRING(200 200,300 300)", ls);
+        mapper.map(ls, "b");
+
+        // Collapses to one pixel
+        bg::read_wkt("LINESTRING(20 20,20.1 20.1)", ls);
+        mapper.map(ls, "c");
+
+        // The hole collapses to a line of pixels
+        polygon po;
+        bg::read_wkt("POLYGON((10 10,10 50,50 50,50 10,10 10),"
+                     "(20 20,20.1 20,20.1 20.1,20 20))", po);
+        mapper.map(po, "d");
+
+        multi_point mp;
+        bg::read_wkt("MULTIPOINT((-50 -50),(30 30))", mp);
+        mapper.map(mp, "e", 2);
+
+        // Vertices of a long linestring within one pixel
+        linestring zigzag;
+        for (int i = 0; i < 100000; i++)
+        {
+            zigzag.push_back(P(60 + (i % 2) * 0.1, 60 + (i % 3) * 0.1));
+        }
+        mapper.map(zigzag, "f");
+
+        // Rings collapsing to two pixels, written as polygon or as ring
+        bg::read_wkt("POLYGON((70 70,80 80,70.1 70.1,70 70))", po);
+        mapper.map(po, "g");
+        mapper.map(bg::exterior_ring(po), "h");
+    }
+
+    std::string const svg = os.str();
+    BOOST_CHECK(svg.find("<polyline points=\"10,90 50,50\" style=\"a;fill:none\"/>")
+                != std::string::npos);
+    BOOST_CHECK(svg.find("style=\"b") == std::string::npos);
+    BOOST_CHECK(svg.find("style=\"c") == std::string::npos);
+    BOOST_CHECK(svg.find("<g fill-rule=\"evenodd\"><path d=\"M 10,90 L 10,50 50,50 50,90 z\""
+                         " style=\"d\"/></g>")
+                != std::string::npos);
+    BOOST_CHECK(svg.find("<circle cx=\"30\" cy=\"70\" r=\"2\" style=\"e\"/>")
+                != std::string::npos);
+    BOOST_CHECK(svg.find("cx=\"-50\"") == std::string::npos);
+    BOOST_CHECK(svg.find("style=\"f") == std::string::npos);
+    BOOST_CHECK(svg.find("style=\"g") == std::string::npos);
+    BOOST_CHECK(svg.find("style=\"h") == std::string::npos);
+    BOOST_CHECK(svg.size() < 1000);
+}
+
+// A dense zig-zag wobbling across pixel boundaries is written with a number
+// of points bounded by the pixels it touches
+template <typename P>
+void test_streaming_zigzag()
+{
+    typedef bg::model::box<P> box;
+    typedef bg::model::linestring<P> linestring;
+
+    linestring zigzag;
+    for (int i = 0; i < 100000; i++)
+    {
+        // 80 pixels long, wobbling 0.6 pixel around a pixel boundary
+        zigzag.push_back(P(10 + i * 0.0008, 50.5 + ((i % 2) == 0 ? -0.3 : 0.3)));
+    }
+    linestring vertical;
+    for (int i = 0; i <= 100000; i++)
+    {
+        vertical.push_back(P(5, 10 + i * 0.0008));
+    }
+
+    std::stringstream os;
+    {
+        bg::svg_mapper<P> mapper(os, 100, 100);
+        mapper.streaming(box(P(0, 0), P(100, 100)));
+        mapper.map(zigzag, "z");
+        mapper.map(vertical, "v");
+    }
+
+    std::string const svg = os.str();
+    std::string::size_type const begin = svg.find("<polyline points=\"");
+    std::string::size_type const end = svg.find("\" style=\"z");
+    BOOST_CHECK(begin != std::string::npos && end != std::string::npos);
+    if (begin != std::string::npos && end != std::string::npos)
+    {
+        std::string const points = svg.substr(begin, end - begin);
+        std::size_t const count = std::count(points.begin(), points.end(), ',');
+        BOOST_CHECK_MESSAGE(count <= 2 * 81, "points: " << count);
+    }
+
+    // A straight line is written with its ends
+    BOOST_CHECK(svg.find("<polyline points=\"5,90 5,10\" style=\"v;fill:none\"/>")
+                != std::string::npos);
+}
+
 int test_main(int, char* [])
 {
     test_all< boost::geometry::model::d2::point_xy<double> >();
     test_all< boost::geometry::model::d2::point_xy<int> >();
 
+    test_streaming< boost::geometry::model::d2::point_xy<double> >();
+    test_streaming_zigzag< boost::geometry::model::d2::point_xy<double> >();
+
 #if defined(HAVE_TTMATH)
     test_all< boost::geometry::model::d2::point_xy<ttmath_big> >();
 #endif
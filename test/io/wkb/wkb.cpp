@@ -0,0 +1,290 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/variant/variant.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/io.hpp>
+#include <boost/geometry/io/wkb/wkb.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point2d;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d;
+typedef bg::model::point<double, 4, bg::cs::cartesian> point4d;
+
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << std::setprecision(17) << bg::wkt(geometry);
+    return out.str();
+}
+
+std::vector<boost::uint8_t> from_hex(std::string const& hex)
+{
+    std::vector<boost::uint8_t> result;
+    BOOST_CHECK(bg::hex2wkb(hex, std::back_inserter(result)));
+    return result;
+}
+
+std::string to_hex(std::vector<boost::uint8_t> const& wkb)
+{
+    std::string result;
+    bg::wkb2hex(wkb.begin(), wkb.end(), result);
+    boost::algorithm::to_lower(result);
+    return result;
+}
+
+// Reads the hex WKB and checks it against WKT, then writes it back in all
+// byte orders and reads it again
+template <typename Geometry>
+void test_read(std::string const& hex, std::string const& wkt,
+               boost::uint32_t expected_srid = 0)
+{
+    std::vector<boost::uint8_t> const wkb = from_hex(hex);
+
+    Geometry geometry;
+    boost::uint32_t srid = 1;
+    BOOST_CHECK_MESSAGE(bg::read_wkb(wkb.begin(), wkb.end(), geometry, srid),
+                        "read_wkb failed for " << hex);
+    BOOST_CHECK_EQUAL(srid, expected_srid);
+
+    Geometry expected;
+    bg::read_wkt(wkt, expected);
+    BOOST_CHECK_EQUAL(to_wkt(geometry), to_wkt(expected));
+
+    bg::wkb_byte_order::enum_t const orders[] = {
+        bg::wkb_byte_order::big_endian,
+        bg::wkb_byte_order::little_endian,
+        bg::wkb_byte_order::native
+    };
+    for (int i = 0; i < 3; i++)
+    {
+        std::vector<boost::uint8_t> written;
+        BOOST_CHECK(bg::write_wkb(geometry, std::back_inserter(written), orders[i]));
+        Geometry read_back;
+        BOOST_CHECK(bg::read_wkb(written.begin(), written.end(), read_back));
+        BOOST_CHECK_EQUAL(to_wkt(read_back), to_wkt(expected));
+
+        written.clear();
+        BOOST_CHECK(bg::write_ewkb(geometry, std::back_inserter(written), 4326, orders[i]));
+        BOOST_CHECK(bg::read_wkb(written.begin(), written.end(), read_back, srid));
+        BOOST_CHECK_EQUAL(srid, 4326u);
+        BOOST_CHECK_EQUAL(to_wkt(read_back), to_wkt(expected));
+    }
+}
+
+template <typename Geometry>
+void test_invalid(std::string const& hex)
+{
+    std::vector<boost::uint8_t> const wkb = from_hex(hex);
+    Geometry geometry;
+    BOOST_CHECK_MESSAGE(! bg::read_wkb(wkb.begin(), wkb.end(), geometry),
+                        "read_wkb should fail for " << hex);
+}
+
+template <typename Geometry>
+void test_write(std::string const& wkt, std::string const& expected_wkb,
+                std::string const& expected_ewkb, boost::uint32_t srid = 0)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    std::vector<boost::uint8_t> wkb;
+    BOOST_CHECK(bg::write_wkb(geometry, std::back_inserter(wkb),
+                              bg::wkb_byte_order::little_endian));
+    BOOST_CHECK_EQUAL(to_hex(wkb), expected_wkb);
+
+    std::vector<boost::uint8_t> ewkb;
+    BOOST_CHECK(bg::write_ewkb(geometry, std::back_inserter(ewkb), srid,
+                               bg::wkb_byte_order::little_endian));
+    BOOST_CHECK_EQUAL(to_hex(ewkb), expected_ewkb);
+}
+
+void test_geometries()
+{
+    typedef bg::model::linestring<point2d> linestring2d;
+    typedef bg::model::polygon<point2d> polygon2d;
+    typedef bg::model::multi_point<point2d> multi_point2d;
+    typedef bg::model::multi_linestring<linestring2d> multi_linestring2d;
+    typedef bg::model::multi_polygon<polygon2d> multi_polygon2d;
+    typedef bg::model::linestring<point3d> linestring3d;
+    typedef bg::model::polygon<point3d> polygon3d;
+    typedef bg::model::multi_polygon<polygon3d> multi_polygon3d;
+
+    // POINT, big and little endian
+    test_read<point2d>("0101000000000000000000f03f0000000000000040", "POINT(1 2)");
+    test_read<point2d>("00000000013ff00000000000004000000000000000", "POINT(1 2)");
+
+    // Z as ISO, as EWKB, ZM
+    test_read<point3d>("01e9030000000000000000f03f00000000000000400000000000000840",
+                       "POINT(1 2 3)");
+    test_read<point3d>("0101000080000000000000f03f00000000000000400000000000000840",
+                       "POINT(1 2 3)");
+    test_read<point4d>("01b90b0000000000000000f03f000000000000004000000000000008400000000000001040",
+                       "POINT(1 2 3 4)");
+
+    // SRID=4326;POINT(1.234 5.678 99) - PostGIS EWKB
+    test_read<point3d>("01010000a0e61000005839b4c876bef33f83c0caa145b616400000000000c05840",
+                       "POINT(1.234 5.678 99)", 4326);
+
+    test_read<linestring2d>("0102000000020000000000000000000000000000000000000000000000"
+                            "0000f03f000000000000f03f",
+                            "LINESTRING(0 0,1 1)");
+    test_read<linestring2d>("010200000000000000", "LINESTRING()");
+
+    test_read<polygon2d>("0103000000020000000400000000000000000000000000000000000000"
+                         "00000000000000000000000000002440000000000000244000000000"
+                         "0000000000000000000000000000000000000000040000000000000000"
+                         "00f03f000000000000f03f000000000000f03f0000000000000040000000"
+                         "0000000040000000000000f03f000000000000f03f000000000000f03f",
+                         "POLYGON((0 0,0 10,10 0,0 0),(1 1,1 2,2 1,1 1))");
+
+    // Elements can have different byte orders
+    test_read<multi_point2d>("0104000000020000000101000000000000000000f03f00000000000000"
+                             "40000000000140000000000000004000000000000000",
+                             "MULTIPOINT((1 2),(2 2))");
+    test_invalid<multi_point2d>("010400000002000000");
+
+    test_read<multi_linestring2d>("010500000001000000010200000002000000000000000000000000"
+                                  "00000000000000000000000000f03f000000000000f03f",
+                                  "MULTILINESTRING((0 0,1 1))");
+
+    test_read<multi_polygon2d>("01060000000100000001030000000100000004000000000000000000"
+                               "000000000000000000000000000000000000000000000000244000"
+                               "000000000024400000000000000000000000000000000000000000"
+                               "00000000",
+                               "MULTIPOLYGON(((0 0,0 10,10 0,0 0)))");
+
+    // Written, ISO and EWKB
+    test_write<point2d>("POINT(1 2)",
+                        "0101000000000000000000f03f0000000000000040",
+                        "0101000000000000000000f03f0000000000000040");
+    test_write<point3d>("POINT(1 2 3)",
+                        "01e9030000000000000000f03f00000000000000400000000000000840",
+                        "01010000a0e6100000000000000000f03f00000000000000400000000000000840",
+                        4326);
+    test_write<point4d>("POINT(1 2 3 4)",
+                        "01b90b0000000000000000f03f000000000000004000000000000008400000000000001040",
+                        "01010000c0000000000000f03f000000000000004000000000000008400000000000001040");
+    test_write<linestring3d>("LINESTRING(1 2 3,4 5 6)",
+                             "01ea03000002000000000000000000f03f00000000000000400000000000000840"
+                             "000000000000104000000000000014400000000000001840",
+                             "010200008002000000000000000000f03f00000000000000400000000000000840"
+                             "000000000000104000000000000014400000000000001840");
+
+    // The SRID is written only in the header of the outermost geometry
+    multi_polygon3d mpoly;
+    bg::read_wkt("MULTIPOLYGON(((0 0 1,0 1 1,1 1 1,0 0 1)),((5 5 2,5 6 2,6 6 2,5 5 2)))",
+                 mpoly);
+    std::vector<boost::uint8_t> ewkb;
+    BOOST_CHECK(bg::write_ewkb(mpoly, std::back_inserter(ewkb), 2180));
+    BOOST_CHECK_EQUAL(to_hex(ewkb).substr(0, 18), "01060000a084080000");
+    BOOST_CHECK_EQUAL(to_hex(ewkb).substr(26, 10), "0103000080");
+    multi_polygon3d mpoly_read;
+    boost::uint32_t srid = 0;
+    BOOST_CHECK(bg::read_wkb(ewkb.begin(), ewkb.end(), mpoly_read, srid));
+    BOOST_CHECK_EQUAL(srid, 2180u);
+    BOOST_CHECK_EQUAL(to_wkt(mpoly_read), to_wkt(mpoly));
+
+    // Storage of the geometry is reused, rings are resized
+    polygon2d poly;
+    bg::read_wkt("POLYGON((0 0,0 9,9 9,9 0,0 0),(1 1,2 1,2 2,1 1),(3 3,4 3,4 4,3 3))", poly);
+    std::vector<boost::uint8_t> wkb;
+    bg::write_wkb(polygon2d(), std::back_inserter(wkb));
+    BOOST_CHECK(bg::read_wkb(wkb.begin(), wkb.end(), poly));
+    BOOST_CHECK_EQUAL(to_wkt(poly), "POLYGON(())");
+    wkb = from_hex("0103000000020000000400000000000000000000000000000000000000"
+                   "00000000000000000000000000002440000000000000244000000000"
+                   "0000000000000000000000000000000000000000040000000000000000"
+                   "00f03f000000000000f03f000000000000f03f0000000000000040000000"
+                   "0000000040000000000000f03f000000000000f03f000000000000f03f");
+    BOOST_CHECK(bg::read_wkb(wkb.begin(), wkb.end(), poly));
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(poly), 1u);
+
+    // Invalid: wrong type, wrong dimension, truncated, wrong byte order
+    test_invalid<linestring2d>("0101000000000000000000f03f0000000000000040");
+    test_invalid<point2d>("01e9030000000000000000f03f00000000000000400000000000000840");
+    test_invalid<point3d>("0101000000000000000000f03f0000000000000040");
+    // XYM, as ISO and as EWKB, is not read into Z
+    test_invalid<point3d>("01d1070000000000000000f03f00000000000000400000000000000840");
+    test_invalid<point3d>("0101000040000000000000f03f00000000000000400000000000000840");
+    test_invalid<point2d>("0101000000000000000000f03f00000000000000");
+    test_invalid<point2d>("0201000000000000000000f03f0000000000000040");
+    test_invalid<linestring2d>("0102000000ffffffff00");
+    test_invalid<polygon2d>("0103000000ffffff7f00");
+}
+
+void test_variant()
+{
+    typedef bg::model::linestring<point2d> linestring2d;
+    typedef bg::model::polygon<point2d> polygon2d;
+    typedef boost::variant<point2d, linestring2d, polygon2d> variant_type;
+
+    variant_type variant;
+    std::vector<boost::uint8_t> wkb = from_hex(
+        "0102000000020000000000000000000000000000000000000000000000"
+        "0000f03f000000000000f03f");
+    BOOST_CHECK(bg::read_wkb(wkb.begin(), wkb.end(), variant));
+    BOOST_CHECK_EQUAL(variant.which(), 1);
+    BOOST_CHECK_EQUAL(to_wkt(variant), "LINESTRING(0 0,1 1)");
+
+    std::vector<boost::uint8_t> written;
+    BOOST_CHECK(bg::write_wkb(variant, std::back_inserter(written),
+                              bg::wkb_byte_order::little_endian));
+    BOOST_CHECK(written == wkb);
+
+    // MULTIPOINT is not an alternative
+    wkb = from_hex("0104000000010000000101000000000000000000f03f0000000000000040");
+    BOOST_CHECK(! bg::read_wkb(wkb.begin(), wkb.end(), variant));
+
+    // GEOMETRYCOLLECTION(POINT(1 2),GEOMETRYCOLLECTION(LINESTRING(0 0,1 1)))
+    std::vector<variant_type> collection;
+    wkb = from_hex(
+        "0107000000020000000101000000000000000000f03f0000000000000040"
+        "010700000001000000010200000002000000000000000000000000000000000000000000000000"
+        "00f03f000000000000f03f");
+    BOOST_CHECK(bg::read_wkb_collection(wkb.begin(), wkb.end(), collection));
+    BOOST_CHECK_EQUAL(collection.size(), 2u);
+    if (collection.size() == 2)
+    {
+        BOOST_CHECK_EQUAL(to_wkt(collection[0]), "POINT(1 2)");
+        BOOST_CHECK_EQUAL(to_wkt(collection[1]), "LINESTRING(0 0,1 1)");
+    }
+}
+
+void test_io()
+{
+    point2d point;
+    bg::read<bg::format_wkb>(point,
+        std::string("\x01\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf0\x3f"
+                    "\x00\x00\x00\x00\x00\x00\x00\x40", 21));
+    BOOST_CHECK_EQUAL(to_wkt(point), "POINT(1 2)");
+    BOOST_CHECK_THROW(bg::read<bg::format_wkb>(point, std::string("\x01\x01", 2)),
+                      bg::read_wkb_exception);
+}
+
+int test_main(int, char* [])
+{
+    test_geometries();
+    test_variant();
+    test_io();
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include <boost/lexical_cast.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+
+
+// This unit test checks the tokenizer and the conversion of the numbers
+// used by read_wkt
+
+
+template <typename T>
+void test_number(std::string const& str)
+{
+    T const expected = boost::lexical_cast<T>(str);
+    T const detected = bg::detail::wkt::coordinate_parser<T>::apply(str);
+    BOOST_CHECK_MESSAGE(detected == expected,
+        str << std::setprecision(20)
+            << " detected: " << detected
+            << " expected: " << expected);
+}
+
+template <typename T>
+void test_invalid_number(std::string const& str)
+{
+    BOOST_CHECK_THROW(bg::detail::wkt::coordinate_parser<T>::apply(str),
+                      boost::bad_lexical_cast);
+}
+
+template <typename T>
+void test_floating_point()
+{
+    test_number<T>("0");
+    test_number<T>("-0");
+    test_number<T>("1");
+    test_number<T>("+1");
+    test_number<T>("-1.5");
+    test_number<T>("0.1");
+    test_number<T>("123.456");
+    test_number<T>("00000123.45600000");
+    test_number<T>(".5");
+    test_number<T>("5.");
+    test_number<T>("1e10");
+    test_number<T>("1E-10");
+    test_number<T>("-2.5e+3");
+    test_number<T>("4.35681218345755");
+    test_number<T>("52.0912823457123");
+    test_number<T>("9007199254740993");
+    test_number<T>("123456789012345678901234567890");
+    test_number<T>("0.1234567890123456789012");
+
+    test_invalid_number<T>("");
+    test_invalid_number<T>("-");
+    test_invalid_number<T>(".");
+    test_invalid_number<T>("1e");
+    test_invalid_number<T>("1..2");
+    test_invalid_number<T>("1x");
+    test_invalid_number<T>("abc");
+}
+
+template <typename T>
+void test_integral()
+{
+    test_number<T>("0");
+    test_number<T>("17");
+    test_number<T>("-17");
+    test_number<T>("2147483647");
+
+    test_invalid_number<T>("2147483648");
+    test_invalid_number<T>("1.5");
+    test_invalid_number<T>("1e3");
+    test_invalid_number<T>("x");
+}
+
+void test_tokenizer()
+{
+    typedef bg::detail::wkt::tokenizer tokenizer;
+
+    std::string const wkt = "POLYGON\t((0 0,\n0 1 ,1 1,  1 0,0 0)) ";
+    tokenizer tokens(wkt);
+
+    std::ostringstream out;
+    std::size_t count = 0;
+    for (tokenizer::iterator it = tokens.begin(); it != tokens.end(); ++it)
+    {
+        out << std::string(*it) << "|";
+        count++;
+    }
+    BOOST_CHECK_EQUAL(count, 19u);
+    BOOST_CHECK_EQUAL(out.str(),
+        "POLYGON|(|(|0|0|,|0|1|,|1|1|,|1|0|,|0|0|)|)|");
+
+    tokenizer empty("  \t ");
+    BOOST_CHECK(empty.begin() == empty.end());
+}
+
+void test_read()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point;
+    typedef bg::model::point<int, 2, bg::cs::cartesian> ipoint;
+    typedef bg::model::polygon<point> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    // Separators other than spaces
+    polygon poly;
+    bg::read_wkt("POLYGON((0 0,0 7,4 2,2 0,0 0),\n\t(1 1,2 1,1 2,1 1))", poly);
+    BOOST_CHECK_EQUAL(bg::num_points(poly), 9u);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(poly), 1u);
+    BOOST_CHECK_EQUAL(bg::get<0>(bg::interior_rings(poly)[0][1]), 2.0);
+
+    // Coordinates are converted exactly
+    point p;
+    bg::read_wkt("POINT(0.1 -123.456789012345678)", p);
+    BOOST_CHECK_EQUAL(bg::get<0>(p), 0.1);
+    BOOST_CHECK_EQUAL(bg::get<1>(p), -123.456789012345678);
+
+    ipoint ip;
+    bg::read_wkt("POINT(-3 12)", ip);
+    BOOST_CHECK_EQUAL(bg::get<0>(ip), -3);
+    BOOST_CHECK_EQUAL(bg::get<1>(ip), 12);
+
+    // Part of a larger buffer
+    char const buffer[] = "MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)));POINT(1 2)";
+    char const* separator = std::strchr(buffer, ';');
+    multi_polygon mpoly;
+    bg::read_wkt(buffer, separator, mpoly);
+    BOOST_CHECK_EQUAL(boost::size(mpoly), 1u);
+    BOOST_CHECK_EQUAL(bg::num_points(mpoly), 5u);
+    bg::read_wkt(separator + 1, buffer + std::strlen(buffer), p);
+    BOOST_CHECK_EQUAL(bg::get<0>(p), 1.0);
+    BOOST_CHECK_EQUAL(bg::get<1>(p), 2.0);
+
+    // Errors refer to the parsed characters only
+    try
+    {
+        bg::read_wkt(buffer, separator - 1, mpoly);
+        BOOST_CHECK_MESSAGE(false, "exception expected");
+    }
+    catch (bg::read_wkt_exception const& e)
+    {
+        BOOST_CHECK(std::string(e.what()).find("POINT") == std::string::npos);
+    }
+
+    BOOST_CHECK_THROW(bg::read_wkt("POINT(1 x)", p), bg::read_wkt_exception);
+    BOOST_CHECK_THROW(bg::read_wkt("POINT(1 2", p), bg::read_wkt_exception);
+}
+
+int test_main(int, char* [])
+{
+    test_floating_point<double>();
+    test_number<double>("1e300");
+    test_number<double>("2.2250738585072014e-308");
+    test_floating_point<float>();
+    test_integral<int>();
+
+    test_tokenizer();
+    test_read();
+
+    return 0;
+}
@@ -0,0 +1,264 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/variant/variant.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+
+// This unit test checks write_wkt and the formatting of the coordinates
+
+
+template <typename T>
+std::string format(T value)
+{
+    std::string result;
+    bg::detail::wkt::container_sink<std::string> sink(result);
+    bg::detail::wkt::coordinate_formatter<T>::apply(value, sink);
+    return result;
+}
+
+template <typename T>
+void test_format(T value, std::string const& expected)
+{
+    std::string const detected = format(value);
+    BOOST_CHECK_MESSAGE(detected == expected,
+        "detected: " << detected << " expected: " << expected);
+}
+
+// Returns the number of significant digits of a formatted number, without
+// leading and trailing zeros, such that fixed and exponent notation can be
+// compared
+std::size_t significant_digits(std::string const& str)
+{
+    std::string digits;
+    for (std::size_t i = 0; i < str.size() && str[i] != 'e'; i++)
+    {
+        if (str[i] >= '0' && str[i] <= '9')
+        {
+            digits += str[i];
+        }
+    }
+    std::size_t const first = digits.find_first_not_of('0');
+    if (first == std::string::npos)
+    {
+        return 0;
+    }
+    return digits.find_last_not_of('0') + 1 - first;
+}
+
+// The written value is read back as the same value and it has as many
+// digits as the shortest representation with %.*g which is read back
+void test_round_trip(double value)
+{
+    std::string const str = format(value);
+    double const read = std::strtod(str.c_str(), NULL);
+    BOOST_CHECK_MESSAGE(read == value,
+        str << " read: " << std::setprecision(17) << read);
+
+    for (int precision = 1; precision <= 17; precision++)
+    {
+        char buffer[40];
+        std::sprintf(buffer, "%.*g", precision, value);
+        if (std::strtod(buffer, NULL) == value)
+        {
+            BOOST_CHECK_MESSAGE(
+                significant_digits(str) == significant_digits(buffer),
+                str << " shortest: " << buffer);
+            break;
+        }
+    }
+}
+
+void test_round_trip(float value)
+{
+    std::string const str = format(value);
+    float const read = static_cast<float>(std::strtod(str.c_str(), NULL));
+    BOOST_CHECK_MESSAGE(read == value, str);
+}
+
+void test_numbers()
+{
+    test_format(0.0, "0");
+    test_format(-0.0, "-0");
+    test_format(1.0, "1");
+    test_format(-1.5, "-1.5");
+    test_format(0.1, "0.1");
+    test_format(0.3, "0.3");
+    test_format(0.1 + 0.2, "0.30000000000000004");
+    test_format(123456.789, "123456.789");
+    test_format(4.35681218345755, "4.35681218345755");
+    test_format(1e21, "1e+21");
+    test_format(1e20, "100000000000000000000");
+    test_format(1.5e-7, "1.5e-7");
+    test_format(0.000001, "0.000001");
+    test_format(1e-100, "1e-100");
+    test_format(5e-324, "5e-324");
+    test_format(2.2250738585072014e-308, "2.2250738585072014e-308");
+    test_format(1.7976931348623157e308, "1.7976931348623157e+308");
+    test_format(std::numeric_limits<double>::infinity(), "inf");
+    test_format(-std::numeric_limits<double>::infinity(), "-inf");
+    test_format(std::numeric_limits<double>::quiet_NaN(), "nan");
+
+    test_format(0.1f, "0.1");
+    test_format(3.4028235e38f, "3.4028235e+38");
+    test_format(1.0e-45f, "1e-45");
+
+    test_format(0, "0");
+    test_format(-123, "-123");
+    test_format((std::numeric_limits<int>::min)(), "-2147483648");
+    test_format((std::numeric_limits<boost::int64_t>::min)(), "-9223372036854775808");
+    test_format((std::numeric_limits<boost::uint64_t>::max)(), "18446744073709551615");
+
+    // Random bit patterns
+    boost::uint64_t state = 88172645463325252ull;
+    for (int i = 0; i < 20000; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        double d;
+        std::memcpy(&d, &state, sizeof(double));
+        if (d == d && d - d == 0)
+        {
+            test_round_trip(d);
+        }
+
+        boost::uint32_t const bits = boost::uint32_t(state >> 16);
+        float f;
+        std::memcpy(&f, &bits, sizeof(float));
+        if (f == f && f - f == 0)
+        {
+            test_round_trip(f);
+        }
+
+        // Coordinates with few decimals
+        double const c = double(boost::int64_t(state % 2000000000)) / 1000.0 - 1000000.0;
+        test_round_trip(c);
+        std::ostringstream out;
+        out << std::setprecision(17) << c;
+        BOOST_CHECK(format(c).size() <= out.str().size());
+    }
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt, std::string const& expected)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    std::string detected = "prefix ";
+    bg::write_wkt(geometry, detected);
+    BOOST_CHECK_EQUAL(detected, "prefix " + expected);
+
+    // The manipulator gives the same result for these coordinates
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    BOOST_CHECK_EQUAL(out.str(), expected);
+
+    boost::variant<Geometry> const variant = geometry;
+    std::vector<char> chars;
+    bg::write_wkt(variant, chars);
+    std::ostringstream variant_out;
+    variant_out << bg::wkt(variant);
+    BOOST_CHECK_EQUAL(std::string(chars.begin(), chars.end()), variant_out.str());
+
+    // Buffers of all sizes
+    std::vector<char> buffer(expected.size() + 2, 'x');
+    for (std::size_t size = 0; size <= buffer.size(); size++)
+    {
+        std::size_t const length = bg::write_wkt(geometry, &buffer[0], size);
+        BOOST_CHECK_EQUAL(length, expected.size());
+        if (size > 0)
+        {
+            std::size_t const written = (std::min)(length, size - 1);
+            BOOST_CHECK_EQUAL(std::strlen(&buffer[0]), written);
+            BOOST_CHECK(std::string(&buffer[0], written) == expected.substr(0, written));
+        }
+    }
+}
+
+template <typename P>
+void test_geometries()
+{
+    test_geometry<P>("POINT(1 2)", "POINT(1 2)");
+    test_geometry<bg::model::linestring<P> >("LINESTRING(1 1,2 2,35 3)",
+        "LINESTRING(1 1,2 2,35 3)");
+    test_geometry<bg::model::polygon<P> >(
+        "POLYGON((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 1))",
+        "POLYGON((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 1))");
+    // Polygons are closed, rings are not
+    test_geometry<bg::model::polygon<P> >("POLYGON((0 0,0 4,4 4,4 0))",
+        "POLYGON((0 0,0 4,4 4,4 0,0 0))");
+    test_geometry<bg::model::ring<P> >("POLYGON((0 0,0 4,4 4,4 0))",
+        "POLYGON((0 0,0 4,4 4,4 0))");
+    test_geometry<bg::model::box<P> >("BOX(0 1,2 3)",
+        "POLYGON((0 1,0 3,2 3,2 1,0 1))");
+    test_geometry<bg::model::segment<P> >("SEGMENT(0 1,2 3)",
+        "LINESTRING(0 1,2 3)");
+    test_geometry<bg::model::multi_point<P> >("MULTIPOINT((1 2),(3 4))",
+        "MULTIPOINT((1 2),(3 4))");
+    test_geometry<bg::model::multi_linestring<bg::model::linestring<P> > >(
+        "MULTILINESTRING((1 1,2 2),(3 3,4 4))",
+        "MULTILINESTRING((1 1,2 2),(3 3,4 4))");
+    test_geometry<bg::model::multi_polygon<bg::model::polygon<P> > >(
+        "MULTIPOLYGON(((0 0,0 1,1 1,0 0)),((2 2,2 3,3 3,2 2)))",
+        "MULTIPOLYGON(((0 0,0 1,1 1,0 0)),((2 2,2 3,3 3,2 2)))");
+}
+
+void test_precision()
+{
+    test_geometry<bg::model::d2::point_xy<double> >("POINT(0.1 -2.25)",
+                                                   "POINT(0.1 -2.25)");
+    test_geometry<bg::model::d2::point_xy<float> >("POINT(0.1 -2.25)",
+                                                  "POINT(0.1 -2.25)");
+
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point_type;
+
+    // Coordinates are written completely, independent of stream settings
+    point_type const point(0.1 + 0.2, 1.0 / 3.0, -52.0912823457123);
+    std::string wkt;
+    bg::write_wkt(point, wkt);
+    BOOST_CHECK_EQUAL(wkt,
+        "POINT(0.30000000000000004 0.3333333333333333 -52.0912823457123)");
+
+    point_type read;
+    bg::read_wkt(wkt, read);
+    BOOST_CHECK(bg::get<0>(read) == bg::get<0>(point));
+    BOOST_CHECK(bg::get<1>(read) == bg::get<1>(point));
+    BOOST_CHECK(bg::get<2>(read) == bg::get<2>(point));
+}
+
+int test_main(int, char* [])
+{
+    test_numbers();
+
+    test_geometries<bg::model::d2::point_xy<double> >();
+    test_geometries<bg::model::d2::point_xy<float> >();
+    test_geometries<bg::model::d2::point_xy<int> >();
+    test_geometries<bg::model::point<long double, 2, bg::cs::cartesian> >();
+
+    test_precision();
+
+    return 0;
+}
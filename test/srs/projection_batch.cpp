@@ -0,0 +1,140 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/srs/projection.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+namespace srs = bg::srs;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > ll_point;
+typedef bg::model::point<double, 2, bg::cs::cartesian> xy_point;
+
+// Compares projection of arrays with projection of points
+template <typename Projection>
+void test_batch(std::string const& caseid, Projection const& prj,
+                std::vector<ll_point> const& points, bool inverse = true)
+{
+    double const d2r = bg::math::d2r<double>();
+    std::size_t const count = points.size();
+
+    std::vector<double> lon(count), lat(count), x(count), y(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        lon[i] = bg::get<0>(points[i]) * d2r;
+        lat[i] = bg::get<1>(points[i]) * d2r;
+    }
+
+    bool const all_valid = prj.forward(&lon[0], &lat[0], &x[0], &y[0], count);
+
+    bool expected_all_valid = true;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        xy_point xy;
+        bool const valid = prj.forward(points[i], xy);
+        expected_all_valid = expected_all_valid && valid;
+        if (! valid)
+        {
+            BOOST_CHECK_MESSAGE(x[i] == HUGE_VAL && y[i] == HUGE_VAL,
+                caseid << " point " << i << " expected invalid");
+            continue;
+        }
+
+        BOOST_CHECK_MESSAGE(bg::math::abs(x[i] - bg::get<0>(xy)) < 1.0e-6
+                         && bg::math::abs(y[i] - bg::get<1>(xy)) < 1.0e-6,
+            caseid << " point " << i << std::setprecision(16)
+                   << " expected: " << bg::wkt(xy)
+                   << " detected: " << x[i] << " " << y[i]);
+    }
+    BOOST_CHECK_MESSAGE(all_valid == expected_all_valid,
+        caseid << " validity expected: " << expected_all_valid
+               << " detected: " << all_valid);
+
+    if (! inverse)
+    {
+        return;
+    }
+
+    // Inverse in place
+    std::vector<double> ilon(x), ilat(y);
+    prj.inverse(&ilon[0], &ilat[0], &ilon[0], &ilat[0], count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (x[i] == HUGE_VAL)
+        {
+            continue;
+        }
+
+        ll_point ll;
+        prj.inverse(xy_point(x[i], y[i]), ll);
+        BOOST_CHECK_MESSAGE(bg::math::abs(ilon[i] / d2r - bg::get<0>(ll)) < 1.0e-9
+                         && bg::math::abs(ilat[i] / d2r - bg::get<1>(ll)) < 1.0e-9,
+            caseid << " inverse point " << i << std::setprecision(16)
+                   << " expected: " << bg::wkt(ll)
+                   << " detected: " << ilon[i] / d2r << " " << ilat[i] / d2r);
+    }
+}
+
+template <typename Parameters>
+void test_both(std::string const& caseid, Parameters const& parameters,
+               std::string const& proj4,
+               std::vector<ll_point> const& points)
+{
+    test_batch(caseid + "_static", srs::projection<Parameters>(parameters), points);
+    test_batch(caseid + "_dynamic", srs::projection<>(srs::proj4(proj4)), points);
+}
+
+int test_main(int, char* [])
+{
+    using namespace srs::spar;
+
+    // More points than one block, and points which can not be projected
+    std::vector<ll_point> points;
+    for (int i = 0; i < 600; i++)
+    {
+        points.push_back(ll_point(-10.0 + (i % 37) * 0.5, 30.0 + (i % 53) * 0.5));
+    }
+    points.push_back(ll_point(0.0, 91.0));
+    points.push_back(ll_point(0.0, 90.0));
+    points.push_back(ll_point(100.0, 45.0));
+
+    test_both("merc", parameters<proj_merc, ellps_wgs84>(),
+              "+proj=merc +ellps=WGS84", points);
+    test_both("merc_sphere", parameters<proj_merc, ellps_sphere>(),
+              "+proj=merc +ellps=sphere", points);
+    test_both("tmerc", parameters<proj_tmerc, ellps_wgs84, lon_0<> >(proj_tmerc(), ellps_wgs84(), lon_0<>(3)),
+              "+proj=tmerc +ellps=WGS84 +lon_0=3", points);
+    test_both("tmerc_sphere", parameters<proj_tmerc, ellps_sphere, lon_0<> >(proj_tmerc(), ellps_sphere(), lon_0<>(3)),
+              "+proj=tmerc +ellps=sphere +lon_0=3", points);
+    test_both("utm", parameters<proj_utm, ellps_wgs84, zone<31> >(),
+              "+proj=utm +ellps=WGS84 +zone=31", points);
+    test_both("lcc", parameters<proj_lcc, ellps_wgs84, lat_1<>, lat_2<> >(proj_lcc(), ellps_wgs84(), lat_1<>(35), lat_2<>(50)),
+              "+proj=lcc +ellps=WGS84 +lat_1=35 +lat_2=50", points);
+    test_both("aea", parameters<proj_aea, ellps_wgs84, lat_1<>, lat_2<> >(proj_aea(), ellps_wgs84(), lat_1<>(35), lat_2<>(50)),
+              "+proj=aea +ellps=WGS84 +lat_1=35 +lat_2=50", points);
+    test_both("stere", parameters<proj_stere, ellps_wgs84, lat_0<> >(proj_stere(), ellps_wgs84(), lat_0<>(45)),
+              "+proj=stere +ellps=WGS84 +lat_0=45", points);
+    test_both("stere_sphere", parameters<proj_stere, ellps_sphere, lat_0<> >(proj_stere(), ellps_sphere(), lat_0<>(45)),
+              "+proj=stere +ellps=sphere +lat_0=45", points);
+    test_both("stere_polar", parameters<proj_stere, ellps_wgs84, lat_0<> >(proj_stere(), ellps_wgs84(), lat_0<>(90)),
+              "+proj=stere +ellps=WGS84 +lat_0=90", points);
+    test_both("stere_polar_sphere", parameters<proj_stere, ellps_sphere, lat_0<> >(proj_stere(), ellps_sphere(), lat_0<>(-90)),
+              "+proj=stere +ellps=sphere +lat_0=-90", points);
+
+    // Projection without array kernels
+    test_both("robin", parameters<proj_robin, ellps_wgs84>(),
+              "+proj=robin +ellps=WGS84", points);
+
+    return 0;
+}
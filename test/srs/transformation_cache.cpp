@@ -0,0 +1,120 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/transformation_cache.hpp>
+
+#include <boost/thread.hpp>
+
+
+typedef bg::srs::transformation_cache<> cache_type;
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+struct cache_worker
+{
+    cache_worker(cache_type & cache, cache_type::transformation_ptr & result)
+        : m_cache(cache), m_result(result)
+    {}
+
+    void operator()() const
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            m_result = m_cache.get(bg::srs::epsg(4326),
+                                   bg::srs::proj4("+proj=utm +zone=34 +ellps=WGS84"));
+        }
+    }
+
+    cache_type & m_cache;
+    cache_type::transformation_ptr & m_result;
+};
+
+void test_cache()
+{
+    cache_type cache;
+    BOOST_CHECK(cache.empty());
+
+    bg::srs::proj4 const ll("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs");
+    bg::srs::proj4 const merc("+proj=merc +ellps=WGS84 +datum=WGS84");
+
+    cache_type::transformation_ptr const t1 = cache.get(ll, merc);
+    cache_type::transformation_ptr const t2 = cache.get(ll, merc);
+    cache_type::transformation_ptr const t3 = cache.get(merc, ll);
+    cache_type::transformation_ptr const t4 = cache.get(bg::srs::epsg(4326), merc);
+
+    BOOST_CHECK(t1 && t3 && t4);
+    BOOST_CHECK(t1 == t2);
+    BOOST_CHECK(t1 != t3);
+    BOOST_CHECK(t1 != t4);
+    BOOST_CHECK_EQUAL(cache.size(), 3u);
+
+    // Cached transformations give the same results as new ones
+    bg::srs::transformation<> const tr(ll, merc);
+    point_ll const pt(18.5, 54.2);
+    point_xy expected, detected, detected_epsg;
+    tr.forward(pt, expected);
+    t1->forward(pt, detected);
+    t4->forward(pt, detected_epsg);
+    BOOST_CHECK(bg::equals(expected, detected));
+    BOOST_CHECK_CLOSE(bg::get<0>(expected), bg::get<0>(detected_epsg), 1e-9);
+    BOOST_CHECK_CLOSE(bg::get<1>(expected), bg::get<1>(detected_epsg), 1e-9);
+
+    // Invalid definitions are not cached
+    bool thrown = false;
+    try
+    {
+        cache.get(ll, bg::srs::proj4("+proj=abcd"));
+    }
+    catch (bg::projection_exception const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+    BOOST_CHECK_EQUAL(cache.size(), 3u);
+
+    // Transformations stay valid after clearing
+    cache.clear();
+    BOOST_CHECK(cache.empty());
+    t1->forward(pt, detected);
+    BOOST_CHECK(bg::equals(expected, detected));
+    BOOST_CHECK(cache.get(ll, merc) != t1);
+}
+
+void test_threads()
+{
+    cache_type cache;
+
+    std::size_t const count = 4;
+    cache_type::transformation_ptr results[count];
+
+    boost::thread_group threads;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        threads.create_thread(cache_worker(cache, results[i]));
+    }
+    threads.join_all();
+
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        BOOST_CHECK(results[i] && results[i] == results[0]);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_cache();
+    test_threads();
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+// This unit test checks that transformations of ranges with datum shifts,
+// processed block by block, give the same results as transformations of
+// single points, processed in separate passes
+
+
+template <typename MPoint, typename Points>
+void check_points(std::string const& caseid, MPoint const& detected,
+                  Points const& expected)
+{
+    typedef typename boost::range_value<MPoint>::type point_type;
+
+    BOOST_CHECK_EQUAL(boost::size(detected), boost::size(expected));
+
+    std::size_t failures = 0;
+    for (std::size_t i = 0; i < boost::size(expected) && failures < 5; i++)
+    {
+        point_type const& d = detected[i];
+        point_type const& e = expected[i];
+        bool const same = bg::get<0>(d) == bg::get<0>(e)
+                       && bg::get<1>(d) == bg::get<1>(e)
+                       && bg::projections::detail::get_z(d)
+                            == bg::projections::detail::get_z(e);
+        if (! same)
+        {
+            failures++;
+        }
+        BOOST_CHECK_MESSAGE(same,
+            caseid << " point: " << i
+            << std::setprecision(17)
+            << " detected: " << bg::wkt(d)
+            << " expected: " << bg::wkt(e));
+    }
+}
+
+template <typename MPoint>
+void test_transformation(std::string const& caseid,
+                         std::string const& from, std::string const& to,
+                         MPoint const& mp)
+{
+    typedef typename boost::range_value<MPoint>::type point_type;
+
+    bg::srs::transformation<> tr((bg::srs::proj4(from)), (bg::srs::proj4(to)));
+
+    MPoint detected;
+    tr.forward(mp, detected);
+
+    std::vector<point_type> expected;
+    for (std::size_t i = 0; i < boost::size(mp); i++)
+    {
+        point_type pt;
+        tr.forward(mp[i], pt);
+        expected.push_back(pt);
+    }
+
+    check_points(caseid + " forward", detected, expected);
+
+    // Inverse of the forward results
+    MPoint inverse_detected;
+    tr.inverse(detected, inverse_detected);
+
+    std::vector<point_type> inverse_expected;
+    for (std::size_t i = 0; i < boost::size(detected); i++)
+    {
+        point_type pt;
+        tr.inverse(detected[i], pt);
+        inverse_expected.push_back(pt);
+    }
+
+    check_points(caseid + " inverse", inverse_detected, inverse_expected);
+}
+
+template <typename Point>
+bg::model::multi_point<Point> lon_lat_grid(double lon_min, double lon_max,
+                                           double lat_min, double lat_max)
+{
+    bg::model::multi_point<Point> mp;
+    // more points than in one block
+    for (int i = 0; i < 30; i++)
+    {
+        for (int j = 0; j < 20; j++)
+        {
+            Point p;
+            bg::set<0>(p, lon_min + (lon_max - lon_min) * i / 29.0);
+            bg::set<1>(p, lat_min + (lat_max - lat_min) * j / 19.0);
+            mp.push_back(p);
+        }
+    }
+    return mp;
+}
+
+template <typename Point>
+void test_all()
+{
+    typedef bg::model::multi_point<Point> mpoint;
+
+    std::string const wgs84 = "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs";
+    std::string const osgb36 = "+proj=longlat +ellps=airy +datum=OSGB36 +no_defs";
+    std::string const tmerc_3param = "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999"
+        " +x_0=500000 +y_0=0 +ellps=intl +towgs84=-87,-98,-121 +units=m";
+    std::string const nzgd49 = "+proj=longlat +ellps=intl"
+        " +towgs84=59.47,-5.04,187.44,0.47,-0.1,1.024,-4.5993";
+    std::string const paris = "+proj=longlat +ellps=clrk80 +pm=paris"
+        " +towgs84=-168,-60,320";
+    std::string const merc = "+proj=merc +ellps=clrk66 +towgs84=-8,160,176";
+
+    mpoint const europe = lon_lat_grid<Point>(-5, 25, 40, 60);
+
+    // 7 parameter datum
+    test_transformation("wgs84_osgb36", wgs84, osgb36, europe);
+    test_transformation("osgb36_wgs84", osgb36, wgs84, europe);
+    test_transformation("wgs84_nzgd49", wgs84, nzgd49,
+                        lon_lat_grid<Point>(165, 180, -48, -34));
+
+    // 3 parameter datum, source or destination projected
+    test_transformation("wgs84_tmerc", wgs84, tmerc_3param, europe);
+    test_transformation("osgb36_merc", osgb36, merc, europe);
+
+    // prime meridian
+    test_transformation("paris_wgs84", paris, wgs84, europe);
+    test_transformation("wgs84_paris", wgs84, paris, europe);
+}
+
+template <typename Point>
+void test_invalid()
+{
+    typedef bg::model::multi_point<Point> mpoint;
+
+    std::string const wgs84 = "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs";
+    std::string const osgb36 = "+proj=longlat +ellps=airy +datum=OSGB36 +no_defs";
+
+    // Invalid input points and latitudes out of range
+    mpoint mixed = lon_lat_grid<Point>(-5, 25, 40, 60);
+    bg::set<0>(mixed[3], HUGE_VAL);
+    bg::set<1>(mixed[3], HUGE_VAL);
+    bg::set<1>(mixed[10], 2.0);
+    bg::set<1>(mixed[300], -1.7);
+    test_transformation("mixed", wgs84, osgb36, mixed);
+}
+
+template <typename Point>
+void test_3d()
+{
+    typedef bg::model::multi_point<Point> mpoint;
+
+    mpoint mp;
+    for (int i = 0; i < 300; i++)
+    {
+        mp.push_back(Point((-5 + i * 0.1) * bg::math::d2r<double>(),
+                           (50 + i * 0.03) * bg::math::d2r<double>(),
+                           i * 10.0));
+    }
+
+    test_transformation("wgs84_osgb36_3d",
+                        "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs",
+                        "+proj=longlat +ellps=airy +datum=OSGB36 +no_defs",
+                        mp);
+    test_transformation("wgs84_tmerc_3d_vunits",
+                        "+proj=longlat +ellps=WGS84 +datum=WGS84 +vunits=ft",
+                        "+proj=tmerc +lon_0=21 +ellps=intl +towgs84=-87,-98,-121 +vunits=us-ft",
+                        mp);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point_3d;
+    typedef bg::model::point<float, 2, bg::cs::geographic<bg::degree> > point_llf;
+
+    test_all<point_ll>();
+    test_all<point_llf>();
+    test_invalid<point_ll>();
+    test_3d<point_3d>();
+
+    return 0;
+}
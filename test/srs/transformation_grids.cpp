@@ -0,0 +1,242 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/mapped_grids.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+
+// This unit test generates a NTv2 grid with a subgrid and compares the
+// transformations using grids loaded with std::ifstream with the ones
+// using grids decoded from memory-mapped files
+
+
+struct ntv2_writer
+{
+    explicit ntv2_writer(std::string const& filename)
+        : os(filename.c_str(), std::ios::binary)
+    {}
+
+    void record(char const* name, char const* value)
+    {
+        char buf[16];
+        std::memset(buf, ' ', sizeof(buf));
+        std::memcpy(buf, name, std::strlen(name));
+        std::memcpy(buf + 8, value, std::strlen(value));
+        os.write(buf, sizeof(buf));
+    }
+
+    template <typename T>
+    void record(char const* name, T const& value)
+    {
+        char buf[16];
+        std::memset(buf, 0, sizeof(buf));
+        std::memset(buf, ' ', 8);
+        std::memcpy(buf, name, std::strlen(name));
+        std::memcpy(buf + 8, &value, sizeof(T));
+        os.write(buf, sizeof(buf));
+    }
+
+    // Bounds in degrees, positive east, cells contain the shifts
+    // f(lon, lat) in seconds
+    template <typename Shift>
+    void subgrid(char const* name, char const* parent,
+                 double s_lat, double n_lat, double w_lon, double e_lon,
+                 double inc, Shift const& shift)
+    {
+        boost::int32_t const rows = boost::int32_t((n_lat - s_lat) / inc + 0.5) + 1;
+        boost::int32_t const cols = boost::int32_t((e_lon - w_lon) / inc + 0.5) + 1;
+
+        record("SUB_NAME", name);
+        record("PARENT", parent);
+        record("CREATED", "");
+        record("UPDATED", "");
+        // seconds, longitudes positive west
+        record("S_LAT", s_lat * 3600.0);
+        record("N_LAT", n_lat * 3600.0);
+        record("E_LONG", -e_lon * 3600.0);
+        record("W_LONG", -w_lon * 3600.0);
+        record("LAT_INC", inc * 3600.0);
+        record("LONG_INC", inc * 3600.0);
+        record("GS_COUNT", boost::int32_t(rows * cols));
+
+        // rows from south to north, columns from east to west
+        for (boost::int32_t r = 0; r < rows; r++)
+        {
+            for (boost::int32_t c = 0; c < cols; c++)
+            {
+                double const lon = e_lon - c * inc;
+                double const lat = s_lat + r * inc;
+                float values[4];
+                values[0] = float(shift.lat(lon, lat));
+                values[1] = float(shift.lon(lon, lat));
+                values[2] = 0.0f;
+                values[3] = 0.0f;
+                os.write(reinterpret_cast<char const*>(values), sizeof(values));
+            }
+        }
+    }
+
+    std::ofstream os;
+};
+
+struct parent_shift
+{
+    double lat(double lon, double lat) const { return 1.0 + 0.1 * lon - 0.05 * (lat - 50); }
+    double lon(double lon, double lat) const { return -2.0 + 0.02 * lon * (lat - 50); }
+};
+
+struct child_shift
+{
+    double lat(double lon, double lat) const { return 3.0 + 0.5 * lon + 0.25 * lat; }
+    double lon(double lon, double lat) const { return 1.5 * lon - 0.1 * lat; }
+};
+
+void write_grid(std::string const& filename)
+{
+    ntv2_writer w(filename);
+    w.record("NUM_OREC", boost::int32_t(11));
+    w.record("NUM_SREC", boost::int32_t(11));
+    w.record("NUM_FILE", boost::int32_t(2));
+    w.record("GS_TYPE", "SECONDS");
+    w.record("VERSION", "NTv2.0");
+    w.record("SYSTEM_F", "TEST");
+    w.record("SYSTEM_T", "WGS84");
+    w.record("MAJOR_F", 6378137.0);
+    w.record("MINOR_F", 6356752.314);
+    w.record("MAJOR_T", 6378137.0);
+    w.record("MINOR_T", 6356752.314);
+
+    w.subgrid("PARENT", "NONE", 40, 60, -10, 10, 1.0, parent_shift());
+    w.subgrid("CHILD", "PARENT", 50, 52, 0, 2, 0.25, child_shift());
+}
+
+template <typename GridsStorage, typename Transformation, typename MPoint>
+MPoint transform(Transformation const& tr, MPoint const& mp, bool inverse)
+{
+    GridsStorage storage;
+    bg::srs::transformation_grids<GridsStorage> grids
+        = tr.initialize_grids(storage);
+
+    BOOST_CHECK(storage.hgrids.size() == 1);
+
+    MPoint result;
+    if (inverse)
+    {
+        tr.inverse(mp, result, grids);
+    }
+    else
+    {
+        tr.forward(mp, result, grids);
+    }
+    return result;
+}
+
+template <typename T>
+void test_grids(std::string const& filename)
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> point;
+    typedef bg::model::multi_point<point> mpoint;
+
+    T const d2r = bg::math::d2r<T>();
+
+    bg::srs::transformation<> tr(
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +nadgrids=" + filename),
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +datum=WGS84"));
+
+    // Points in the parent, in the child, outside and at the borders
+    mpoint mp;
+    for (int i = -12; i <= 12; i++)
+    {
+        for (int j = 38; j <= 62; j++)
+        {
+            bg::append(mp, point((i + 0.37) * d2r, (j + 0.61) * d2r));
+        }
+    }
+    for (int i = 0; i <= 20; i++)
+    {
+        bg::append(mp, point(i * 0.1 * d2r, (50 + i * 0.1) * d2r));
+    }
+    bg::append(mp, point(10 * d2r, 60 * d2r));
+    bg::append(mp, point(-10 * d2r, 40 * d2r));
+
+    typedef bg::srs::grids_storage<> ifstream_storage;
+    typedef bg::srs::grids_storage
+        <
+            bg::srs::mapped_file_policy, bg::srs::grids
+        > mapped_file_storage;
+    typedef bg::srs::mapped_grids_storage mapped_storage;
+
+    for (int inverse = 0; inverse < 2; inverse++)
+    {
+        mpoint const expected = transform<ifstream_storage>(tr, mp, inverse != 0);
+        mpoint const loaded = transform<mapped_file_storage>(tr, mp, inverse != 0);
+        mpoint const mapped = transform<mapped_storage>(tr, mp, inverse != 0);
+
+        BOOST_CHECK(boost::size(expected) == boost::size(mp));
+        BOOST_CHECK(boost::size(loaded) == boost::size(mp));
+        BOOST_CHECK(boost::size(mapped) == boost::size(mp));
+
+        std::size_t shifted = 0;
+        for (std::size_t i = 0; i < boost::size(mp); i++)
+        {
+            point const& e = expected[i];
+            if (! bg::equals(e, mp[i]))
+            {
+                shifted++;
+            }
+
+            BOOST_CHECK_MESSAGE(bg::get<0>(e) == bg::get<0>(loaded[i])
+                             && bg::get<1>(e) == bg::get<1>(loaded[i]),
+                                "inverse: " << inverse << " point: " << i
+                                << " ifstream: " << bg::wkt(e)
+                                << " mapped file: " << bg::wkt(loaded[i]));
+            BOOST_CHECK_MESSAGE(bg::get<0>(e) == bg::get<0>(mapped[i])
+                             && bg::get<1>(e) == bg::get<1>(mapped[i]),
+                                "inverse: " << inverse << " point: " << i
+                                << " ifstream: " << bg::wkt(e)
+                                << " mapped grids: " << bg::wkt(mapped[i]));
+        }
+
+        // Points outside of the grid are not shifted
+        BOOST_CHECK(shifted > 0 && shifted < boost::size(mp));
+    }
+}
+
+void test_missing()
+{
+    bg::srs::transformation<> tr(
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +nadgrids=@missing.gsb"),
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +datum=WGS84"));
+
+    bg::srs::mapped_grids_storage storage;
+    tr.initialize_grids(storage);
+    BOOST_CHECK(storage.hgrids.empty());
+    BOOST_CHECK(storage.hgrids.files.empty());
+}
+
+int test_main(int, char* [])
+{
+    std::string const filename = "transformation_grids_test.gsb";
+    write_grid(filename);
+
+    test_grids<double>(filename);
+    test_grids<float>(filename);
+    test_missing();
+
+    std::remove(filename.c_str());
+
+    return 0;
+}
@@ -0,0 +1,303 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+#include <boost/geometry/strategies/transform/srs_transformer.hpp>
+
+#include <boost/variant/variant.hpp>
+
+
+// This unit test checks that transformations using several threads give
+// the same results as sequential transformations
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+
+template <typename Point>
+bool same_points(Point const& p1, Point const& p2)
+{
+    return bg::get<0>(p1) == bg::get<0>(p2)
+        && bg::get<1>(p1) == bg::get<1>(p2);
+}
+
+template <typename Range>
+void check_ranges(std::string const& caseid, Range const& detected,
+                  Range const& expected)
+{
+    BOOST_CHECK_EQUAL(boost::size(detected), boost::size(expected));
+
+    std::size_t failures = 0;
+    for (std::size_t i = 0; i < boost::size(expected) && i < boost::size(detected)
+                            && failures < 5; i++)
+    {
+        bool const same = same_points(bg::range::at(detected, i),
+                                      bg::range::at(expected, i));
+        if (! same)
+        {
+            failures++;
+        }
+        BOOST_CHECK_MESSAGE(same,
+            caseid << " point: " << i
+            << std::setprecision(17)
+            << " detected: " << bg::wkt(bg::range::at(detected, i))
+            << " expected: " << bg::wkt(bg::range::at(expected, i)));
+    }
+}
+
+template <typename Polygon>
+void check_polygons(std::string const& caseid, Polygon const& detected,
+                    Polygon const& expected)
+{
+    check_ranges(caseid, bg::exterior_ring(detected), bg::exterior_ring(expected));
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(detected),
+                      bg::num_interior_rings(expected));
+    for (std::size_t i = 0; i < bg::num_interior_rings(expected)
+                            && i < bg::num_interior_rings(detected); i++)
+    {
+        check_ranges(caseid, bg::interior_rings(detected)[i],
+                     bg::interior_rings(expected)[i]);
+    }
+}
+
+template <typename MultiPolygon>
+void check_multi_polygons(std::string const& caseid, MultiPolygon const& detected,
+                          MultiPolygon const& expected)
+{
+    BOOST_CHECK_EQUAL(boost::size(detected), boost::size(expected));
+    for (std::size_t i = 0; i < boost::size(expected)
+                            && i < boost::size(detected); i++)
+    {
+        check_polygons(caseid, detected[i], expected[i]);
+    }
+}
+
+template <typename Ring>
+void circle(Ring & ring, double x, double y, double r, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const a = -2.0 * bg::math::pi<double>() * double(i) / double(count);
+        bg::append(ring, point_ll(x + r * cos(a), y + r * sin(a)));
+    }
+    bg::append(ring, bg::range::front(ring));
+}
+
+template <typename Polygon>
+Polygon polygon_with_holes(double x, double y, std::size_t count)
+{
+    Polygon poly;
+    circle(bg::exterior_ring(poly), x, y, 2.0, count);
+    bg::interior_rings(poly).resize(3);
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        circle(bg::interior_rings(poly)[i], x - 1.0 + i * 0.9, y, 0.3, count / 4);
+        std::reverse(bg::interior_rings(poly)[i].begin(),
+                     bg::interior_rings(poly)[i].end());
+    }
+    return poly;
+}
+
+void test_srs(std::string const& to)
+{
+    typedef bg::model::polygon<point_ll> polygon_ll;
+    typedef bg::model::polygon<point_xy> polygon_xy;
+    typedef bg::model::multi_polygon<polygon_ll> mpolygon_ll;
+    typedef bg::model::multi_polygon<polygon_xy> mpolygon_xy;
+    typedef bg::model::linestring<point_ll> linestring_ll;
+    typedef bg::model::linestring<point_xy> linestring_xy;
+    typedef bg::model::multi_linestring<linestring_ll> mlinestring_ll;
+    typedef bg::model::multi_linestring<linestring_xy> mlinestring_xy;
+    typedef bg::model::multi_point<point_ll> mpoint_ll;
+    typedef bg::model::multi_point<point_xy> mpoint_xy;
+
+    bg::srs::transformation<> tr(
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs"),
+        bg::srs::proj4(to));
+
+    // Many small polygons and one long ring
+    mpolygon_ll mpoly;
+    for (int i = 0; i < 40; i++)
+    {
+        mpoly.push_back(polygon_with_holes<polygon_ll>(10 + (i % 8) * 5,
+                                                       40 + (i / 8) * 5, 60));
+    }
+    mpoly.push_back(polygon_with_holes<polygon_ll>(20, 30, 20000));
+
+    mpolygon_xy expected_mpoly, detected_mpoly;
+    bool const res_mpoly = tr.forward(mpoly, expected_mpoly);
+    BOOST_CHECK(res_mpoly);
+    BOOST_CHECK(tr.forward(mpoly, detected_mpoly, 4) == res_mpoly);
+    check_multi_polygons(to + " multi polygon", detected_mpoly, expected_mpoly);
+
+    // Inverse, the results are the same as the sequential inverse
+    mpolygon_ll expected_inv, detected_inv;
+    tr.inverse(expected_mpoly, expected_inv);
+    tr.inverse(expected_mpoly, detected_inv, 3);
+    check_multi_polygons(to + " inverse", detected_inv, expected_inv);
+
+    // One long polygon, the rings are divided
+    polygon_xy expected_poly, detected_poly;
+    tr.forward(mpoly.back(), expected_poly);
+    tr.forward(mpoly.back(), detected_poly, 0);
+    check_polygons(to + " polygon", detected_poly, expected_poly);
+
+    // Long linestring and multi linestring
+    linestring_ll line;
+    for (int i = 0; i < 30000; i++)
+    {
+        bg::append(line, point_ll(-20 + i * 0.002, 35 + i * 0.001));
+    }
+    linestring_xy expected_line, detected_line;
+    tr.forward(line, expected_line);
+    tr.forward(line, detected_line, 4);
+    check_ranges(to + " linestring", detected_line, expected_line);
+
+    mlinestring_ll mline;
+    mline.push_back(line);
+    mline.push_back(linestring_ll(line.begin(), line.begin() + 10));
+    mline.push_back(line);
+    mlinestring_xy expected_mline, detected_mline;
+    tr.forward(mline, expected_mline);
+    tr.forward(mline, detected_mline, 4);
+    BOOST_CHECK_EQUAL(boost::size(detected_mline), boost::size(expected_mline));
+    for (std::size_t i = 0; i < boost::size(expected_mline); i++)
+    {
+        check_ranges(to + " multi linestring", detected_mline[i], expected_mline[i]);
+    }
+
+    // Transformation in place
+    mpolygon_ll in_place = mpoly, in_place_expected = mpoly;
+    tr.forward(in_place_expected, in_place_expected);
+    tr.forward(in_place, in_place, 4);
+    check_multi_polygons(to + " in place", in_place, in_place_expected);
+
+    // Invalid points are set as invalid, in both cases false is returned
+    mpoint_ll mpoint(line.begin(), line.end());
+    bg::set<1>(mpoint[100], 95.0);
+    bg::set<1>(mpoint[20000], -95.0);
+    mpoint_xy expected_mpoint, detected_mpoint;
+    bool const res_mpoint = tr.forward(mpoint, expected_mpoint);
+    BOOST_CHECK(tr.forward(mpoint, detected_mpoint, 4) == res_mpoint);
+    check_ranges(to + " multi point", detected_mpoint, expected_mpoint);
+}
+
+void test_geometry_transform()
+{
+    typedef bg::model::polygon<point_ll> polygon_ll;
+    typedef bg::model::polygon<point_xy> polygon_xy;
+    typedef bg::model::multi_polygon<polygon_ll> mpolygon_ll;
+    typedef bg::model::multi_polygon<polygon_xy> mpolygon_xy;
+    typedef bg::model::linestring<point_xy> linestring_xy;
+
+    mpolygon_ll mpoly;
+    for (int i = 0; i < 8; i++)
+    {
+        mpoly.push_back(polygon_with_holes<polygon_ll>(i * 5, 10, 10000));
+    }
+
+    // Map projection strategy
+    bg::strategy::transform::srs_forward_transformer
+        <
+            bg::srs::projection<>
+        > const strategy(bg::srs::proj4("+proj=tmerc +ellps=WGS84 +units=m"));
+
+    mpolygon_xy expected_mpoly, detected_mpoly;
+    BOOST_CHECK(bg::transform(mpoly, expected_mpoly, strategy));
+    BOOST_CHECK(bg::transform(mpoly, detected_mpoly, strategy, 4));
+    check_multi_polygons("transform multi polygon", detected_mpoly, expected_mpoly);
+
+    // Points are appended to the output linestring
+    linestring_xy line, expected_line, detected_line;
+    for (int i = 0; i < 50000; i++)
+    {
+        bg::append(line, point_xy(i * 0.5, i * 0.25));
+    }
+    expected_line.push_back(point_xy(-1, -1));
+    detected_line.push_back(point_xy(-1, -1));
+
+    bg::strategy::transform::translate_transformer<double, 2, 2> const
+        translate(10.0, 20.0);
+    BOOST_CHECK(bg::transform(line, expected_line, translate));
+    BOOST_CHECK(bg::transform(line, detected_line, translate, 0));
+    check_ranges("transform linestring", detected_line, expected_line);
+
+    // Variants are resolved before the transformation
+    boost::variant<linestring_xy> const variant_line(line);
+    linestring_xy variant_detected;
+    variant_detected.push_back(point_xy(-1, -1));
+    BOOST_CHECK(bg::transform(variant_line, variant_detected, translate, 4));
+    check_ranges("transform variant", variant_detected, expected_line);
+
+    // Points of multi points are replaced and points of multi linestrings
+    // are appended, for small inputs and for inputs divided into chunks
+    typedef bg::model::multi_point<point_xy> mpoint_xy;
+    typedef bg::model::multi_linestring<linestring_xy> mlinestring_xy;
+    std::size_t const counts[] = { 10, 50000 };
+    std::size_t const thread_counts[] = { 1, 4 };
+    for (std::size_t i = 0; i < 2; i++)
+    {
+        linestring_xy const part(line.begin(), line.begin() + counts[i]);
+        mpoint_xy const mpoint(part.begin(), part.end());
+        mlinestring_xy mline;
+        mline.resize(2, part);
+
+        mpoint_xy initial_mpoint;
+        initial_mpoint.resize(3, point_xy(-1, -1));
+        mlinestring_xy initial_mline;
+        initial_mline.resize(1);
+        initial_mline[0].resize(3, point_xy(-1, -1));
+
+        mpoint_xy expected_mpoint = initial_mpoint;
+        mlinestring_xy expected_mline = initial_mline;
+        BOOST_CHECK(bg::transform(mpoint, expected_mpoint, translate));
+        BOOST_CHECK(bg::transform(mline, expected_mline, translate));
+        BOOST_CHECK_EQUAL(boost::size(expected_mpoint), counts[i]);
+        BOOST_CHECK_EQUAL(boost::size(expected_mline[0]), counts[i] + 3);
+
+        for (std::size_t j = 0; j < 2; j++)
+        {
+            mpoint_xy detected_mpoint = initial_mpoint;
+            mlinestring_xy detected_mline = initial_mline;
+            BOOST_CHECK(bg::transform(mpoint, detected_mpoint, translate,
+                                      thread_counts[j]));
+            BOOST_CHECK(bg::transform(mline, detected_mline, translate,
+                                      thread_counts[j]));
+            check_ranges("transform multi point", detected_mpoint, expected_mpoint);
+            BOOST_CHECK_EQUAL(boost::size(detected_mline), 2u);
+            check_ranges("transform multi linestring", detected_mline[0], expected_mline[0]);
+            check_ranges("transform multi linestring", detected_mline[1], expected_mline[1]);
+        }
+    }
+
+    // Failing strategy
+    bg::strategy::transform::srs_forward_transformer
+        <
+            bg::srs::projection<>
+        > const ortho(bg::srs::proj4("+proj=ortho +ellps=WGS84 +lat_0=0 +lon_0=180"));
+    BOOST_CHECK(! bg::transform(mpoly, detected_mpoly, ortho));
+    BOOST_CHECK(! bg::transform(mpoly, detected_mpoly, ortho, 4));
+}
+
+int test_main(int, char* [])
+{
+    // 3 parameter datum shift
+    test_srs("+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999"
+             " +x_0=500000 +y_0=0 +ellps=intl +towgs84=-87,-98,-121 +units=m");
+    // projection only
+    test_srs("+proj=merc +ellps=WGS84 +datum=WGS84");
+
+    test_geometry_transform();
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+#include <algorithms/test_convex_hull.hpp>
+
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategies/agnostic/hull_akl_toussaint.hpp>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+
+template <typename Geometry>
+void test_geometry_akl(std::string const& wkt, std::size_t size_original,
+                       std::size_t size_hull_closed, double expected_area)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::polygon<point_type> hull_type;
+    typedef bg::strategy::convex_hull::akl_toussaint
+        <
+            Geometry, point_type
+        > strategy_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    test_convex_hull<hull_type, strategy_type>(geometry, size_original,
+        size_hull_closed, expected_area, -1.0, false);
+}
+
+// Compares the hull with the hull of the default strategy
+template <typename MultiPoint>
+void test_compare(MultiPoint const& mp, std::size_t thread_count,
+                  std::string const& caseid)
+{
+    typedef typename bg::point_type<MultiPoint>::type point_type;
+    typedef bg::model::ring<point_type> ring_type;
+
+    ring_type expected, detected;
+    bg::convex_hull(mp, expected);
+    bg::convex_hull(mp, detected,
+        bg::strategy::convex_hull::akl_toussaint<MultiPoint, point_type>(thread_count));
+
+    BOOST_CHECK_MESSAGE(boost::size(expected) == boost::size(detected),
+        caseid << " threads: " << thread_count
+        << " expected: " << boost::size(expected)
+        << " detected: " << boost::size(detected));
+    BOOST_CHECK_MESSAGE(bg::equals(expected, detected),
+        caseid << " threads: " << thread_count << " hulls differ");
+}
+
+template <typename P>
+void test_random()
+{
+    typedef bg::model::multi_point<P> mp_type;
+
+    boost::mt19937 generator(12345);
+    boost::random::uniform_real_distribution<double> random(-1000.0, 1000.0);
+
+    std::size_t const count = 200000;
+    mp_type square, circle, cross;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const x = random(generator);
+        double const y = random(generator);
+        bg::append(square, P(x, y));
+
+        // Many points on the hull
+        double const angle = x / 1000.0 * 3.14159265358979;
+        bg::append(circle, P(std::cos(angle) * 500.0, std::sin(angle) * 500.0));
+
+        // Collinear points and duplicates on the extremes
+        bg::append(cross, i % 2 == 0 ? P(std::floor(x), 0) : P(0, std::floor(y)));
+    }
+
+    std::size_t const threads[] = { 1, 2, 4, 0 };
+    for (std::size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++)
+    {
+        test_compare(square, threads[i], "square");
+        test_compare(circle, threads[i], "circle");
+        test_compare(cross, threads[i], "cross");
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    test_geometry_akl<bg::model::linestring<P> >(
+        "linestring(1.1 1.1, 2.5 2.1, 3.1 3.1, 4.9 1.1, 3.1 1.9)", 5, 4, 3.8);
+
+    test_geometry_akl<bg::model::polygon<P> >(
+        "polygon((1 1, 1 4, 3 4, 3 3, 4 3, 4 4, 5 4, 5 1, 1 1))",
+                9, 5, 12.0);
+
+    test_geometry_akl<bg::model::polygon<P> >(
+        "polygon((2.0 1.3, 2.4 1.7, 2.8 1.8, 3.4 1.2, 3.7 1.6,3.4 2.0, 4.1 3.0"
+        ", 5.3 2.6, 5.4 1.2, 4.9 0.8, 2.9 0.7,2.0 1.3))",
+                12, 8, 5.245);
+
+    test_geometry_akl<bg::model::multi_point<P> >(
+        "multipoint(0 0, 1 1, 2 2, 2 0, 0 2, 1 0, 1 2, 0 1, 2 1)",
+                9, 5, 4.0);
+
+    // degenerated hulls
+    test_geometry_akl<bg::model::multi_point<P> >("multipoint(0 0)", 1, 4, 0);
+    test_geometry_akl<bg::model::multi_point<P> >("multipoint(0 0, 2 0)", 2, 4, 0);
+    test_geometry_akl<bg::model::multi_point<P> >("multipoint(0 0, 1 1, 2 2)", 3, 4, 0);
+
+    test_empty_input<bg::model::multi_point<P> >();
+
+    test_random<P>();
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}